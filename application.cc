@@ -25,6 +25,10 @@ Application::Application(int *pargc, char ***pargv) {
   _tetrahedrization = NULL;
   _viewer = NULL;
   
+  // the edit journal is written on a thread of its own
+  if (!g_thread_supported()) {
+    g_thread_init(NULL);
+  }
   gtk_init(pargc, pargv);
   gtk_gl_init(pargc, pargv);
   _parse_command_line(*pargc, *pargv);
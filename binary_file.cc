@@ -0,0 +1,195 @@
+#include <cassert>
+#include <cstring>
+
+#include "binary_file.hh"
+
+using namespace std;
+
+static const char MAGIC[4] = { '\211', 'R', 'L', 'F' };
+// Rationale:
+// a non-ASCII first byte cannot start the file name on the first line of
+// text RLF files
+static const guint32 BYTE_ORDER_MARK = 0x01020304;
+static const guint64 SECTION_ALIGNMENT = 8;
+// Rationale:
+// sections are read in place, so their arrays must be aligned on the
+// largest element size, mapped files being page aligned
+
+typedef struct {
+  char magic[4];
+  guint32 byte_order, version, number_of_entries;
+} Header;
+
+const guint32 Binary_file::VERSION;
+const guint32 Binary_file::NULL_INDEX;
+
+static inline guint64
+align(guint64 offset) {
+  return (offset + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+}
+
+Binary_file::Binary_file(void)
+  : _mapped_file(NULL),
+    _entries(),
+    _buffers() {}
+
+Binary_file::~Binary_file(void) {
+  clear();
+}
+
+bool
+Binary_file::is_binary_file(istream& in) {
+  char magic[sizeof(MAGIC)];
+  streampos pos = in.tellg();
+  in.read(magic, sizeof(MAGIC));
+  bool is_binary = (in.gcount() == sizeof(MAGIC) &&
+                    memcmp(magic, MAGIC, sizeof(MAGIC)) == 0);
+  in.clear();
+  in.seekg(pos);
+  return is_binary;
+}
+
+bool
+Binary_file::read(const char *name) {
+  clear();
+  GError *error = NULL;
+  _mapped_file = g_mapped_file_new(name, FALSE, &error);
+  if (_mapped_file == NULL) {
+    cerr << "Error: " << error->message << "!" << endl;
+    g_error_free(error);
+    return false;
+  }
+  const char *contents = g_mapped_file_get_contents(_mapped_file);
+  guint64 length = g_mapped_file_get_length(_mapped_file);
+  
+  Header header;
+  if (contents == NULL || length < sizeof(Header)) {
+    cerr << "Error: truncated binary file header!" << endl;
+    clear();
+    return false;
+  }
+  memcpy(&header, contents, sizeof(Header));
+  if (memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    cerr << "Error: not a binary RLF file!" << endl;
+    clear();
+    return false;
+  }
+  if (header.byte_order != BYTE_ORDER_MARK) {
+    cerr << "Error: binary file written with another byte order!" << endl;
+    clear();
+    return false;
+  }
+  if (header.version != VERSION) {
+    cerr << "Error: unsupported binary file version "
+         << header.version << "!" << endl;
+    clear();
+    return false;
+  }
+  if (length < sizeof(Header)
+               + (guint64) header.number_of_entries * sizeof(_Entry)) {
+    cerr << "Error: truncated binary file section table!" << endl;
+    clear();
+    return false;
+  }
+  _entries.resize(header.number_of_entries);
+  if (!_entries.empty()) {
+    memcpy(&_entries[0], contents + sizeof(Header),
+           _entries.size() * sizeof(_Entry));
+  }
+  for (vector<_Entry>::const_iterator ei = _entries.begin();
+       ei != _entries.end(); ei++) {
+    if (ei->offset % SECTION_ALIGNMENT != 0 ||
+        ei->offset > length || ei->size > length - ei->offset ||
+        ei->element_size == 0 || ei->size % ei->element_size != 0) {
+      cerr << "Error: corrupted binary file section table!" << endl;
+      clear();
+      return false;
+    }
+  }
+  return true;
+}
+
+bool
+Binary_file::write(ostream& out) const {
+  assert(_entries.size() == _buffers.size());
+  static const char PADDING[SECTION_ALIGNMENT] = { 0 };
+  
+  Header header;
+  memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.byte_order = BYTE_ORDER_MARK;
+  header.version = VERSION;
+  header.number_of_entries = _entries.size();
+  
+  // offsets follow the section table, in the order sections were set
+  vector<_Entry> entries(_entries);
+  guint64 offset = align(sizeof(Header) + entries.size() * sizeof(_Entry));
+  for (vector<_Entry>::iterator ei = entries.begin();
+       ei != entries.end(); ei++) {
+    ei->offset = offset;
+    offset = align(offset + ei->size);
+  }
+  
+  out.write((const char *) &header, sizeof(Header));
+  if (!entries.empty()) {
+    out.write((const char *) &entries[0], entries.size() * sizeof(_Entry));
+  }
+  guint64 position = sizeof(Header) + entries.size() * sizeof(_Entry);
+  for (unsigned int i = 0; i < entries.size(); i++) {
+    out.write(PADDING, entries[i].offset - position);
+    if (!_buffers[i].empty()) {
+      out.write(&_buffers[i][0], _buffers[i].size());
+    }
+    position = entries[i].offset + entries[i].size;
+  }
+  out.flush();
+  return !out.fail();
+}
+
+void
+Binary_file::clear(void) {
+  if (_mapped_file != NULL) {
+    g_mapped_file_free(_mapped_file);
+    _mapped_file = NULL;
+  }
+  _entries.clear();
+  _buffers.clear();
+}
+
+void
+Binary_file::_set_section(Section section, guint32 element_size,
+                          const void *data, guint64 size) {
+  assert(_mapped_file == NULL);
+  assert(section < NUMBER_OF_SECTIONS);
+  _Entry entry;
+  entry.section = section;
+  entry.element_size = element_size;
+  entry.offset = 0;
+  entry.size = size;
+  _entries.push_back(entry);
+  _buffers.push_back(vector<char>((const char *) data,
+                                  (const char *) data + size));
+}
+
+const void *
+Binary_file::_section(Section section, guint32 element_size,
+                      guint64& size) const {
+  for (unsigned int i = 0; i < _entries.size(); i++) {
+    const _Entry& entry = _entries[i];
+    if (entry.section == (guint32) section) {
+      if (entry.element_size != element_size) {
+        cerr << "Error: unexpected element size in binary file section "
+             << section << "!" << endl;
+        return NULL;
+      }
+      size = entry.size / element_size;
+      if (_mapped_file != NULL) {
+        return g_mapped_file_get_contents(_mapped_file) + entry.offset;
+      } else {
+        // sections set but not written yet
+        return _buffers[i].empty() ? NULL : &_buffers[i][0];
+      }
+    }
+  }
+  size = 0;
+  return NULL;
+}
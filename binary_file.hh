@@ -0,0 +1,84 @@
+#ifndef __BINARY_FILE_HH__
+#define __BINARY_FILE_HH__
+
+#include <iostream>
+#include <vector>
+#include <glib.h>
+
+/*
+ * Versioned binary container of the RLF format. A header holds the offsets
+ * of typed sections, which are flat arrays read in place from a memory map.
+ * Files are written in the byte order of the machine and rejected on
+ * machines of the other byte order.
+ */
+class Binary_file {
+public:
+  typedef enum {
+    TRIANGULATION,              // dimension, vertices, faces
+    TRIANGULATION_POINTS,       // 2 coordinates per finite vertex
+    TRIANGULATION_GRANULARITIES,
+    TRIANGULATION_FACES,        // 3 vertex indices per face
+    TRIANGULATION_NEIGHBORS,    // 3 face indices per face
+    TRIANGULATION_FLAGS,        // bit-packed face flags
+    TETRAHEDRIZATION,           // dimension, vertices, cells
+    TETRAHEDRIZATION_POINTS,    // 3 coordinates per finite vertex
+    TETRAHEDRIZATION_GRANULARITIES,
+    TETRAHEDRIZATION_CELLS,     // 4 vertex indices per cell
+    TETRAHEDRIZATION_NEIGHBORS, // 4 cell indices per cell
+    TETRAHEDRIZATION_FLAGS,     // bit-packed cell flags
+    DRAWING,                    // curve state
+    DRAWING_MARKING_PATHS,      // number of points per marking path
+    DRAWING_MARKING_POINTS,     // 2 coordinates per marking path point
+    NUMBER_OF_SECTIONS
+  } Section;
+  
+  static const guint32 VERSION = 2;
+  static const guint32 NULL_INDEX = ~0u;
+  
+  Binary_file(void);
+  ~Binary_file(void);
+  // true when the stream starts with the binary file magic number
+  // the stream position is left unchanged
+  static bool is_binary_file(std::istream& in);
+  bool read(const char *name);
+  bool write(std::ostream& out) const;
+  void clear(void);
+  template <typename T>
+  void set_section(Section section, const std::vector<T>& data) {
+    _set_section(section, sizeof(T),
+                 data.empty() ? NULL : &data[0], data.size() * sizeof(T));
+  }
+  // NULL when the section is missing or holds elements of another size
+  template <typename T>
+  const T *section(Section section, guint64& size) const {
+    return (const T *) _section(section, sizeof(T), size);
+  }
+  static void set_bit(std::vector<guint8>& bits, guint64 i, bool b) {
+    if (bits.size() <= (i >> 3)) {
+      bits.resize((i >> 3) + 1, 0);
+    }
+    if (b) {
+      bits[i >> 3] |= (1 << (i & 7));
+    }
+  }
+  static bool bit(const guint8 *bits, guint64 i) {
+    return (bits[i >> 3] & (1 << (i & 7))) != 0;
+  }
+  
+private:
+  typedef struct {
+    guint32 section, element_size;
+    guint64 offset, size;
+  } _Entry;
+  
+  void _set_section(Section section, guint32 element_size,
+                    const void *data, guint64 size);
+  const void *_section(Section section, guint32 element_size,
+                       guint64& size) const;
+  
+  GMappedFile *_mapped_file;
+  std::vector<_Entry> _entries;
+  std::vector<std::vector<char> > _buffers;
+};
+
+#endif // __BINARY_FILE_HH__
@@ -0,0 +1,547 @@
+#include <cassert>
+#include <cfloat>
+#include <algorithm>
+
+#include "bounding_volume_hierarchy.hh"
+
+using namespace std;
+
+static const unsigned int MAX_LEAF_SIZE = 4;
+static const int NUMBER_OF_BINS = 12;
+static const int MAX_DEPTH = 64;
+static const unsigned int STACK_SIZE = MAX_DEPTH + 1;
+// Rationale:
+// binned SAH with a dozen bins is within a few percent of the full sweep,
+// and depth is bounded so that traversal stacks can live on the stack
+static const GLfloat SEGMENT_EPSILON = 1e-4f;
+// Rationale:
+// relative to the segment length, so that a vertex lying on a facet does
+// not occlude itself through rounding
+static const int VISIBILITY_CHUNK_SIZE = 64;
+
+static inline GLfloat
+box_area(const GLfloat min[3], const GLfloat max[3]) {
+  GLfloat dx = max[0] - min[0], dy = max[1] - min[1], dz = max[2] - min[2];
+  return 2.0f * (dx * dy + dy * dz + dz * dx);
+}
+
+static inline void
+box_reset(GLfloat min[3], GLfloat max[3]) {
+  for (int k = 0; k < 3; k++) {
+    min[k] =  FLT_MAX;
+    max[k] = -FLT_MAX;
+  }
+}
+
+static inline void
+box_extend(GLfloat min[3], GLfloat max[3],
+           const GLfloat bmin[3], const GLfloat bmax[3]) {
+  for (int k = 0; k < 3; k++) {
+    if (bmin[k] < min[k]) min[k] = bmin[k];
+    if (bmax[k] > max[k]) max[k] = bmax[k];
+  }
+}
+
+static inline bool
+ray_hits_box(const GLfloat min[3], const GLfloat max[3],
+             const GLfloat origin[3], const GLfloat inverse_direction[3],
+             GLfloat t_max) {
+  GLfloat t_near = 0.0f, t_far = t_max;
+  for (int k = 0; k < 3; k++) {
+    GLfloat t0 = (min[k] - origin[k]) * inverse_direction[k];
+    GLfloat t1 = (max[k] - origin[k]) * inverse_direction[k];
+    if (t0 > t1) swap(t0, t1);
+    if (t0 > t_near) t_near = t0;
+    if (t1 < t_far) t_far = t1;
+    if (t_near > t_far) return false;
+  }
+  return true;
+}
+
+static inline GLfloat
+box_squared_distance(const GLfloat min[3], const GLfloat max[3],
+                     const GLfloat p[3]) {
+  GLfloat d2 = 0.0f;
+  for (int k = 0; k < 3; k++) {
+    if (p[k] < min[k]) {
+      d2 += (min[k] - p[k]) * (min[k] - p[k]);
+    } else if (p[k] > max[k]) {
+      d2 += (p[k] - max[k]) * (p[k] - max[k]);
+    }
+  }
+  return d2;
+}
+
+static inline GLfloat
+dot3(const GLfloat a[3], const GLfloat b[3]) {
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static inline void
+sub3(GLfloat v[3], const GLfloat a[3], const GLfloat b[3]) {
+  v[0] = a[0] - b[0];
+  v[1] = a[1] - b[1];
+  v[2] = a[2] - b[2];
+}
+
+static inline void
+cross3(GLfloat v[3], const GLfloat a[3], const GLfloat b[3]) {
+  v[0] = a[1] * b[2] - a[2] * b[1];
+  v[1] = a[2] * b[0] - a[0] * b[2];
+  v[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+static inline void
+inverse3(GLfloat v[3], const GLfloat a[3]) {
+  // division by zero gives infinities, which the slab test handles
+  for (int k = 0; k < 3; k++) {
+    v[k] = 1.0f / a[k];
+  }
+}
+
+Bounding_volume_hierarchy::Bounding_volume_hierarchy(void)
+  : _nodes(),
+    _triangles(),
+    _vertices(),
+    _centroids(),
+    _vertex_ids() {}
+
+Bounding_volume_hierarchy::~Bounding_volume_hierarchy(void) {}
+
+void
+Bounding_volume_hierarchy::clear(void) {
+  _nodes.clear();
+  _triangles.clear();
+  _vertices.clear();
+  _vertex_ids.clear();
+}
+
+void
+Bounding_volume_hierarchy::build(const vector<GLfloat>& vertices,
+                                 const vector<GLuint>& vertex_ids) {
+  const unsigned int n = vertex_ids.size() / 3;
+  assert(vertices.size() == 9*n);
+  
+  clear();
+  if (n == 0) return;
+  _vertices = vertices;
+  _vertex_ids = vertex_ids;
+  _triangles.resize(n);
+  _centroids.resize(3*n);
+  for (unsigned int i = 0; i < n; i++) {
+    _triangles[i] = i;
+    for (int k = 0; k < 3; k++) {
+      _centroids[3*i + k] = (_vertices[9*i + k] +
+                             _vertices[9*i + 3 + k] +
+                             _vertices[9*i + 6 + k]) / 3.0f;
+    }
+  }
+  _nodes.reserve(2*n);
+  _nodes.push_back(_Node());
+  _build(0, 0, n, 0);
+  vector<GLfloat>().swap(_centroids);
+}
+
+void
+Bounding_volume_hierarchy::refit(const vector<GLfloat>& vertices,
+                                 const vector<GLuint>& vertex_ids) {
+  assert(vertex_ids.size() == _vertex_ids.size());
+  assert(vertices.size() == _vertices.size());
+  
+  _vertices = vertices;
+  _vertex_ids = vertex_ids;
+  // children always come after their parent
+  for (int i = _nodes.size() - 1; i >= 0; i--) {
+    _Node& node = _nodes[i];
+    if (node.count > 0) {
+      _set_leaf_bounds(node);
+    } else {
+      box_reset(node.min, node.max);
+      box_extend(node.min, node.max, _nodes[i + 1].min, _nodes[i + 1].max);
+      box_extend(node.min, node.max,
+                 _nodes[node.first].min, _nodes[node.first].max);
+    }
+  }
+}
+
+unsigned int
+Bounding_volume_hierarchy::number_of_triangles(void) const {
+  return _triangles.size();
+}
+
+GLuint
+Bounding_volume_hierarchy::vertex_id(unsigned int triangle, int i) const {
+  assert(triangle < _triangles.size() && 0 <= i && i < 3);
+  return _vertex_ids[3*triangle + i];
+}
+
+bool
+Bounding_volume_hierarchy::ray_cast(const GLvecf origin,
+                                    const GLvecf direction,
+                                    unsigned int& triangle,
+                                    GLfloat& t) const {
+  if (_nodes.empty()) return false;
+  
+  GLfloat inverse_direction[3];
+  inverse3(inverse_direction, direction);
+  GLfloat t_min = FLT_MAX;
+  bool is_hit = false;
+  unsigned int stack[STACK_SIZE];
+  unsigned int size = 0;
+  
+  stack[size++] = 0;
+  while (size > 0) {
+    const _Node& node = _nodes[stack[--size]];
+    if (!ray_hits_box(node.min, node.max, origin, inverse_direction, t_min)) {
+      continue;
+    }
+    if (node.count > 0) {
+      for (unsigned int i = node.first; i < node.first + node.count; i++) {
+        GLfloat t_hit;
+        if (_intersect(_triangles[i], origin, direction, t_hit) &&
+            t_hit < t_min) {
+          t_min = t_hit;
+          triangle = _triangles[i];
+          is_hit = true;
+        }
+      }
+    } else {
+      assert(size + 2 <= STACK_SIZE);
+      stack[size++] = node.first;
+      stack[size++] = &node - &_nodes[0] + 1;
+    }
+  }
+  if (is_hit) t = t_min;
+  return is_hit;
+}
+
+bool
+Bounding_volume_hierarchy::is_visible(const GLvecf eye, const GLvecf p,
+                                      GLuint vertex_id) const {
+  if (_nodes.empty()) return true;
+  
+  GLfloat direction[3], inverse_direction[3];
+  sub3(direction, p, eye);
+  inverse3(inverse_direction, direction);
+  unsigned int stack[STACK_SIZE];
+  unsigned int size = 0;
+  
+  stack[size++] = 0;
+  while (size > 0) {
+    const _Node& node = _nodes[stack[--size]];
+    if (!ray_hits_box(node.min, node.max, eye, inverse_direction,
+                      1.0f - SEGMENT_EPSILON)) {
+      continue;
+    }
+    if (node.count > 0) {
+      for (unsigned int i = node.first; i < node.first + node.count; i++) {
+        const unsigned int triangle = _triangles[i];
+        GLfloat t;
+        if (_vertex_ids[3*triangle]     == vertex_id ||
+            _vertex_ids[3*triangle + 1] == vertex_id ||
+            _vertex_ids[3*triangle + 2] == vertex_id) {
+          continue;
+        }
+        if (_intersect(triangle, eye, direction, t) &&
+            t < 1.0f - SEGMENT_EPSILON) {
+          return false;
+        }
+      }
+    } else {
+      assert(size + 2 <= STACK_SIZE);
+      stack[size++] = node.first;
+      stack[size++] = &node - &_nodes[0] + 1;
+    }
+  }
+  return true;
+}
+
+void
+Bounding_volume_hierarchy::are_visible(const GLvecf eye,
+                                       const vector<GLfloat>& points,
+                                       const vector<GLuint>& vertex_ids,
+                                       vector<GLboolean>& is_visible) const {
+  const int n = vertex_ids.size();
+  assert(points.size() == 3*vertex_ids.size());
+  
+  is_visible.resize(n);
+  // queries are independent and the hierarchy is read-only
+#pragma omp parallel for schedule(dynamic, VISIBILITY_CHUNK_SIZE)
+  for (int i = 0; i < n; i++) {
+    is_visible[i] = this->is_visible(eye, &points[3*i], vertex_ids[i]) ?
+                    GL_TRUE : GL_FALSE;
+  }
+}
+
+void
+Bounding_volume_hierarchy::frustum_query(const GLvecf *planes,
+                                         int number_of_planes,
+                                         vector<unsigned int>& triangles)
+  const {
+  triangles.clear();
+  if (_nodes.empty()) return;
+  
+  unsigned int stack[STACK_SIZE];
+  unsigned int size = 0;
+  
+  stack[size++] = 0;
+  while (size > 0) {
+    const _Node& node = _nodes[stack[--size]];
+    bool is_outside = false;
+    for (int j = 0; j < number_of_planes && !is_outside; j++) {
+      // the box corner furthest along the plane normal
+      GLfloat d = planes[j][3];
+      for (int k = 0; k < 3; k++) {
+        d += planes[j][k] * (planes[j][k] > 0.0f ? node.max[k] : node.min[k]);
+      }
+      is_outside = (d < 0.0f);
+    }
+    if (is_outside) continue;
+    if (node.count > 0) {
+      for (unsigned int i = node.first; i < node.first + node.count; i++) {
+        triangles.push_back(_triangles[i]);
+      }
+    } else {
+      assert(size + 2 <= STACK_SIZE);
+      stack[size++] = node.first;
+      stack[size++] = &node - &_nodes[0] + 1;
+    }
+  }
+}
+
+bool
+Bounding_volume_hierarchy::nearest_triangle(const GLvecf p,
+                                            unsigned int& triangle,
+                                            GLvecf closest) const {
+  if (_nodes.empty()) return false;
+  
+  GLfloat d2_min = FLT_MAX;
+  unsigned int stack[STACK_SIZE];
+  unsigned int size = 0;
+  
+  stack[size++] = 0;
+  while (size > 0) {
+    const _Node& node = _nodes[stack[--size]];
+    if (box_squared_distance(node.min, node.max, p) >= d2_min) continue;
+    if (node.count > 0) {
+      for (unsigned int i = node.first; i < node.first + node.count; i++) {
+        GLfloat q[3];
+        GLfloat d2 = _squared_distance(_triangles[i], p, q);
+        if (d2 < d2_min) {
+          d2_min = d2;
+          triangle = _triangles[i];
+          gl_vecf_set(closest, q[0], q[1], q[2], 1.0f);
+        }
+      }
+    } else {
+      // nearest child last, so that it is visited first
+      const unsigned int left = &node - &_nodes[0] + 1;
+      const unsigned int right = node.first;
+      const GLfloat d2_left
+        = box_squared_distance(_nodes[left].min, _nodes[left].max, p);
+      const GLfloat d2_right
+        = box_squared_distance(_nodes[right].min, _nodes[right].max, p);
+      assert(size + 2 <= STACK_SIZE);
+      if (d2_left < d2_right) {
+        stack[size++] = right;
+        stack[size++] = left;
+      } else {
+        stack[size++] = left;
+        stack[size++] = right;
+      }
+    }
+  }
+  return (d2_min < FLT_MAX);
+}
+
+void
+Bounding_volume_hierarchy::_build(unsigned int node, unsigned int begin,
+                                  unsigned int end, int depth) {
+  /*
+   * Ingo Wald, On Fast Construction of SAH-based Bounding Volume
+   * Hierarchies, Proceedings of the IEEE Symposium on Interactive Ray
+   * Tracing, pp. 33-40, 2007.
+   *
+   * Triangles are binned along the largest axis of their centroid bounds,
+   * and split between the two bins minimizing the surface area heuristic.
+   */
+  const unsigned int count = end - begin;
+  _nodes[node].first = begin;
+  _nodes[node].count = count;
+  _set_leaf_bounds(_nodes[node]);
+  if (count <= MAX_LEAF_SIZE || depth == MAX_DEPTH - 1) return;
+  
+  GLfloat cmin[3], cmax[3];
+  box_reset(cmin, cmax);
+  for (unsigned int i = begin; i < end; i++) {
+    const GLfloat *c = &_centroids[3*_triangles[i]];
+    box_extend(cmin, cmax, c, c);
+  }
+  int axis = 0;
+  for (int k = 1; k < 3; k++) {
+    if (cmax[k] - cmin[k] > cmax[axis] - cmin[axis]) axis = k;
+  }
+  const GLfloat extent = cmax[axis] - cmin[axis];
+  if (extent <= 0.0f) return; // coincident centroids
+  
+  unsigned int bin_counts[NUMBER_OF_BINS];
+  GLfloat bin_min[NUMBER_OF_BINS][3], bin_max[NUMBER_OF_BINS][3];
+  const GLfloat scale = NUMBER_OF_BINS * (1.0f - FLT_EPSILON) / extent;
+  for (int b = 0; b < NUMBER_OF_BINS; b++) {
+    bin_counts[b] = 0;
+    box_reset(bin_min[b], bin_max[b]);
+  }
+  for (unsigned int i = begin; i < end; i++) {
+    const unsigned int triangle = _triangles[i];
+    int b = (int) ((_centroids[3*triangle + axis] - cmin[axis]) * scale);
+    b = min(max(b, 0), NUMBER_OF_BINS - 1);
+    bin_counts[b]++;
+    for (int j = 0; j < 3; j++) {
+      const GLfloat *v = &_vertices[9*triangle + 3*j];
+      box_extend(bin_min[b], bin_max[b], v, v);
+    }
+  }
+  
+  // right to left sweep, then left to right sweep evaluating the splits
+  GLfloat right_areas[NUMBER_OF_BINS];
+  unsigned int right_counts[NUMBER_OF_BINS];
+  GLfloat min_[3], max_[3];
+  box_reset(min_, max_);
+  unsigned int n = 0;
+  for (int b = NUMBER_OF_BINS - 1; b > 0; b--) {
+    box_extend(min_, max_, bin_min[b], bin_max[b]);
+    n += bin_counts[b];
+    right_counts[b] = n;
+    right_areas[b] = (n > 0) ? box_area(min_, max_) : 0.0f;
+  }
+  int best_split = -1;
+  GLfloat best_cost = FLT_MAX;
+  box_reset(min_, max_);
+  n = 0;
+  for (int b = 0; b < NUMBER_OF_BINS - 1; b++) {
+    box_extend(min_, max_, bin_min[b], bin_max[b]);
+    n += bin_counts[b];
+    if (n == 0 || right_counts[b + 1] == 0) continue;
+    GLfloat cost = box_area(min_, max_) * n
+                 + right_areas[b + 1] * right_counts[b + 1];
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_split = b;
+    }
+  }
+  if (best_split < 0) return;
+  
+  unsigned int middle = begin;
+  for (unsigned int i = begin; i < end; i++) {
+    const unsigned int triangle = _triangles[i];
+    int b = (int) ((_centroids[3*triangle + axis] - cmin[axis]) * scale);
+    if (min(max(b, 0), NUMBER_OF_BINS - 1) <= best_split) {
+      swap(_triangles[i], _triangles[middle++]);
+    }
+  }
+  assert(begin < middle && middle < end);
+  
+  const unsigned int left = _nodes.size();
+  assert(left == node + 1);
+  _nodes[node].count = 0;
+  _nodes.push_back(_Node());
+  _build(left, begin, middle, depth + 1);
+  const unsigned int right = _nodes.size();
+  _nodes[node].first = right;
+  _nodes.push_back(_Node());
+  _build(right, middle, end, depth + 1);
+}
+
+void
+Bounding_volume_hierarchy::_set_leaf_bounds(_Node& node) const {
+  box_reset(node.min, node.max);
+  for (unsigned int i = node.first; i < node.first + node.count; i++) {
+    for (int j = 0; j < 3; j++) {
+      const GLfloat *v = &_vertices[9*_triangles[i] + 3*j];
+      box_extend(node.min, node.max, v, v);
+    }
+  }
+}
+
+bool
+Bounding_volume_hierarchy::_intersect(unsigned int triangle,
+                                      const GLfloat origin[3],
+                                      const GLfloat direction[3],
+                                      GLfloat& t) const {
+  /*
+   * Tomas Moller and Ben Trumbore, Fast, Minimum Storage Ray-Triangle
+   * Intersection, Journal of Graphics Tools, 2(1), pp. 21-28, 1997.
+   */
+  const GLfloat *v0 = &_vertices[9*triangle];
+  const GLfloat *v1 = v0 + 3;
+  const GLfloat *v2 = v0 + 6;
+  GLfloat e1[3], e2[3], p[3], s[3], q[3];
+  
+  sub3(e1, v1, v0);
+  sub3(e2, v2, v0);
+  cross3(p, direction, e2);
+  const GLfloat det = dot3(e1, p);
+  if (det == 0.0f) return false; // ray parallel to triangle
+  const GLfloat inverse_det = 1.0f / det;
+  sub3(s, origin, v0);
+  const GLfloat u = dot3(s, p) * inverse_det;
+  if (u < 0.0f || u > 1.0f) return false;
+  cross3(q, s, e1);
+  const GLfloat v = dot3(direction, q) * inverse_det;
+  if (v < 0.0f || u + v > 1.0f) return false;
+  t = dot3(e2, q) * inverse_det;
+  return (t > 0.0f);
+}
+
+GLfloat
+Bounding_volume_hierarchy::_squared_distance(unsigned int triangle,
+                                             const GLfloat p[3],
+                                             GLfloat closest[3]) const {
+  /*
+   * Christer Ericson, Real-Time Collision Detection, Morgan Kaufmann,
+   * pp. 141-142, 2005.
+   *
+   * The Voronoi regions of the vertices and edges are tested in turn,
+   * the face region being the remaining case.
+   */
+  const GLfloat *a = &_vertices[9*triangle];
+  const GLfloat *b = a + 3;
+  const GLfloat *c = a + 6;
+  GLfloat ab[3], ac[3], ap[3], bp[3], cp[3], d[3];
+  GLfloat s = 0.0f, t = 0.0f;
+  
+  sub3(ab, b, a);
+  sub3(ac, c, a);
+  sub3(ap, p, a);
+  sub3(bp, p, b);
+  sub3(cp, p, c);
+  const GLfloat d1 = dot3(ab, ap), d2 = dot3(ac, ap);
+  const GLfloat d3 = dot3(ab, bp), d4 = dot3(ac, bp);
+  const GLfloat d5 = dot3(ab, cp), d6 = dot3(ac, cp);
+  const GLfloat vc = d1 * d4 - d3 * d2;
+  const GLfloat vb = d5 * d2 - d1 * d6;
+  const GLfloat va = d3 * d6 - d5 * d4;
+  if (d1 <= 0.0f && d2 <= 0.0f) {
+    // vertex a
+  } else if (d3 >= 0.0f && d4 <= d3) {
+    s = 1.0f; // vertex b
+  } else if (d6 >= 0.0f && d5 <= d6) {
+    t = 1.0f; // vertex c
+  } else if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+    s = d1 / (d1 - d3); // edge ab
+  } else if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+    t = d2 / (d2 - d6); // edge ac
+  } else if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+    t = (d4 - d3) / ((d4 - d3) + (d5 - d6)); // edge bc
+    s = 1.0f - t;
+  } else {
+    const GLfloat denominator = 1.0f / (va + vb + vc);
+    s = vb * denominator;
+    t = vc * denominator;
+  }
+  for (int k = 0; k < 3; k++) {
+    closest[k] = a[k] + s * ab[k] + t * ac[k];
+  }
+  sub3(d, p, closest);
+  return dot3(d, d);
+}
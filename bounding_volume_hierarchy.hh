@@ -0,0 +1,66 @@
+#ifndef __BOUNDING_VOLUME_HIERARCHY_HH__
+#define __BOUNDING_VOLUME_HIERARCHY_HH__
+
+#include <vector>
+#include <opengl_utils.h>
+
+/*
+ * Bounding volume hierarchy over a triangle soup, used to answer
+ * visibility and picking queries on the surface without OpenGL round-trips.
+ * Triangles are given by 9 vertex coordinates and 3 vertex IDs each, and
+ * are referred to by their rank in these arrays.
+ */
+class Bounding_volume_hierarchy {
+public:
+  Bounding_volume_hierarchy(void);
+  ~Bounding_volume_hierarchy(void);
+  void clear(void);
+  // surface area heuristic build
+  void build(const std::vector<GLfloat>& vertices,
+             const std::vector<GLuint>& vertex_ids);
+  // bounds update only, the same number of triangles is expected
+  void refit(const std::vector<GLfloat>& vertices,
+             const std::vector<GLuint>& vertex_ids);
+  unsigned int number_of_triangles(void) const;
+  GLuint vertex_id(unsigned int triangle, int i) const;
+  // nearest triangle hit by origin + t * direction, with t > 0
+  bool ray_cast(const GLvecf origin, const GLvecf direction,
+                unsigned int& triangle, GLfloat& t) const;
+  // p is visible when no triangle crosses segment [eye, p], the triangles
+  // incident to the vertex with ID vertex_id aside
+  bool is_visible(const GLvecf eye, const GLvecf p, GLuint vertex_id) const;
+  // points are given by 3 coordinates each
+  void are_visible(const GLvecf eye, const std::vector<GLfloat>& points,
+                   const std::vector<GLuint>& vertex_ids,
+                   std::vector<GLboolean>& is_visible) const;
+  // triangles whose bounding boxes are on the positive side of all planes,
+  // a plane (a, b, c, d) being a * x + b * y + c * z + d = 0
+  void frustum_query(const GLvecf *planes, int number_of_planes,
+                     std::vector<unsigned int>& triangles) const;
+  bool nearest_triangle(const GLvecf p, unsigned int& triangle,
+                        GLvecf closest) const;
+  
+private:
+  // inner nodes have their left child next to them, and their right child
+  // at index first; leaves hold triangles [first, first + count)
+  typedef struct {
+    GLfloat min[3], max[3];
+    unsigned int first, count;
+  } _Node;
+  
+  void _build(unsigned int node, unsigned int begin, unsigned int end,
+              int depth);
+  void _set_leaf_bounds(_Node& node) const;
+  bool _intersect(unsigned int triangle,
+                  const GLfloat origin[3], const GLfloat direction[3],
+                  GLfloat& t) const;
+  GLfloat _squared_distance(unsigned int triangle, const GLfloat p[3],
+                            GLfloat closest[3]) const;
+  
+  std::vector<_Node> _nodes;
+  std::vector<unsigned int> _triangles;
+  std::vector<GLfloat> _vertices, _centroids;
+  std::vector<GLuint> _vertex_ids;
+};
+
+#endif // __BOUNDING_VOLUME_HIERARCHY_HH__
@@ -1,4 +1,4 @@
-#include "tool_texture.hh"
+#include "canvas.hh"
 #include "brush_tool.hh"
 
 // FIXME: Problems encountered with linuxwacom under mdk-9.2
@@ -14,23 +14,39 @@ static const gdouble TILT_SIZE_MAX     = 14.0;
 static const gdouble SIZE_MIN =  6.0;
 static const gdouble SIZE_MAX = 12.0;
 #endif
+static const GLfloat STAMP_SPACING = 0.5f; // of the stamp radius
 
 Brush_tool::Brush_tool(Toolbox *toolbox,
-                       GLboolean (*display_list_cb)(void *, GLboolean))
-  : Base(toolbox, display_list_cb) {
+                       GLubyte stencil_value, GLubyte stencil_mask)
+  : Base(toolbox),
+    _stencil_value(stencil_value),
+    _stencil_mask(stencil_mask) {
   vec2f_eq(_point, VEC2F_NULL);
   _size = 0.0f;
   gl_vecf_eq(_color, GL_PURE_BLACK);
+  _sample.x = _sample.y = 0.0;
+  _sample.pressure = _sample.xtilt = _sample.ytilt = 0.0;
 }
 
 Brush_tool::~Brush_tool(void) {}
 
+const char *
+Brush_tool::name(void) const {
+  return "brush";
+}
+
 void
 Brush_tool::start_drawing_pixels(GdkInputSource source,
                                  gdouble x, gdouble y, gdouble pressure,
                                  gdouble xtilt, gdouble ytilt) {
   gl_vecf_eq(_color, _toolbox->foreground_color());
-  draw_pixels(source, x, y, pressure, xtilt, ytilt);
+  _sample.x = x;
+  _sample.y = y;
+  _sample.pressure = pressure;
+  _sample.xtilt = xtilt;
+  _sample.ytilt = ytilt;
+  _stamp(source, _sample);
+  gl_veci_eq(_drawport, _toolbox->canvas()->drawn_pixels());
 }
 
 void
@@ -40,25 +56,72 @@ void
 Brush_tool::draw_pixels(GdkInputSource source,
                         gdouble x, gdouble y, gdouble pressure,
                         gdouble xtilt, gdouble ytilt) {
-  vec2f_set(_point, x, y);
-  
-  glPushAttrib(GL_CURRENT_BIT | GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT |
-               GL_TEXTURE_BIT);
+  Sample sample;
+  sample.x = x;
+  sample.y = y;
+  sample.pressure = pressure;
+  sample.xtilt = xtilt;
+  sample.ytilt = ytilt;
+  gl_veci_eq(_drawport, GL_VECI_NULL);
+  _draw_to(source, sample);
+}
+
+void
+Brush_tool::draw_samples(GdkInputSource source,
+                         const vector<Sample>& samples) {
+  gl_veci_eq(_drawport, GL_VECI_NULL);
+  for (vector<Sample>::const_iterator si = samples.begin();
+       si != samples.end(); si++) {
+    _draw_to(source, *si);
+  }
+}
+
+void
+Brush_tool::_draw_to(GdkInputSource source, const Sample& sample) {
+  // a single stamp when the samples are closer than the spacing
+  GLfloat spacing = scalf_max(STAMP_SPACING * _size, 1.0f);
+  gdouble dx = sample.x - _sample.x, dy = sample.y - _sample.y;
+  GLfloat distance = sqrt(dx*dx + dy*dy);
+  int n = scali_max((int) ceil(distance / spacing), 1);
+  for (int k = 1; k <= n; k++) {
+    gdouble t = (gdouble) k / (gdouble) n;
+    Sample s;
+    s.x = _sample.x + t * (sample.x - _sample.x);
+    s.y = _sample.y + t * (sample.y - _sample.y);
+    s.pressure = _sample.pressure + t * (sample.pressure - _sample.pressure);
+    s.xtilt = _sample.xtilt + t * (sample.xtilt - _sample.xtilt);
+    s.ytilt = _sample.ytilt + t * (sample.ytilt - _sample.ytilt);
+    _stamp(source, s);
+    _unite_ports(_drawport, _toolbox->canvas()->drawn_pixels());
+  }
+  _sample = sample;
+}
+
+void
+Brush_tool::_stamp(GdkInputSource source, const Sample& sample) {
+  vec2f_set(_point, sample.x, sample.y);
+  Canvas::Paint paint;
+  gl_vecf_eq(paint.color, _color);
+  paint.stencil_value = _stencil_value;
+  paint.stencil_mask = _stencil_mask;
+  GLfloat tilt[2] = {0.0f, 0.0f};
   
   switch (source) {
   case GDK_SOURCE_MOUSE:
     _size = DEFAULT_SIZE;
-    glColor4fv(_color);
     break;
   case GDK_SOURCE_PEN:
   case GDK_SOURCE_ERASER:
 #if LINUXWACOM_RH_8_0
-    _size = scald_max(PRESSURE_SIZE_MAX * pressure,
-                      TILT_SIZE_MAX * sqrt(xtilt*xtilt + ytilt*ytilt));
+    _size = scald_max(PRESSURE_SIZE_MAX * sample.pressure,
+                      TILT_SIZE_MAX * sqrt(sample.xtilt*sample.xtilt +
+                                           sample.ytilt*sample.ytilt));
 #else
-    _size = scald_max(SIZE_MIN, SIZE_MAX * pressure);
+    _size = scald_max(SIZE_MIN, SIZE_MAX * sample.pressure);
 #endif
-    glColor4f(_color[0], _color[1], _color[2], _color[3] * pressure);
+    paint.color[3] = _color[3] * sample.pressure;
+    tilt[0] = sample.xtilt;
+    tilt[1] = sample.ytilt;
     break;
   case GDK_SOURCE_CURSOR:
     cerr << "Warning: cursor is an unknown input device source!" << endl;
@@ -67,40 +130,7 @@ Brush_tool::draw_pixels(GdkInputSource source,
     assert(false);
     break;
   }
-  _toolbox->tool_texture()->bind();
-  gl_list_call(_list);
-  glBegin(GL_QUADS);
-  glTexCoord2i(0, 0);
-  glVertex2f(_point[0] - _size, _point[1] - _size);
-  glTexCoord2i(1, 0);
-  glVertex2f(_point[0] + _size, _point[1] - _size);
-  glTexCoord2i(1, 1);
-  glVertex2f(_point[0] + _size, _point[1] + _size);
-  glTexCoord2i(0, 1);
-  glVertex2f(_point[0] - _size, _point[1] + _size);
-  glEnd();
-  
-  glPopAttrib();
   
-  gl_veci_set(_drawport,
-              (GLint) (_point[0] - _size) - 1,
-              (GLint) (_point[1] - _size) - 1,
-              (GLint) (2.0f * _size) + 1 + 2,
-              (GLint) (2.0f * _size) + 1 + 2);
-  // our safe radius is equal to 1 (-1 bottom, +2 top)
-}
-
-GLboolean
-Brush_tool::_display_list_cb(void *data, GLboolean test_proxy) {
-  if (test_proxy) return GL_TRUE;
-  glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_FALSE);
-  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-  glStencilMask(0x1);
-  glStencilFunc(GL_ALWAYS, 0x1, 0x1);
-  glStencilOp(GL_REPLACE, GL_REPLACE, GL_REPLACE);
-  glAlphaFunc(GL_NOTEQUAL, 0);
-  glEnable(GL_BLEND);
-  glEnable(GL_STENCIL_TEST);
-  glEnable(GL_ALPHA_TEST);
-  return GL_TRUE;
+  _toolbox->canvas()->stamp(_point[0], _point[1], _size,
+                            tilt[0], tilt[1], paint);
 }
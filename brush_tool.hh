@@ -7,9 +7,10 @@
 
 class Brush_tool : public Tool {
 public:
-  Brush_tool(Toolbox *toolbox, GLboolean (*display_list_cb)(void *, GLboolean)
-               = _display_list_cb);
+  Brush_tool(Toolbox *toolbox,
+             GLubyte stencil_value = 0x1, GLubyte stencil_mask = 0x1);
   virtual ~Brush_tool(void);
+  virtual const char *name(void) const;
   virtual void start_drawing_pixels(GdkInputSource source,
                                     gdouble x, gdouble y, gdouble pressure,
                                     gdouble xtilt, gdouble ytilt);
@@ -17,6 +18,8 @@ public:
   virtual void draw_pixels(GdkInputSource source,
                            gdouble x, gdouble y, gdouble pressure,
                            gdouble xtilt, gdouble ytilt);
+  virtual void draw_samples(GdkInputSource source,
+                            const std::vector<Sample>& samples);
   
 protected:
   Vec2f _point;
@@ -26,7 +29,13 @@ protected:
 private:
   typedef Tool Base;
   
-  static GLboolean _display_list_cb(void *data, GLboolean test_proxy);
+  // stamps spaced from the last sample up to this one, pressure and tilt
+  // being interpolated along the way
+  void _draw_to(GdkInputSource source, const Sample& sample);
+  void _stamp(GdkInputSource source, const Sample& sample);
+  
+  Sample _sample;
+  GLubyte _stencil_value, _stencil_mask;
 };
 
 #endif // __BRUSH_TOOL_HH__
@@ -7,6 +7,7 @@ class Burnisher_tool : public Brush_tool {
 public:
   Burnisher_tool(Toolbox *toolbox);
   virtual ~Burnisher_tool(void);
+  virtual const char *name(void) const;
   virtual void start_recording_path(GdkInputSource source,
                                     gdouble x, gdouble y, gdouble pressure,
                                     gdouble xtilt, gdouble ytilt);
@@ -20,8 +21,6 @@ public:
   
 private:
   typedef Brush_tool Base;
-  
-  static GLboolean _display_list_cb(void *data, GLboolean test_proxy);
 };
 
 #endif // __BURNISHER_TOOL_HH__
@@ -0,0 +1,529 @@
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#include "canvas.hh"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2 1
+#include <emmintrin.h>
+#else
+#define USE_SSE2 0
+#endif
+
+using namespace std;
+
+static const int SUBPIXELS = 256;
+static const int FORM_SHIFT = 24;
+static const gint64 FORM_ONE = 1 << 16;
+static const unsigned int STAMP_PROFILE_SIZE = 1024;
+// Rationale:
+// the footprint of the former tool texture, a 64 texels wide gradient
+// from its center to 30 texels, flat up to 2 texels
+static const GLfloat STAMP_OUTER_RADIUS = 30.0f / 32.0f;
+static const GLfloat STAMP_INNER_RADIUS = 2.0f / 30.0f;
+static const GLfloat TILT_STRETCH = 0.5f;
+
+static GLubyte stamp_profile[STAMP_PROFILE_SIZE];
+static bool is_stamp_profile_set = false;
+
+static void
+set_stamp_profile(void) {
+  for (unsigned int i = 0; i < STAMP_PROFILE_SIZE; i++) {
+    double radius = sqrt((i + 0.5) / (double) STAMP_PROFILE_SIZE);
+    double alpha = (1.0 - radius) / (1.0 - STAMP_INNER_RADIUS);
+    alpha = (alpha < 0.0) ? 0.0 : ((alpha > 1.0) ? 1.0 : alpha);
+    stamp_profile[i] = (GLubyte) floor(alpha * GL_UBYTE_MAX + 0.5);
+  }
+  is_stamp_profile_set = true;
+}
+
+static gint64
+to_fixed(GLfloat v) {
+  return (gint64) floor(v * SUBPIXELS + 0.5);
+}
+
+static GLubyte
+to_ubyte(GLfloat v) {
+  return (GLubyte) floor(scalf_clamp(v, 0.0f, 1.0f) * GL_UBYTE_MAX + 0.5f);
+}
+
+static gint64
+isqrt(gint64 n) {
+  guint64 x = (guint64) n, root = 0, bit = ((guint64) 1) << 62;
+  while (bit > x) bit >>= 2;
+  while (bit != 0) {
+    if (x >= root + bit) {
+      x -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (gint64) root;
+}
+
+// dst = (dst * (255 - alpha) + src * alpha) / 255, rounded, on the color
+// channels only
+static void
+blend_pixels(GLubyte *dst, const GLubyte *src, const GLubyte *alpha, int n) {
+  int k = 0;
+#if USE_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i ones = _mm_set1_epi16(255);
+  const __m128i half = _mm_set1_epi16(128);
+  const __m128i color_mask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+  for (; k + 4 <= n; k += 4) {
+    guint32 alpha4;
+    memcpy(&alpha4, alpha + k, 4);
+    if (alpha4 == 0) continue;
+    __m128i a = _mm_cvtsi32_si128((int) alpha4);
+    a = _mm_unpacklo_epi8(a, a);
+    a = _mm_unpacklo_epi16(a, a);
+    __m128i a_lo = _mm_and_si128(_mm_unpacklo_epi8(a, zero), color_mask);
+    __m128i a_hi = _mm_and_si128(_mm_unpackhi_epi8(a, zero), color_mask);
+    __m128i d = _mm_loadu_si128((const __m128i *) (dst + 4 * k));
+    __m128i s = _mm_loadu_si128((const __m128i *) (src + 4 * k));
+    __m128i v_lo
+      = _mm_add_epi16(
+          _mm_add_epi16(
+            _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero),
+                            _mm_sub_epi16(ones, a_lo)),
+            _mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), a_lo)),
+          half);
+    __m128i v_hi
+      = _mm_add_epi16(
+          _mm_add_epi16(
+            _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero),
+                            _mm_sub_epi16(ones, a_hi)),
+            _mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), a_hi)),
+          half);
+    v_lo = _mm_srli_epi16(_mm_add_epi16(v_lo, _mm_srli_epi16(v_lo, 8)), 8);
+    v_hi = _mm_srli_epi16(_mm_add_epi16(v_hi, _mm_srli_epi16(v_hi, 8)), 8);
+    _mm_storeu_si128((__m128i *) (dst + 4 * k), _mm_packus_epi16(v_lo, v_hi));
+  }
+#endif
+  for (; k < n; k++) {
+    unsigned int a = alpha[k];
+    if (a == 0) continue;
+    for (int c = 0; c < 3; c++) {
+      unsigned int v = dst[4 * k + c] * (255 - a) + src[4 * k + c] * a + 128;
+      dst[4 * k + c] = (GLubyte) ((v + (v >> 8)) >> 8);
+    }
+  }
+}
+
+// as the stencil test of the tools, passing wherever alpha is not null
+static void
+blend_stencil(GLubyte *dst, const GLubyte *alpha, int n,
+              GLubyte value, GLubyte mask) {
+  value &= mask;
+  int k = 0;
+#if USE_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i values = _mm_set1_epi8((char) value);
+  const __m128i keep = _mm_set1_epi8((char) ~mask);
+  for (; k + 16 <= n; k += 16) {
+    __m128i is_kept
+      = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (alpha + k)), zero);
+    __m128i d = _mm_loadu_si128((const __m128i *) (dst + k));
+    __m128i s = _mm_or_si128(_mm_and_si128(d, keep), values);
+    _mm_storeu_si128((__m128i *) (dst + k),
+                     _mm_or_si128(_mm_and_si128(is_kept, d),
+                                  _mm_andnot_si128(is_kept, s)));
+  }
+#endif
+  for (; k < n; k++) {
+    if (alpha[k] != 0) {
+      dst[k] = (GLubyte) ((dst[k] & ~mask) | value);
+    }
+  }
+}
+
+Canvas::Canvas(void)
+  : _number_of_columns(0),
+    _number_of_rows(0),
+    _tiles(),
+    _number_of_tiles(0),
+    _is_dirty(false),
+    _coverage(),
+    _colors() {
+  if (!is_stamp_profile_set) {
+    set_stamp_profile();
+  }
+  gl_veci_eq(_viewport, GL_VECI_NULL);
+  gl_veci_eq(_dirty, GL_VECI_NULL);
+  gl_veci_eq(_drawport, GL_VECI_NULL);
+  _background[0] = _background[1] = _background[2] = _background[3] = 0;
+  _stamp_center[0] = _stamp_center[1] = 0;
+  _stamp_form[0] = _stamp_form[1] = _stamp_form[2] = 0;
+}
+
+Canvas::~Canvas(void) {
+  clear();
+}
+
+void
+Canvas::reset(const GLveci viewport, const GLvecf background_color) {
+  clear();
+  gl_veci_eq(_viewport, viewport);
+  _number_of_columns = (viewport[2] + TILE_SIZE - 1) / TILE_SIZE;
+  _number_of_rows = (viewport[3] + TILE_SIZE - 1) / TILE_SIZE;
+  _tiles.assign(_number_of_columns * _number_of_rows, (_Tile *) NULL);
+  for (int c = 0; c < 4; c++) {
+    _background[c] = to_ubyte(background_color[c]);
+  }
+}
+
+void
+Canvas::clear(void) {
+  for (vector<_Tile *>::iterator ti = _tiles.begin(); ti != _tiles.end();
+       ti++) {
+    if (*ti != NULL) {
+      delete *ti;
+    }
+  }
+  _tiles.clear();
+  _number_of_tiles = 0;
+  _is_dirty = false;
+  gl_veci_eq(_drawport, GL_VECI_NULL);
+}
+
+void
+Canvas::read(const GLveci port) {
+  GLveci quadi;
+  gl_veci_set(quadi, port[0], port[1], port[0] + port[2], port[1] + port[3]);
+  if (!_clip(quadi)) {
+    return;
+  }
+  glPushAttrib(GL_PIXEL_MODE_BIT);
+  glPushClientAttrib(GL_CLIENT_PIXEL_STORE_BIT);
+  glReadBuffer(GL_BACK);
+  glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  glPixelStorei(GL_PACK_ROW_LENGTH, TILE_SIZE);
+  for (int j = (quadi[1] - _viewport[1]) / TILE_SIZE;
+       j <= (quadi[3] - 1 - _viewport[1]) / TILE_SIZE; j++) {
+    for (int i = (quadi[0] - _viewport[0]) / TILE_SIZE;
+         i <= (quadi[2] - 1 - _viewport[0]) / TILE_SIZE; i++) {
+      GLint x = _viewport[0] + i * TILE_SIZE, y = _viewport[1] + j * TILE_SIZE;
+      GLint x0 = scali_max(quadi[0], x), y0 = scali_max(quadi[1], y);
+      GLint x1 = scali_min(quadi[2], x + TILE_SIZE);
+      GLint y1 = scali_min(quadi[3], y + TILE_SIZE);
+      glPixelStorei(GL_PACK_SKIP_PIXELS, x0 - x);
+      glPixelStorei(GL_PACK_SKIP_ROWS, y0 - y);
+      glReadPixels(x0, y0, x1 - x0, y1 - y0, GL_RGBA, GL_UNSIGNED_BYTE,
+                   _tile(i, j)->pixels);
+    }
+  }
+  glPopClientAttrib();
+  glPopAttrib();
+}
+
+void
+Canvas::draw(void) {
+  if (!_is_dirty) {
+    return;
+  }
+  _is_dirty = false;
+  
+  glPushAttrib(GL_CURRENT_BIT | GL_ENABLE_BIT | GL_PIXEL_MODE_BIT |
+               GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+  glPushClientAttrib(GL_CLIENT_PIXEL_STORE_BIT);
+  
+  glDrawBuffer(GL_BACK);
+  glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_FALSE);
+  glStencilMask(STENCIL_MASK);
+  glDisable(GL_BLEND);
+  glDisable(GL_ALPHA_TEST);
+  glDisable(GL_STENCIL_TEST);
+  glDisable(GL_DEPTH_TEST);
+  glDisable(GL_TEXTURE_2D);
+  glDisable(GL_COLOR_TABLE);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glPixelStorei(GL_UNPACK_ROW_LENGTH, TILE_SIZE);
+  for (int j = (_dirty[1] - _viewport[1]) / TILE_SIZE;
+       j <= (_dirty[3] - 1 - _viewport[1]) / TILE_SIZE; j++) {
+    for (int i = (_dirty[0] - _viewport[0]) / TILE_SIZE;
+         i <= (_dirty[2] - 1 - _viewport[0]) / TILE_SIZE; i++) {
+      const _Tile *tile = _tile(i, j);
+      if (tile == NULL) continue;
+      GLint x = _viewport[0] + i * TILE_SIZE, y = _viewport[1] + j * TILE_SIZE;
+      GLint x0 = scali_max(_dirty[0], x), y0 = scali_max(_dirty[1], y);
+      GLint x1 = scali_min(_dirty[2], x + TILE_SIZE);
+      GLint y1 = scali_min(_dirty[3], y + TILE_SIZE);
+      glPixelStorei(GL_UNPACK_SKIP_PIXELS, x0 - x);
+      glPixelStorei(GL_UNPACK_SKIP_ROWS, y0 - y);
+      glRasterPos2i(x0, y0);
+      glDrawPixels(x1 - x0, y1 - y0, GL_RGBA, GL_UNSIGNED_BYTE,
+                   tile->pixels);
+      glDrawPixels(x1 - x0, y1 - y0, GL_STENCIL_INDEX, GL_UNSIGNED_BYTE,
+                   tile->stencil);
+    }
+  }
+  
+  glPopClientAttrib();
+  glPopAttrib();
+}
+
+void
+Canvas::stamp(GLfloat x, GLfloat y, GLfloat radius,
+              GLfloat xtilt, GLfloat ytilt, const Paint& paint) {
+  GLfloat tilt = sqrt(xtilt * xtilt + ytilt * ytilt);
+  GLfloat xaxis = 1.0f, yaxis = 0.0f;
+  if (tilt > 0.0f) {
+    // window rows go up
+    xaxis = xtilt / tilt;
+    yaxis = -ytilt / tilt;
+  }
+  GLfloat radius_across = radius * STAMP_OUTER_RADIUS;
+  GLfloat radius_along
+    = radius_across * (1.0f + TILT_STRETCH * scalf_min(tilt, 1.0f));
+  GLfloat xextent = sqrt(radius_along * radius_along * xaxis * xaxis +
+                         radius_across * radius_across * yaxis * yaxis);
+  GLfloat yextent = sqrt(radius_along * radius_along * yaxis * yaxis +
+                         radius_across * radius_across * xaxis * xaxis);
+  GLveci quadi;
+  gl_veci_set(quadi,
+              (GLint) floor(x - xextent),
+              (GLint) floor(y - yextent),
+              (GLint) floor(x + xextent) + 1,
+              (GLint) floor(y + yextent) + 1);
+  if (radius_across <= 0.0f || !_begin_stroke(quadi)) {
+    return;
+  }
+  _set_stamp(x, y, radius_along, radius_across, xaxis, yaxis);
+  
+  _colors.resize(4 * (quadi[2] - quadi[0]));
+  for (unsigned int k = 0; k < _colors.size(); k++) {
+    _colors[k] = to_ubyte(paint.color[k % 4]);
+  }
+  for (GLint j = quadi[1]; j < quadi[3]; j++) {
+    _stamp_coverage(quadi[0], quadi[2], j, _coverage);
+    _blend(quadi[0], quadi[2], j, _coverage, &_colors[0], paint);
+  }
+}
+
+void
+Canvas::segment(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2,
+                GLfloat half_width, const Paint& paint) {
+  GLveci quadi;
+  gl_veci_set(quadi,
+              (GLint) floor(scalf_min(x1, x2) - half_width) - 1,
+              (GLint) floor(scalf_min(y1, y2) - half_width) - 1,
+              (GLint) floor(scalf_max(x1, x2) + half_width) + 2,
+              (GLint) floor(scalf_max(y1, y2) + half_width) + 2);
+  gint64 width = to_fixed(half_width);
+  if (width <= 0 || !_begin_stroke(quadi)) {
+    return;
+  }
+  
+  // thin segments cover their pixels partly, as smooth lines do
+  gint64 coverage_max = scali_min(255, (GLint) (2 * width * 255 / SUBPIXELS));
+  gint64 p1[2] = {to_fixed(x1), to_fixed(y1)};
+  gint64 p2[2] = {to_fixed(x2), to_fixed(y2)};
+  gint64 v[2] = {p2[0] - p1[0], p2[1] - p1[1]};
+  gint64 vv = v[0] * v[0] + v[1] * v[1];
+  gint64 length = isqrt(vv);
+  _colors.resize(4 * (quadi[2] - quadi[0]));
+  for (unsigned int k = 0; k < _colors.size(); k++) {
+    _colors[k] = to_ubyte(paint.color[k % 4]);
+  }
+  _coverage.resize(quadi[2] - quadi[0]);
+  for (GLint j = quadi[1]; j < quadi[3]; j++) {
+    gint64 uy = (gint64) j * SUBPIXELS + SUBPIXELS / 2 - p1[1];
+    for (GLint i = quadi[0]; i < quadi[2]; i++) {
+      gint64 ux = (gint64) i * SUBPIXELS + SUBPIXELS / 2 - p1[0];
+      gint64 uv = ux * v[0] + uy * v[1];
+      gint64 distance;
+      if (vv == 0 || uv <= 0) {
+        distance = isqrt(ux * ux + uy * uy);
+      } else if (uv >= vv) {
+        gint64 wx = ux - v[0], wy = uy - v[1];
+        distance = isqrt(wx * wx + wy * wy);
+      } else {
+        gint64 cross = ux * v[1] - uy * v[0];
+        distance = ((cross < 0) ? -cross : cross) / length;
+      }
+      gint64 coverage
+        = (width + SUBPIXELS / 2 - distance) * 255 / SUBPIXELS;
+      coverage = (coverage < 0) ? 0
+        : ((coverage > coverage_max) ? coverage_max : coverage);
+      _coverage[i - quadi[0]] = (GLubyte) coverage;
+    }
+    _blend(quadi[0], quadi[2], j, _coverage, &_colors[0], paint);
+  }
+}
+
+void
+Canvas::pick_up(const GLveci port, vector<GLubyte>& pixels) const {
+  pixels.resize(4 * port[2] * port[3]);
+  GLveci quadi;
+  gl_veci_set(quadi, port[0], port[1], port[0] + port[2], port[1] + port[3]);
+  if (!_clip(quadi)) {
+    return;
+  }
+  for (GLint j = quadi[1]; j < quadi[3]; j++) {
+    for (GLint i = quadi[0]; i < quadi[2]; i++) {
+      GLint x = i - _viewport[0], y = j - _viewport[1];
+      const _Tile *tile = _tile(x / TILE_SIZE, y / TILE_SIZE);
+      const GLubyte *pixel = (tile == NULL) ? _background
+        : &tile->pixels[4 * ((y % TILE_SIZE) * TILE_SIZE + x % TILE_SIZE)];
+      memcpy(&pixels[4 * ((j - port[1]) * port[2] + i - port[0])], pixel, 4);
+    }
+  }
+}
+
+void
+Canvas::smudge(const GLveci port, const vector<GLubyte>& pixels,
+               const Paint& paint) {
+  assert(pixels.size() == (unsigned int) (4 * port[2] * port[3]));
+  GLveci quadi;
+  gl_veci_set(quadi, port[0], port[1], port[0] + port[2], port[1] + port[3]);
+  if (!_begin_stroke(quadi)) {
+    return;
+  }
+  GLfloat radius = 0.5f * port[2] * STAMP_OUTER_RADIUS;
+  _set_stamp(port[0] + 0.5f * port[2], port[1] + 0.5f * port[3],
+             radius, radius, 1.0f, 0.0f);
+  
+  for (GLint j = quadi[1]; j < quadi[3]; j++) {
+    _stamp_coverage(quadi[0], quadi[2], j, _coverage);
+    _blend(quadi[0], quadi[2], j, _coverage,
+           &pixels[4 * ((j - port[1]) * port[2] + quadi[0] - port[0])],
+           paint);
+  }
+}
+
+const_GLveci_t
+Canvas::drawn_pixels(void) const {
+  return _drawport;
+}
+
+unsigned int
+Canvas::number_of_tiles(void) const {
+  return _number_of_tiles;
+}
+
+Canvas::_Tile *
+Canvas::_tile(int i, int j) {
+  assert(i >= 0 && i < _number_of_columns &&
+         j >= 0 && j < _number_of_rows);
+  _Tile*& tile = _tiles[j * _number_of_columns + i];
+  if (tile == NULL) {
+    tile = new _Tile;
+    assert(tile != NULL);
+    for (int k = 0; k < TILE_SIZE * TILE_SIZE; k++) {
+      memcpy(&tile->pixels[4 * k], _background, 4);
+    }
+    memset(tile->stencil, 0, sizeof(tile->stencil));
+    _number_of_tiles++;
+  }
+  return tile;
+}
+
+const Canvas::_Tile *
+Canvas::_tile(int i, int j) const {
+  assert(i >= 0 && i < _number_of_columns &&
+         j >= 0 && j < _number_of_rows);
+  return _tiles[j * _number_of_columns + i];
+}
+
+bool
+Canvas::_clip(GLveci quadi) const {
+  quadi[0] = scali_max(quadi[0], _viewport[0]);
+  quadi[1] = scali_max(quadi[1], _viewport[1]);
+  quadi[2] = scali_min(quadi[2], _viewport[0] + _viewport[2]);
+  quadi[3] = scali_min(quadi[3], _viewport[1] + _viewport[3]);
+  return (quadi[0] < quadi[2] && quadi[1] < quadi[3]);
+}
+
+void
+Canvas::_set_stamp(GLfloat x, GLfloat y, GLfloat radius_along,
+                   GLfloat radius_across, GLfloat xaxis, GLfloat yaxis) {
+  double along = 1.0 / ((double) radius_along * radius_along);
+  double across = 1.0 / ((double) radius_across * radius_across);
+  double scale = (double) (((gint64) 1) << FORM_SHIFT);
+  _stamp_center[0] = to_fixed(x);
+  _stamp_center[1] = to_fixed(y);
+  _stamp_form[0]
+    = (gint64) floor((xaxis * xaxis * along + yaxis * yaxis * across) * scale
+                     + 0.5);
+  _stamp_form[1]
+    = (gint64) floor(xaxis * yaxis * (along - across) * scale + 0.5);
+  _stamp_form[2]
+    = (gint64) floor((yaxis * yaxis * along + xaxis * xaxis * across) * scale
+                     + 0.5);
+}
+
+void
+Canvas::_stamp_coverage(GLint x0, GLint x1, GLint y,
+                        vector<GLubyte>& coverage) const {
+  coverage.resize(x1 - x0);
+  gint64 dy = (gint64) y * SUBPIXELS + SUBPIXELS / 2 - _stamp_center[1];
+  for (GLint x = x0; x < x1; x++) {
+    gint64 dx = (gint64) x * SUBPIXELS + SUBPIXELS / 2 - _stamp_center[0];
+    gint64 form = (_stamp_form[0] * dx * dx + 2 * _stamp_form[1] * dx * dy +
+                   _stamp_form[2] * dy * dy) >> FORM_SHIFT;
+    if (form < 0) form = 0;
+    coverage[x - x0] = (form >= FORM_ONE) ? 0
+      : stamp_profile[form * STAMP_PROFILE_SIZE / FORM_ONE];
+  }
+}
+
+bool
+Canvas::_begin_stroke(GLveci quadi) {
+  if (!_clip(quadi)) {
+    gl_veci_eq(_drawport, GL_VECI_NULL);
+    return false;
+  }
+  gl_veci_set(_drawport,
+              quadi[0],
+              quadi[1],
+              quadi[2] - quadi[0],
+              quadi[3] - quadi[1]);
+  if (_is_dirty) {
+    _dirty[0] = scali_min(_dirty[0], quadi[0]);
+    _dirty[1] = scali_min(_dirty[1], quadi[1]);
+    _dirty[2] = scali_max(_dirty[2], quadi[2]);
+    _dirty[3] = scali_max(_dirty[3], quadi[3]);
+  } else {
+    _is_dirty = true;
+    gl_veci_eq(_dirty, quadi);
+  }
+  return true;
+}
+
+void
+Canvas::_blend(GLint x0, GLint x1, GLint y, vector<GLubyte>& coverage,
+               const GLubyte *colors, const Paint& paint) {
+  unsigned int opacity = to_ubyte(paint.color[3]);
+  for (GLint x = x0; x < x1; x++) {
+    unsigned int v = coverage[x - x0] * opacity + 128;
+    coverage[x - x0] = (GLubyte) ((v + (v >> 8)) >> 8);
+  }
+  
+  // span by span, each inside a tile
+  GLint j = (y - _viewport[1]) / TILE_SIZE;
+  GLint row = (y - _viewport[1]) % TILE_SIZE;
+  for (GLint x = x0; x < x1;) {
+    GLint i = (x - _viewport[0]) / TILE_SIZE;
+    GLint column = (x - _viewport[0]) % TILE_SIZE;
+    GLint n = scali_min(x1 - x, TILE_SIZE - column);
+    const GLubyte *alpha = &coverage[x - x0];
+    bool is_covered = false;
+    for (GLint k = 0; k < n && !is_covered; k++) {
+      is_covered = (alpha[k] != 0);
+    }
+    if (is_covered) {
+      _Tile *tile = _tile(i, j);
+      GLint offset = row * TILE_SIZE + column;
+      blend_pixels(&tile->pixels[4 * offset], colors + 4 * (x - x0),
+                   alpha, n);
+      blend_stencil(&tile->stencil[offset], alpha, n,
+                    paint.stencil_value, paint.stencil_mask);
+    }
+    x += n;
+  }
+}
@@ -0,0 +1,87 @@
+#ifndef __CANVAS_HH__
+#define __CANVAS_HH__
+
+#include <glib.h>
+#include <vector>
+#include <opengl_utils.h>
+
+/*
+ * Copy of the drawing in memory, where the tools stamp their strokes, with
+ * the stencil planes written by the tools. Footprints are rasterized in
+ * fixed point and composited with integer arithmetic, so that a stroke
+ * gives the same pixels on every machine, with or without an OpenGL
+ * context. The canvas is cut in square tiles, allocated the first time a
+ * stroke reaches them. The stamped pixels are then drawn to the back
+ * buffer, which remains the one the drawing composites and reads back.
+ * Ports are given by their origin and size, in window coordinates.
+ */
+class Canvas {
+public:
+  static const int TILE_SIZE = 256;
+  static const GLubyte STENCIL_MASK = 0x73; // 0x1 + 0x2 + 0x10 + 0x20 + 0x40
+  
+  typedef struct {
+    GLvecf color; // alpha is the opacity
+    GLubyte stencil_value, stencil_mask; // written wherever a stroke covers
+  } Paint;
+  
+  Canvas(void);
+  ~Canvas(void);
+  // the viewport has just been cleared to the background color
+  void reset(const GLveci viewport, const GLvecf background_color);
+  void clear(void);
+  // copies the color of the port back from the back buffer, after
+  // OpenGL has drawn into it
+  void read(const GLveci port);
+  // draws the pixels stamped since the last call to the back buffer
+  void draw(void);
+  // soft round footprint, stretched along the pen tilt
+  void stamp(GLfloat x, GLfloat y, GLfloat radius,
+             GLfloat xtilt, GLfloat ytilt, const Paint& paint);
+  // antialiased segment with round ends, a point when both ends are equal
+  void segment(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2,
+               GLfloat half_width, const Paint& paint);
+  // RGBA pixels of the port, pixels outside the canvas left unchanged
+  void pick_up(const GLveci port, std::vector<GLubyte>& pixels) const;
+  // pixels picked up blended into the port, through the round footprint
+  // inscribed in it, the paint color being ignored
+  void smudge(const GLveci port, const std::vector<GLubyte>& pixels,
+              const Paint& paint);
+  // port of the pixels changed by the last stroke, empty if none
+  const_GLveci_t drawn_pixels(void) const;
+  unsigned int number_of_tiles(void) const;
+  
+private:
+  typedef struct {
+    GLubyte pixels[4 * TILE_SIZE * TILE_SIZE];
+    GLubyte stencil[TILE_SIZE * TILE_SIZE];
+  } _Tile;
+  
+  _Tile *_tile(int i, int j);
+  const _Tile *_tile(int i, int j) const;
+  bool _clip(GLveci quadi) const;
+  void _set_stamp(GLfloat x, GLfloat y, GLfloat radius_along,
+                  GLfloat radius_across, GLfloat xaxis, GLfloat yaxis);
+  void _stamp_coverage(GLint x0, GLint x1, GLint y,
+                       std::vector<GLubyte>& coverage) const;
+  bool _begin_stroke(GLveci quadi);
+  // coverage, from x0 to x1, is scaled by the opacity in place
+  void _blend(GLint x0, GLint x1, GLint y, std::vector<GLubyte>& coverage,
+              const GLubyte *colors, const Paint& paint);
+  
+  GLveci _viewport;
+  int _number_of_columns, _number_of_rows;
+  std::vector<_Tile *> _tiles; // NULL when never stamped
+  GLubyte _background[4];
+  unsigned int _number_of_tiles;
+  GLveci _dirty; // corners, since the last draw
+  bool _is_dirty;
+  GLveci _drawport;
+  // current stamp, as a quadratic form over 1/256 pixel offsets from its
+  // center, equal to 1 << 16 on its border
+  gint64 _stamp_center[2];
+  gint64 _stamp_form[3];
+  std::vector<GLubyte> _coverage, _colors;
+};
+
+#endif // __CANVAS_HH__
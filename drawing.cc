@@ -1,31 +1,57 @@
 #include <gtk/gtk.h>
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 
 #include "application.hh"
+#include "binary_file.hh"
+#include "canvas.hh"
+#include "resources.hh"
 #include "toolbox.hh"
 #include "triangulation.hh"
 #include "triangulation_display.hh"
 #include "reconstruct_curve.hh"
+#include "tiled_texture.hh"
 #include "drawing.hh"
 
 using namespace std;
 
 static const Vec2i DEFAULT_SIZE = {256, 256};
-static const Vec2i SIZE_RANGE = {128, 1024};
+static const Vec2i SIZE_RANGE = {128, 4096};
 static const int ERASER_THRESHOLD = 16;
 static const GLfloat ALPHA_SCALE = 0.5f;
+static const unsigned int MAX_DAMAGES = 16;
+// Rationale:
+// beyond this, damaged quads of the same kind are merged in a single one
+
+static int
+power_of_two_above(int a) {
+  int p = 1;
+  while (p < a) p *= 2;
+  return p;
+}
+
+static void
+append_marking_path(Journal& journal, const vector<Tool::Point>& path) {
+  for (vector<Tool::Point>::const_iterator pi = path.begin();
+       pi != path.end(); pi++) {
+    journal.append(Journal::MARKING_POINT, pi->x(), pi->y());
+  }
+  journal.append(Journal::MARKING_END);
+}
 
 Drawing::Drawing(Application *application)
   : _application(application),
     _triangulation_proxy(NULL),
     _triangulation_display_ptr(NULL),
     _tool(NULL),
-    _is_drawing_stroke(false),
     _is_marking_stroke(false),
     _has_just_been_cleared(true),
     _has_changed(false),
+    _is_curve_current(false),
     _are_textures_and_lists_set(false),
+    _damages(),
+    _composited_area(0),
     _marking_paths(),
     _back_first_type(_COLOR_TABLE_THRESHOLD),
     _back_second_type(_COLOR_TABLE_ABSOLUTE),
@@ -37,9 +63,10 @@ Drawing::Drawing(Application *application)
   gl_veci_eq(_drawport, GL_VECI_NULL);
   gl_veci_eq(_drawbox, GL_VECI_NULL);
   
-  _front_texture = gl_texture_new();
-  _back_first_texture = gl_texture_new();
-  _back_second_texture = gl_texture_new();
+  // the front buffer holds the image shown under the drawing
+  _front_texture = new Tiled_texture(GL_RGB, false);
+  _back_first_texture = new Tiled_texture(GL_RGB, true);
+  _back_second_texture = new Tiled_texture(GL_RGB, true);
   _overlay_texture = gl_texture_new();
   _distance_texture = gl_texture_new();
   
@@ -60,7 +87,7 @@ Drawing::Drawing(Application *application)
   gl_framebuf_set_format(_colorbuf, GL_RED);
   gl_framebuf_set_format(_back_colorbuf, GL_RGBA);
   gl_framebuf_set_format(_stencilbuf, GL_STENCIL_INDEX);
-  gl_framebuf_sread(_overlay_image, "rgb/overlay.bw", GL_FILE_SGI);
+  Resources::read_image(_overlay_image, "rgb/overlay.bw");
   gl_framebuf_set_format(_overlay_image, GL_ALPHA);
 }
 
@@ -70,9 +97,9 @@ Drawing::~Drawing(void) {
     delete _triangulation_display_ptr;
   }
   
-  gl_texture_delete(_front_texture);
-  gl_texture_delete(_back_first_texture);
-  gl_texture_delete(_back_second_texture);
+  delete _front_texture;
+  delete _back_first_texture;
+  delete _back_second_texture;
   gl_texture_delete(_overlay_texture);
   gl_texture_delete(_distance_texture);
   
@@ -111,6 +138,11 @@ Drawing::has_changed(void) const {
   return _has_changed;
 }
 
+const Tool *
+Drawing::tool(void) const {
+  return _tool;
+}
+
 double
 Drawing::height_field_max(void) {
   double max = _euclidean_distance_max;
@@ -181,13 +213,10 @@ Drawing::init(void) {
   case GTK_RESPONSE_OK: {
     _triangulation_proxy = _application->triangulation();
     result = (_triangulation_proxy != NULL);
-    int width
-      = scali_nearest_power_of_two(gtk_spin_button_get_value_as_int(
-                                     GTK_SPIN_BUTTON(spinner1)));
-    int height
-      = scali_nearest_power_of_two(gtk_spin_button_get_value_as_int(
-                                     GTK_SPIN_BUTTON(spinner2)));
-    assert(width >= 0 && height >= 0);
+    // any size, the canvas textures being tiled
+    int width = gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(spinner1));
+    int height = gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(spinner2));
+    assert(width > 0 && height > 0);
     vec2i_set(_size, width, height);
     gl_vecf_eq(_background_color, _application->toolbox()->background_color());
   } break;
@@ -211,6 +240,7 @@ Drawing::read(ifstream& fin, File::Type file_type) {
     switch (file_type) {
     case File::RLF:
       fin >> *_triangulation_proxy;
+      _triangulation_proxy->renumber_vertices();
       break;
     case File::OFF:
       // nothing to do
@@ -219,6 +249,7 @@ Drawing::read(ifstream& fin, File::Type file_type) {
       assert(false);
       break;
     }
+    _is_curve_current = false;
     if (fin.fail()) {
       fin.clear();
       return false;
@@ -233,6 +264,7 @@ Drawing::read(ifstream& fin, File::Type file_type) {
       }
       Reconstruct_curve reconstruct_curve(*_triangulation_proxy);
       reconstruct_curve(triangulation_vertices);
+      _is_curve_current = true;
       return true;
     }
   }
@@ -259,11 +291,136 @@ Drawing::write(ofstream& fout, File::Type file_type) const {
   }
 }
 
+bool
+Drawing::read(const Binary_file& file) {
+  if (!init() || !_triangulation_proxy->read(file)) {
+    return false;
+  }
+  _marking_paths.clear();
+  guint64 size, number_of_paths, number_of_coordinates;
+  const guint32 *state = file.section<guint32>(Binary_file::DRAWING, size);
+  const guint32 *path_sizes
+    = file.section<guint32>(Binary_file::DRAWING_MARKING_PATHS,
+                            number_of_paths);
+  const Kernel::FT *coordinates
+    = file.section<Kernel::FT>(Binary_file::DRAWING_MARKING_POINTS,
+                               number_of_coordinates);
+  if (state == NULL || size != 1) {
+    // files without a drawing section: the curve is reconstructed on the
+    // first stroke
+    _is_curve_current = false;
+    return true;
+  }
+  guint64 n = 0;
+  for (guint64 i = 0; i < number_of_paths; i++) {
+    n += 2 * (guint64) path_sizes[i];
+  }
+  if (n != number_of_coordinates) {
+    cerr << "Error: corrupted marking paths!" << endl;
+    return false;
+  }
+  n = 0;
+  for (guint64 i = 0; i < number_of_paths; i++) {
+    vector<Tool::Point> marking_path;
+    marking_path.reserve(path_sizes[i]);
+    for (guint32 j = 0; j < path_sizes[i]; j++, n += 2) {
+      marking_path.push_back(Tool::Point(coordinates[n],
+                                         coordinates[n + 1]));
+    }
+    _marking_paths.push_back(marking_path);
+  }
+  // the face flags were saved along with the triangulation, and are
+  // current as long as the marks were not applied to them
+  _is_curve_current = (state[0] != 0);
+  return true;
+}
+
+void
+Drawing::write(Binary_file& file) const {
+  _triangulation_proxy->write(file);
+  // marking paths are applied to the face flags when the height field is
+  // drawn, so they are kept apart until then
+  vector<guint32> state(1, _is_curve_current ? 1 : 0);
+  vector<guint32> path_sizes;
+  vector<Kernel::FT> coordinates;
+  for (vector< vector<Tool::Point> >::const_iterator vpi
+         = _marking_paths.begin(); vpi != _marking_paths.end(); vpi++) {
+    path_sizes.push_back(vpi->size());
+    for (vector<Tool::Point>::const_iterator pi = vpi->begin();
+         pi != vpi->end(); pi++) {
+      coordinates.push_back(pi->x());
+      coordinates.push_back(pi->y());
+    }
+  }
+  file.set_section(Binary_file::DRAWING, state);
+  file.set_section(Binary_file::DRAWING_MARKING_PATHS, path_sizes);
+  file.set_section(Binary_file::DRAWING_MARKING_POINTS, coordinates);
+}
+
+bool
+Drawing::replay(const vector<Journal::Record>& records) {
+  bool has_replayed_edits = false;
+  vector<Tool::Point> marking_path;
+  for (vector<Journal::Record>::const_iterator ri = records.begin();
+       ri != records.end(); ri++) {
+    Tool::Point p(ri->coordinates[0], ri->coordinates[1]);
+    Vertex_handle vh;
+    switch (ri->kind) {
+    case Journal::TRIANGULATION_INSERT:
+      _triangulation_proxy->insert_first(p);
+      has_replayed_edits = true;
+      break;
+    case Journal::TRIANGULATION_REMOVE:
+      // removing a point twice is harmless, see Journal::compact
+      if (_triangulation_proxy->is_vertex(p, vh)) {
+        _triangulation_proxy->remove(vh);
+      }
+      has_replayed_edits = true;
+      break;
+    case Journal::TRIANGULATION_CLEAR:
+      _triangulation_proxy->clear();
+      _marking_paths.clear();
+      has_replayed_edits = true;
+      break;
+    case Journal::MARKING_POINT:
+      marking_path.push_back(p);
+      break;
+    case Journal::MARKING_END:
+      _marking_paths.push_back(marking_path);
+      marking_path.clear();
+      break;
+    default:
+      // tetrahedrization records
+      break;
+    }
+  }
+  if (has_replayed_edits) {
+    _has_changed = true;
+    _is_curve_current = false;
+    if (_triangulation_proxy->dimension() == 2) {
+      _triangulation_proxy->reset_flags();
+      vector<Vertex_handle> triangulation_vertices;
+      triangulation_vertices.reserve(
+        _triangulation_proxy->number_of_vertices());
+      for (Finite_vertices_iterator vi
+             = _triangulation_proxy->finite_vertices_begin();
+           vi != _triangulation_proxy->finite_vertices_end(); vi++) {
+        triangulation_vertices.push_back(vi);
+      }
+      Reconstruct_curve reconstruct_curve(*_triangulation_proxy);
+      reconstruct_curve(triangulation_vertices);
+      _is_curve_current = true;
+    }
+  } else if (!_marking_paths.empty()) {
+    _has_changed = true;
+  }
+  return _triangulation_proxy->is_valid();
+}
+
 void
 Drawing::start_drawing_stroke(GdkInputSource source, guint state,
                               gdouble x, gdouble y, gdouble pressure,
                               gdouble xtilt, gdouble ytilt) {
-  _is_drawing_stroke = true;
   if (state & GDK_SHIFT_MASK) { // hole mark mode if shift pressed
     _is_marking_stroke = true;
   }
@@ -286,28 +443,33 @@ Drawing::start_drawing_stroke(GdkInputSource source, guint state,
   }
   _tool->start_recording_path(source, x, y, pressure, xtilt, ytilt);
   _tool->start_drawing_pixels(source, x, y, pressure, xtilt, ytilt);
+  _application->toolbox()->canvas()->draw();
   gl_veci_eq(_drawport, _tool->drawn_pixels());
+  _damage_drawport();
 }
 
 void
 Drawing::stop_drawing_stroke(GdkInputSource source, guint state,
                              gdouble x, gdouble y, gdouble pressure,
                              gdouble xtilt, gdouble ytilt) {
-  _is_drawing_stroke = true;
   _tool->stop_recording_path();
   _tool->stop_drawing_pixels();
+  _application->toolbox()->canvas()->draw();
   gl_veci_eq(_drawport, _tool->drawn_pixels());
+  _damage_drawport();
   
   if (_is_marking_stroke) {
     _is_marking_stroke = false;
     // some tools, such as the eraser, do not record path
     if (!_tool->recorded_path().empty()) {
       _marking_paths.push_back(_tool->recorded_path());
+      if (_triangulation_proxy->journal() != NULL) {
+        append_marking_path(*_triangulation_proxy->journal(),
+                            _tool->recorded_path());
+      }
     }
   } else if (!_tool->recorded_path().empty()) {
-#if DEBUG
     vector<Vertex_handle> inserted_vertices;
-#endif
     Vertex_handle vh;
     bool is_first = true;
     for (vector<Tool::Point>::const_iterator pi
@@ -319,45 +481,31 @@ Drawing::stop_drawing_stroke(GdkInputSource source, guint state,
       } else {
         vh = _triangulation_proxy->insert(*pi);
       }
-#if DEBUG
       inserted_vertices.push_back(vh);
-#endif
     }
     assert(_triangulation_proxy->is_valid());
-#if DEBUG
     if (_triangulation_proxy->dimension() == 2) {
-      assert(!inserted_vertices.empty());
-      for (All_faces_iterator fi = _triangulation_proxy->all_faces_begin();
-           fi != _triangulation_proxy->all_faces_end(); fi++) {
-        fi->reset();
-      }
-      vector<Vertex_handle> triangulation_vertices;
-      triangulation_vertices.reserve(
-        _triangulation_proxy->number_of_vertices());
-      for (Finite_vertices_iterator vi
-             = _triangulation_proxy->finite_vertices_begin();
-           vi != _triangulation_proxy->finite_vertices_end(); vi++) {
-        triangulation_vertices.push_back(vi);
+      _update_curve(inserted_vertices);
+    } else {
+      _is_curve_current = false;
+#if DEBUG
+      if (_triangulation_proxy->number_of_vertices() != 0) {
+        cerr << "Warning: triangulation convex hull is not two-dimensional!"
+             << endl;
       }
-      Reconstruct_curve reconstruct_curve(*_triangulation_proxy);
-      reconstruct_curve(triangulation_vertices);//inserted_vertices);
-      //TODO: use partial update of the curve edges using inserted vertices
-    } else if (_triangulation_proxy->number_of_vertices() != 0) {
-      cerr << "Warning: triangulation convex hull is not two-dimensional!"
-           << endl;
-    }
 #endif
+    }
   }
 }
 
 void
 Drawing::draw_stroke(GdkInputSource source, guint state,
-                     gdouble x, gdouble y, gdouble pressure,
-                     gdouble xtilt, gdouble ytilt) {
-  _is_drawing_stroke = true;
-  _tool->record_path(source, x, y, pressure, xtilt, ytilt);
-  _tool->draw_pixels(source, x, y, pressure, xtilt, ytilt);
+                     const vector<Tool::Sample>& samples) {
+  _tool->record_samples(source, samples);
+  _tool->draw_samples(source, samples);
+  _application->toolbox()->canvas()->draw();
   gl_veci_eq(_drawport, _tool->drawn_pixels());
+  _damage_drawport();
 }
 
 void
@@ -379,19 +527,21 @@ Drawing::draw_height_field(void) {
   _gather_marked_triangulation_faces();
   
   // set port and tex coords
-  _is_drawing_stroke = true;
   gl_veci_set(_drawport,
               _drawbox[0],
               _drawbox[1],
               _drawbox[2] - _drawbox[0],
               _drawbox[3] - _drawbox[1]);
   
+  // the distance texture covers the drawport only, while it is rendered
+  gl_texture_set(_distance_texture, GL_TEXTURE_2D,
+                 _setup_distance_texture_cb, (void *) this);
   GLvecf drawtex;
   gl_vecf_set(drawtex,
-              (GLfloat) _drawbox[0] / (GLfloat) _viewport[2],
-              (GLfloat) _drawbox[1] / (GLfloat) _viewport[3],
-              (GLfloat) _drawbox[2] / (GLfloat) _viewport[2],
-              (GLfloat) _drawbox[3] / (GLfloat) _viewport[3]);
+              0.0f,
+              0.0f,
+              (GLfloat) _drawport[2] / (GLfloat) _distance_texture->width,
+              (GLfloat) _drawport[3] / (GLfloat) _distance_texture->height);
   
   // render triangulation mask
   gl_framebuf_set_port(_stencilbuf, _drawport);
@@ -403,7 +553,6 @@ Drawing::draw_height_field(void) {
   glStencilOp(GL_REPLACE, GL_REPLACE, GL_REPLACE);
   glEnable(GL_STENCIL_TEST);
   display_triangulation(Triangulation_display::THIN_MASK, false);
-  _is_drawing_stroke = true; // HACK: because the display reset this flag
   
   glPopAttrib();
   
@@ -442,7 +591,7 @@ Drawing::draw_height_field(void) {
   gl_list_call(_distance_color_table_list);
   gl_list_call(_convolution_list);
   glTexSubImage2D(GL_TEXTURE_2D, 0,
-                  _drawport[0], _drawport[1], _drawport[2], _drawport[3],
+                  0, 0, _drawport[2], _drawport[3],
                   GL_ALPHA, _stencilbuf->type, _stencilbuf->pixels);
   glPopAttrib();
   glPopClientAttrib();
@@ -475,8 +624,11 @@ Drawing::draw_height_field(void) {
   glEnd();
   
   glPopAttrib();
+  gl_texture_clear(_distance_texture);
+  _application->toolbox()->canvas()->read(_drawport);
   
-  draw(); // HACK: because the popup menu needs a non drawing stroke redisplay
+  _damage_drawport();
+  draw();
 }
 
 void
@@ -502,29 +654,26 @@ Drawing::start_drawing(const GLveci viewport) {
                 _display_overlay_list_cb, (void *) this, GL_FALSE);
   }
   
-  glPushAttrib(GL_COLOR_BUFFER_BIT | GL_PIXEL_MODE_BIT);
+  glPushAttrib(GL_COLOR_BUFFER_BIT | GL_PIXEL_MODE_BIT | GL_TEXTURE_BIT);
   
   glClearColor(_background_color[0],
                _background_color[1],
                _background_color[2],
                _background_color[3]);
   glClear(GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+  _application->toolbox()->canvas()->reset(_viewport, _background_color);
   
   glReadBuffer(GL_FRONT);
-  gl_texture_set(_front_texture, GL_TEXTURE_2D,
-                 _setup_non_overlay_texture_cb, (void *) this);
+  _front_texture->reset(_viewport);
   
+  // back tiles are allocated as strokes reach them
   glReadBuffer(GL_BACK);
   glPushAttrib(GL_PIXEL_MODE_BIT);
   gl_list_call(_back_first_color_table_list);
-  gl_texture_set(_back_first_texture, GL_TEXTURE_2D,
-                 _setup_non_overlay_texture_cb, (void *) this);
+  _back_first_texture->reset(_viewport);
   gl_list_call(_back_second_color_table_list);
-  gl_texture_set(_back_second_texture, GL_TEXTURE_2D,
-                 _setup_non_overlay_texture_cb, (void *) this);
+  _back_second_texture->reset(_viewport);
   glPopAttrib();
-  gl_texture_set(_distance_texture, GL_TEXTURE_2D,
-                 _setup_distance_texture_cb, (void *) this);
   
   glPopAttrib();
   
@@ -537,7 +686,16 @@ Drawing::start_drawing(const GLveci viewport) {
   _triangulation_proxy->clear();
   _remove(_triangulation_display_ptr);
   _has_just_been_cleared = true;
+  _is_curve_current = true;
   _marking_paths.clear();
+  _damages.clear();
+  GLveci quadi;
+  gl_veci_set(quadi,
+              _viewport[0],
+              _viewport[1],
+              _viewport[0] + _viewport[2],
+              _viewport[1] + _viewport[3]);
+  damage(quadi);
 }
 
 void
@@ -565,15 +723,8 @@ Drawing::stop_drawing(void) {
   }
   
 #if DEBUG
-  GLframebuf *back_first_buf = gl_framebuf_new();
-  gl_framebuf_tread(back_first_buf, _back_first_texture, 0);
-  gl_framebuf_swrite(back_first_buf, "debug_02.rgb", GL_FILE_SGI, GL_FALSE);
-  gl_framebuf_delete(back_first_buf);
-  
-  GLframebuf *back_second_buf = gl_framebuf_new();
-  gl_framebuf_tread(back_second_buf, _back_second_texture, 0);
-  gl_framebuf_swrite(back_second_buf, "debug_03.rgb", GL_FILE_SGI, GL_FALSE);
-  gl_framebuf_delete(back_second_buf);
+  cout << "Drawing with " << _back_first_texture->number_of_tiles()
+       << " tiles." << endl;
   
   GLframebuf *stencilbuf = gl_framebuf_new();
   gl_framebuf_set_format(stencilbuf, GL_STENCIL_INDEX);
@@ -584,104 +735,32 @@ Drawing::stop_drawing(void) {
 #endif
 }
 
+void
+Drawing::damage(const GLveci quadi) {
+  _damage(quadi, false);
+}
+
 void
 Drawing::draw(void) {
-  GLveci quadi;
-  GLvecf quadf;
-  
-  if (_is_drawing_stroke) {
-    GLveci quadi_lim;
-    gl_veci_set(quadi_lim,
-                _viewport[0],
-                _viewport[1],
-                _viewport[0] + _viewport[2],
-                _viewport[1] + _viewport[3]);
-    
-    gl_veci_set(quadi,
-                _drawport[0],
-                _drawport[1],
-                _drawport[0] + _drawport[2],
-                _drawport[1] + _drawport[3]);
-    quadi[0] = scali_clamp(quadi[0], quadi_lim[0], quadi_lim[2]);
-    quadi[1] = scali_clamp(quadi[1], quadi_lim[1], quadi_lim[3]);
-    quadi[2] = scali_clamp(quadi[2], quadi_lim[0], quadi_lim[2]);
-    quadi[3] = scali_clamp(quadi[3], quadi_lim[1], quadi_lim[3]);
-    
-    gl_vecf_set(quadf,
-                (GLfloat) quadi[0] / (GLfloat) (quadi_lim[2] - quadi_lim[0]),
-                (GLfloat) quadi[1] / (GLfloat) (quadi_lim[3] - quadi_lim[1]),
-                (GLfloat) quadi[2] / (GLfloat) (quadi_lim[2] - quadi_lim[0]),
-                (GLfloat) quadi[3] / (GLfloat) (quadi_lim[3] - quadi_lim[1]));
-    
-    if (_has_just_been_cleared) {
-      _has_just_been_cleared = false;
-      gl_veci_eq(_drawbox, quadi);
-    } else {
-      _drawbox[0] = scali_min(_drawbox[0], quadi[0]);
-      _drawbox[1] = scali_min(_drawbox[1], quadi[1]);
-      _drawbox[2] = scali_max(_drawbox[2], quadi[2]);
-      _drawbox[3] = scali_max(_drawbox[3], quadi[3]);
-    }
-  } else {
-    gl_veci_set(quadi,
-                _viewport[0],
-                _viewport[1],
-                _viewport[0] + _viewport[2],
-                _viewport[1] + _viewport[3]);
-    gl_vecf_set(quadf, 0.0f, 0.0f, 1.0f, 1.0f);
-  }
-  
-  /* draw non-overlay */
-  glPushAttrib(GL_TEXTURE_BIT | GL_COLOR_BUFFER_BIT);
-  
-  gl_list_call(_first_pass_list);
-  glPushAttrib(GL_PIXEL_MODE_BIT);
-  gl_list_call(_back_second_color_table_list);
-  _draw_quad(quadi, quadf);
-  glPopAttrib();
-  
-  gl_list_call(_second_pass_list);
-  glPushAttrib(GL_PIXEL_MODE_BIT);
-  gl_list_call(_back_first_color_table_list);
-  _draw_quad(quadi, quadf);
-  glPopAttrib();
-  
-  glPopAttrib();
-  
-  gl_vecf_set(quadf,
-              (GLfloat) quadi[0] / (GLfloat) _overlay_texture->width,
-              (GLfloat) quadi[1] / (GLfloat) _overlay_texture->height,
-              (GLfloat) quadi[2] / (GLfloat) _overlay_texture->width,
-              (GLfloat) quadi[3] / (GLfloat) _overlay_texture->height);
-  
-  /* draw overlay */
-  glPushAttrib(GL_CURRENT_BIT | GL_TEXTURE_BIT |
-               GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
-  
-  gl_list_call(_overlay_list);
-  glBegin(GL_QUADS);
-  glTexCoord2f(quadf[0], quadf[1]);
-  glVertex2i(quadi[0], quadi[1]);
-  glTexCoord2f(quadf[2], quadf[1]);
-  glVertex2i(quadi[2], quadi[1]);
-  glTexCoord2f(quadf[2], quadf[3]);
-  glVertex2i(quadi[2], quadi[3]);
-  glTexCoord2f(quadf[0], quadf[3]);
-  glVertex2i(quadi[0], quadi[3]);
-  glEnd();
-  glFinish();
-  
-  glPopAttrib();
-  
-  if (_is_drawing_stroke) {
-    _is_drawing_stroke = false;
+  // idle redraws find nothing to composite
+  vector<_Damage> damages;
+  damages.swap(_damages);
+  for (vector<_Damage>::const_iterator di = damages.begin();
+       di != damages.end(); di++) {
+    _composite(di->quadi, di->is_drawn);
   }
 }
 
+unsigned long
+Drawing::composited_area(void) {
+  unsigned long area = _composited_area;
+  _composited_area = 0;
+  return area;
+}
+
 void
 Drawing::display_triangulation(Triangulation_display::Style style,
                                bool display_bbox, bool display_marks) {
-  _is_drawing_stroke = false;
   if (display_marks) {
     _reconstruct_curve();
     _gather_marked_triangulation_faces();
@@ -694,36 +773,6 @@ Drawing::display_triangulation(Triangulation_display::Style style,
   }
 }
 
-GLboolean
-Drawing::_setup_non_overlay_texture_cb(void *data, GLboolean test_proxy) {
-  Drawing *drawing = (Drawing *) data;
-  
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-  assert(drawing->_viewport[2] % 2 == 0 && drawing->_viewport[3] % 2 == 0);
-  if (test_proxy) {
-    GLint proxy_texture_width = 0;
-    glTexImage2D(GL_PROXY_TEXTURE_2D, 0, GL_RGB,
-                 drawing->_viewport[2], drawing->_viewport[3], 0,
-                 GL_RGB, GL_UNSIGNED_BYTE, NULL);
-    glGetTexLevelParameteriv(GL_PROXY_TEXTURE_2D, 0, GL_TEXTURE_WIDTH,
-                             &proxy_texture_width);
-    if (proxy_texture_width == 0) {
-      cerr << "Error: unsupported texture!" << endl;
-      return GL_FALSE;
-    } else {
-      return GL_TRUE;
-    }
-  } else {
-    glCopyTexImage2D(GL_TEXTURE_2D, 0, GL_RGB,
-                     drawing->_viewport[0], drawing->_viewport[1],
-                     drawing->_viewport[2], drawing->_viewport[3], 0);
-    return GL_TRUE;
-  }
-}
-
 GLboolean
 Drawing::_setup_overlay_texture_cb(void *data, GLboolean test_proxy) {
   GLframebuf *image = (GLframebuf *) data;
@@ -762,11 +811,12 @@ Drawing::_setup_distance_texture_cb(void *data, GLboolean test_proxy) {
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-  assert(drawing->_viewport[2] % 2 == 0 && drawing->_viewport[3] % 2 == 0);
+  GLsizei width = power_of_two_above(drawing->_drawport[2]);
+  GLsizei height = power_of_two_above(drawing->_drawport[3]);
   if (test_proxy) {
     GLint proxy_texture_width = 0;
     glTexImage2D(GL_PROXY_TEXTURE_2D, 0, GL_ALPHA,
-                 drawing->_viewport[2], drawing->_viewport[3], 0,
+                 width, height, 0,
                  GL_ALPHA, GL_UNSIGNED_BYTE, NULL);
     glGetTexLevelParameteriv(GL_PROXY_TEXTURE_2D, 0, GL_TEXTURE_WIDTH,
                              &proxy_texture_width);
@@ -777,40 +827,33 @@ Drawing::_setup_distance_texture_cb(void *data, GLboolean test_proxy) {
       return GL_TRUE;
     }
   } else {
-    glCopyTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA,
-                     drawing->_viewport[0], drawing->_viewport[1],
-                     drawing->_viewport[2], drawing->_viewport[3], 0);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA,
+                 width, height, 0,
+                 GL_ALPHA, GL_UNSIGNED_BYTE, NULL);
     return GL_TRUE;
   }
 }
 
+// tiles are bound in Drawing::draw, lists holding the state of all tiles
 GLboolean
 Drawing::_display_first_pass_list_cb(void *data, GLboolean test_proxy) {
-  Drawing *drawing = (Drawing *) data;
-  
   if (test_proxy) return GL_TRUE;
   glDrawBuffer(GL_FRONT);
   glActiveTexture(GL_TEXTURE0);
   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-  gl_texture_bind(drawing->_front_texture);
   glEnable(GL_TEXTURE_2D);
   glActiveTexture(GL_TEXTURE1);
   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_BLEND);
-  gl_texture_bind(drawing->_back_second_texture);
   glEnable(GL_TEXTURE_2D);
   return GL_TRUE;
 }
 
 GLboolean
 Drawing::_display_second_pass_list_cb(void *data, GLboolean test_proxy) {
-  Drawing *drawing = (Drawing *) data;
-  
   if (test_proxy) return GL_TRUE;
   glActiveTexture(GL_TEXTURE1);
   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
   glActiveTexture(GL_TEXTURE0);
-  gl_texture_release(drawing->_front_texture);
-  gl_texture_bind(drawing->_back_first_texture);
   glBlendFunc(GL_ONE, GL_ONE);
   glEnable(GL_BLEND);
   return GL_TRUE;
@@ -954,11 +997,12 @@ Drawing::_remove(Triangulation_display *triangulation_display) {
 }
 
 void
-Drawing::_draw_quad(const GLveci quadi, const GLvecf quadf) const {
-  if (_is_drawing_stroke) {
-    glCopyTexSubImage2D(GL_TEXTURE_2D, 0,
-                        quadi[0], quadi[1], quadi[0], quadi[1],
-                        quadi[2] - quadi[0], quadi[3] - quadi[1]);
+Drawing::_draw_quad(Tiled_texture *texture, int i, int j, bool is_drawn,
+                    const GLveci quadi, const GLvecf quadf) const {
+  if (is_drawn) {
+    texture->copy(i, j, quadi);
+  } else {
+    texture->bind(i, j);
   }
   
   glBegin(GL_QUADS);
@@ -975,7 +1019,135 @@ Drawing::_draw_quad(const GLveci quadi, const GLvecf quadf) const {
   glMultiTexCoord2f(GL_TEXTURE1, quadf[0], quadf[3]);
   glVertex2i(quadi[0], quadi[3]);
   glEnd();
-  glFinish();
+}
+
+void
+Drawing::_damage(const GLveci quadi, bool is_drawn) {
+  _Damage damage;
+  damage.is_drawn = is_drawn;
+  damage.quadi[0] = scali_clamp(quadi[0], _viewport[0],
+                                _viewport[0] + _viewport[2]);
+  damage.quadi[1] = scali_clamp(quadi[1], _viewport[1],
+                                _viewport[1] + _viewport[3]);
+  damage.quadi[2] = scali_clamp(quadi[2], _viewport[0],
+                                _viewport[0] + _viewport[2]);
+  damage.quadi[3] = scali_clamp(quadi[3], _viewport[1],
+                                _viewport[1] + _viewport[3]);
+  if (damage.quadi[0] >= damage.quadi[2] ||
+      damage.quadi[1] >= damage.quadi[3]) {
+    return;
+  }
+  if (is_drawn) {
+    if (_has_just_been_cleared) {
+      _has_just_been_cleared = false;
+      gl_veci_eq(_drawbox, damage.quadi);
+    } else {
+      _drawbox[0] = scali_min(_drawbox[0], damage.quadi[0]);
+      _drawbox[1] = scali_min(_drawbox[1], damage.quadi[1]);
+      _drawbox[2] = scali_max(_drawbox[2], damage.quadi[2]);
+      _drawbox[3] = scali_max(_drawbox[3], damage.quadi[3]);
+    }
+  }
+  
+  // overlapping quads of the same kind are merged, so that successive
+  // stroke segments are composited once
+  bool is_merging_all = (_damages.size() >= MAX_DAMAGES);
+  vector<_Damage>::iterator di = _damages.begin();
+  while (di != _damages.end()) {
+    if (di->is_drawn == is_drawn &&
+        (is_merging_all ||
+         (di->quadi[0] <= damage.quadi[2] && damage.quadi[0] <= di->quadi[2] &&
+          di->quadi[1] <= damage.quadi[3] && damage.quadi[1] <= di->quadi[3])))
+    {
+      damage.quadi[0] = scali_min(damage.quadi[0], di->quadi[0]);
+      damage.quadi[1] = scali_min(damage.quadi[1], di->quadi[1]);
+      damage.quadi[2] = scali_max(damage.quadi[2], di->quadi[2]);
+      damage.quadi[3] = scali_max(damage.quadi[3], di->quadi[3]);
+      _damages.erase(di);
+      di = _damages.begin();
+    } else {
+      di++;
+    }
+  }
+  _damages.push_back(damage);
+}
+
+void
+Drawing::_damage_drawport(void) {
+  GLveci quadi;
+  gl_veci_set(quadi,
+              _drawport[0],
+              _drawport[1],
+              _drawport[0] + _drawport[2],
+              _drawport[1] + _drawport[3]);
+  _damage(quadi, true);
+}
+
+void
+Drawing::_composite(const GLveci quadi, bool is_drawn) {
+  /* draw non-overlay, tile by tile */
+  GLveci range;
+  _back_first_texture->tile_range(quadi, range);
+  for (int j = range[1]; j < range[3]; j++) {
+    for (int i = range[0]; i < range[2]; i++) {
+      GLveci tile_quadi;
+      GLvecf tile_quadf;
+      _back_first_texture->tile_quad(i, j, tile_quadi);
+      tile_quadi[0] = scali_max(tile_quadi[0], quadi[0]);
+      tile_quadi[1] = scali_max(tile_quadi[1], quadi[1]);
+      tile_quadi[2] = scali_min(tile_quadi[2], quadi[2]);
+      tile_quadi[3] = scali_min(tile_quadi[3], quadi[3]);
+      _back_first_texture->tile_tex_coords(i, j, tile_quadi, tile_quadf);
+      
+      glPushAttrib(GL_TEXTURE_BIT | GL_COLOR_BUFFER_BIT);
+      
+      gl_list_call(_first_pass_list);
+      glActiveTexture(GL_TEXTURE0);
+      _front_texture->bind(i, j);
+      glActiveTexture(GL_TEXTURE1);
+      glPushAttrib(GL_PIXEL_MODE_BIT);
+      gl_list_call(_back_second_color_table_list);
+      _draw_quad(_back_second_texture, i, j, is_drawn,
+                 tile_quadi, tile_quadf);
+      glPopAttrib();
+      
+      gl_list_call(_second_pass_list);
+      glPushAttrib(GL_PIXEL_MODE_BIT);
+      gl_list_call(_back_first_color_table_list);
+      _draw_quad(_back_first_texture, i, j, is_drawn,
+                 tile_quadi, tile_quadf);
+      glPopAttrib();
+      
+      glPopAttrib();
+    }
+  }
+  
+  GLvecf quadf;
+  gl_vecf_set(quadf,
+              (GLfloat) quadi[0] / (GLfloat) _overlay_texture->width,
+              (GLfloat) quadi[1] / (GLfloat) _overlay_texture->height,
+              (GLfloat) quadi[2] / (GLfloat) _overlay_texture->width,
+              (GLfloat) quadi[3] / (GLfloat) _overlay_texture->height);
+  
+  /* draw overlay */
+  glPushAttrib(GL_CURRENT_BIT | GL_TEXTURE_BIT |
+               GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+  
+  gl_list_call(_overlay_list);
+  glBegin(GL_QUADS);
+  glTexCoord2f(quadf[0], quadf[1]);
+  glVertex2i(quadi[0], quadi[1]);
+  glTexCoord2f(quadf[2], quadf[1]);
+  glVertex2i(quadi[2], quadi[1]);
+  glTexCoord2f(quadf[2], quadf[3]);
+  glVertex2i(quadi[2], quadi[3]);
+  glTexCoord2f(quadf[0], quadf[3]);
+  glVertex2i(quadi[0], quadi[3]);
+  glEnd();
+  
+  glPopAttrib();
+  
+  _composited_area += (quadi[2] - quadi[0]) * (quadi[3] - quadi[1]);
 }
 
 void
@@ -994,7 +1166,7 @@ Drawing::_remove_erased_triangulation_vertices(void) {
 #endif
   
   gl_itembuf_set_port(_itembuf, _drawport);
-  unsigned int npoint_items = _triangulation_proxy->number_of_vertices();
+  unsigned int npoint_items = _triangulation_proxy->number_of_vertex_ids();
   gl_itembuf_set_items(_itembuf, &npoint_items);
   gl_itembuf_render_begin(_itembuf, GL_TRUE);
   
@@ -1016,27 +1188,58 @@ Drawing::_remove_erased_triangulation_vertices(void) {
   /* remove erased vertices */
   const GLubyte BACKGROUND_COLOR_RED
     = (GLubyte) (_background_color[0] * (GLfloat) GL_UBYTE_MAX);
-  vector<bool> is_visible(_itembuf->nitems._1D, false);
+  // points are one pixel wide, so each vertex owns at most one pixel and
+  // the erased IDs are gathered in the pixel loop, sorted afterwards
+  vector<guint32> erased_ids;
   GLubyte *colorbuf_pixels = (GLubyte *) _colorbuf->pixels;
   guint32 *itembuf_pixels = (guint32 *) _itembuf->gl_framebuf->pixels;
   int size = _itembuf->gl_framebuf->width * _itembuf->gl_framebuf->height;
   for (int i = 0; i < size; i++) {
     guint32 id = itembuf_pixels[i];
-    if (id != GL_ITEMBUF_NULL_ID) {
+    if (id != GL_ITEMBUF_NULL_ID &&
+        abs(colorbuf_pixels[i] - BACKGROUND_COLOR_RED) < ERASER_THRESHOLD) {
       assert(id < _itembuf->nitems._1D);
-      is_visible[id]
-        = (abs(colorbuf_pixels[i] - BACKGROUND_COLOR_RED) < ERASER_THRESHOLD);
+      erased_ids.push_back(id);
+    }
+  }
+  sort(erased_ids.begin(), erased_ids.end());
+  erased_ids.erase(unique(erased_ids.begin(), erased_ids.end()),
+                   erased_ids.end());
+  vector<Vertex_handle> removed_vertices;
+  set<Vertex_handle> reconnected_vertices;
+  removed_vertices.reserve(erased_ids.size());
+  for (vector<guint32>::const_iterator ii = erased_ids.begin();
+       ii != erased_ids.end(); ii++) {
+    Vertex_handle vh = _triangulation_proxy->vertex_with_id(*ii);
+    if (_triangulation_proxy->dimension() == 2) {
+      Vertex_circulator
+        vc = _triangulation_proxy->incident_vertices(vh), done(vc);
+      do {
+        if (!_triangulation_proxy->is_infinite(vc)) {
+          reconnected_vertices.insert(vc);
+        }
+      } while (++vc != done);
     }
+    removed_vertices.push_back(vh);
   }
-  int number_of_removed_vertices = 0;
-  Finite_vertices_iterator vi = _triangulation_proxy->finite_vertices_begin();
-  for (guint32 i = 0; i < _itembuf->nitems._1D; i++, vi++) {
-    if (is_visible[i]) {
-      _triangulation_proxy->remove(vi);
-      number_of_removed_vertices++;
+  int number_of_removed_vertices = removed_vertices.size();
+  if (number_of_removed_vertices != 0) {
+    for (vector<Vertex_handle>::const_iterator vhi = removed_vertices.begin();
+         vhi != removed_vertices.end(); vhi++) {
+      reconnected_vertices.erase(*vhi);
+    }
+    if (_triangulation_proxy->remove(removed_vertices)) {
+      // rebuilt, the reconnected handles are gone
+      _is_curve_current = false;
+    }
+    if (_triangulation_proxy->dimension() == 2) {
+      vector<Vertex_handle> changed_vertices(reconnected_vertices.begin(),
+                                             reconnected_vertices.end());
+      _update_curve(changed_vertices);
+    } else {
+      _is_curve_current = false;
     }
   }
-  assert(vi == _triangulation_proxy->finite_vertices_end());
 #if DEBUG
   if (number_of_removed_vertices != 0) {
     cout << "Erasing " << number_of_removed_vertices << " vertices." << endl;
@@ -1046,10 +1249,10 @@ Drawing::_remove_erased_triangulation_vertices(void) {
 
 void
 Drawing::_reconstruct_curve(void) {
-  for (All_faces_iterator fi = _triangulation_proxy->all_faces_begin();
-       fi != _triangulation_proxy->all_faces_end(); fi++) {
-    fi->reset();
+  if (_is_curve_current) {
+    return;
   }
+  _triangulation_proxy->reset_flags();
   vector<Vertex_handle> triangulation_vertices;
   triangulation_vertices.reserve(_triangulation_proxy->number_of_vertices());
   for (Finite_vertices_iterator vi
@@ -1059,6 +1262,23 @@ Drawing::_reconstruct_curve(void) {
   }
   Reconstruct_curve reconstruct_curve(*_triangulation_proxy);
   reconstruct_curve(triangulation_vertices);
+  _is_curve_current = true;
+  _has_changed = true;
+}
+
+void
+Drawing::_update_curve(vector<Vertex_handle>& changed_vertices) {
+  if (!_is_curve_current) {
+    _reconstruct_curve();
+    return;
+  }
+  // points inserted twice give the same vertex
+  sort(changed_vertices.begin(), changed_vertices.end());
+  changed_vertices.erase(unique(changed_vertices.begin(),
+                                changed_vertices.end()),
+                         changed_vertices.end());
+  Reconstruct_curve reconstruct_curve(*_triangulation_proxy);
+  reconstruct_curve(changed_vertices);
   _has_changed = true;
 }
 
@@ -1105,6 +1325,7 @@ Drawing::_gather_marked_triangulation_faces(void) {
     if (!marked_faces.empty()) {
       Reconstruct_curve reconstruct_curve(*_triangulation_proxy);
       reconstruct_curve(marked_faces);
+      _is_curve_current = false;
     }
   }
 }
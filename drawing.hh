@@ -6,10 +6,13 @@
 #include <opengl_buffer.h>
 
 #include "file.hh"
+#include "journal.hh"
 #include "tool.hh"
 #include "triangulation_display.hh"
 
 class Application;
+class Binary_file;
+class Tiled_texture;
 
 class Drawing {
 public:
@@ -19,23 +22,35 @@ public:
   const_GLvecf_t background_color(void) const;
   const_GLveci_t drawbox(void) const;
   bool has_changed(void) const;
+  // tool of the current stroke, NULL before the first one
+  const Tool *tool(void) const;
   double height_field_max(void);
   bool init(void);
   bool read(std::ifstream& fin, File::Type file_type);
   bool write(std::ofstream& fout, File::Type file_type) const;
+  bool read(const Binary_file& file);
+  void write(Binary_file& file) const;
+  // edits journaled since the last snapshot read
+  bool replay(const std::vector<Journal::Record>& records);
   void start_drawing_stroke(GdkInputSource source, guint state,
                             gdouble x, gdouble y, gdouble pressure,
                             gdouble xtilt, gdouble ytilt);
   void stop_drawing_stroke(GdkInputSource source, guint state,
                            gdouble x, gdouble y, gdouble pressure,
                            gdouble xtilt, gdouble ytilt);
+  // motion coalesced since the last frame, drawn as a single batch
   void draw_stroke(GdkInputSource source, guint state,
-                   gdouble x, gdouble y, gdouble pressure,
-                   gdouble xtilt, gdouble ytilt);
+                   const std::vector<Tool::Sample>& samples);
   void draw_height_field(void);
   void start_drawing(const GLveci viewport);
   void stop_drawing(void);
+  // damaged quad, given by its corners in window coordinates, to be
+  // composited again from the drawing textures
+  void damage(const GLveci quadi);
+  // composites the quads damaged since the last call
   void draw(void);
+  // number of pixels composited since the last call
+  unsigned long composited_area(void);
   void display_triangulation(Triangulation_display::Style style,
                              bool display_bbox = false,
                              bool display_marks = false);
@@ -44,6 +59,7 @@ private:
   typedef Triangulation::Vertex_handle Vertex_handle;
   typedef Triangulation::Face_handle Face_handle;
   typedef Triangulation::Finite_vertices_iterator Finite_vertices_iterator;
+  typedef Triangulation::Vertex_circulator Vertex_circulator;
   typedef Triangulation::Line_face_circulator Line_face_circulator;
   typedef Triangulation::All_faces_iterator All_faces_iterator;
   typedef enum {
@@ -51,9 +67,11 @@ private:
     _COLOR_TABLE_ABSOLUTE,
     _COLOR_TABLE_SPHERE_MAP
   } _ColorTableType;
+  typedef struct {
+    GLveci quadi;
+    bool is_drawn; // copied from the back buffer before compositing
+  } _Damage;
   
-  static GLboolean _setup_non_overlay_texture_cb(void *data,
-                                                 GLboolean test_proxy);
   static GLboolean _setup_overlay_texture_cb(void *data,
                                              GLboolean test_proxy);
   static GLboolean _setup_distance_texture_cb(void *data,
@@ -71,9 +89,17 @@ private:
   
   Triangulation_display *_triangulation_display(void);
   void _remove(Triangulation_display *triangulation_display);
-  void _draw_quad(const GLveci quadi, const GLvecf quadf) const;
+  void _damage(const GLveci quadi, bool is_drawn);
+  void _damage_drawport(void);
+  void _composite(const GLveci quadi, bool is_drawn);
+  void _draw_quad(Tiled_texture *texture, int i, int j, bool is_drawn,
+                  const GLveci quadi, const GLvecf quadf) const;
   void _remove_erased_triangulation_vertices(void);
+  // reconstructs the whole curve unless it is current
   void _reconstruct_curve(void);
+  // keeps the curve current after the vertices of a stroke were inserted,
+  // or the neighbors of erased vertices reconnected
+  void _update_curve(std::vector<Vertex_handle>& changed_vertices);
   void _gather_marked_triangulation_faces(void);
   
   Application *_application;
@@ -83,10 +109,11 @@ private:
   Vec2i _size;
   GLvecf _background_color;
   GLveci _viewport, _drawport, _drawbox;
-  bool _is_drawing_stroke, _is_marking_stroke;
+  bool _is_marking_stroke;
   bool _has_just_been_cleared, _has_changed;
+  bool _is_curve_current; // face flags up to date, marks aside
   bool _are_textures_and_lists_set;
-  GLtexture *_front_texture, *_back_first_texture, *_back_second_texture;
+  Tiled_texture *_front_texture, *_back_first_texture, *_back_second_texture;
   GLtexture *_overlay_texture, *_distance_texture;
   GLlist *_first_pass_list, *_second_pass_list;
   GLlist *_back_first_color_table_list, *_back_second_color_table_list;
@@ -96,6 +123,8 @@ private:
   GLframebuf *_colorbuf, *_back_colorbuf, *_stencilbuf, *_overlay_image;
   GLitembuf *_itembuf;
   _ColorTableType _back_first_type, _back_second_type, _distance_type;
+  std::vector<_Damage> _damages;
+  unsigned long _composited_area;
   double _euclidean_distance_max;
 };
 
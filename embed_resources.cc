@@ -0,0 +1,205 @@
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/*
+ * Build tool writing the C source of the resources embedded in relief:
+ *   embed_resources rgb/gooch.bw xpm/pencil.xpm ... > embedded_resources.c
+ * SGI images are decoded here, so that relief starts without reading or
+ * decoding them. XPM images are copied as is.
+ */
+
+static const unsigned int SGI_HEADER_SIZE = 512;
+static const unsigned int BYTES_PER_LINE = 12;
+
+static unsigned int
+get_big_endian(const vector<unsigned char>& data, unsigned int i, int n) {
+  unsigned int value = 0;
+  for (int j = 0; j < n; j++) {
+    value = (value << 8) | data[i + j];
+  }
+  return value;
+}
+
+static bool
+read_file(const char *name, vector<unsigned char>& data) {
+  ifstream fin(name, ios::in | ios::binary);
+  if (!fin.is_open()) {
+    cerr << "Error: unable to open file " << name << "!" << endl;
+    return false;
+  }
+  data.assign(istreambuf_iterator<char>(fin), istreambuf_iterator<char>());
+  return true;
+}
+
+// pixels are interleaved and stored from the bottom row up, as
+// gl_framebuf_sread stores them
+static bool
+decode_sgi(const char *name, const vector<unsigned char>& data,
+           unsigned int& width, unsigned int& height,
+           unsigned int& components, vector<unsigned char>& pixels) {
+  if (data.size() < SGI_HEADER_SIZE || get_big_endian(data, 0, 2) != 474) {
+    cerr << "Error: " << name << " is not an SGI image!" << endl;
+    return false;
+  }
+  unsigned int storage = data[2], bytes_per_channel = data[3];
+  width = get_big_endian(data, 6, 2);
+  height = get_big_endian(data, 8, 2);
+  components = get_big_endian(data, 10, 2);
+  if (bytes_per_channel != 1 || storage > 1) {
+    cerr << "Error: unsupported SGI image " << name << "!" << endl;
+    return false;
+  }
+  pixels.assign(width * height * components, 0);
+  unsigned int rows = height * components;
+  for (unsigned int z = 0; z < components; z++) {
+    for (unsigned int y = 0; y < height; y++) {
+      unsigned int row = y + z * height;
+      unsigned int i, end;
+      if (storage == 0) {
+        i = SGI_HEADER_SIZE + row * width;
+        end = i + width;
+      } else {
+        i = get_big_endian(data, SGI_HEADER_SIZE + 4 * row, 4);
+        end = i + get_big_endian(data, SGI_HEADER_SIZE + 4 * (rows + row),
+                                 4);
+      }
+      if (end > data.size()) {
+        cerr << "Error: truncated SGI image " << name << "!" << endl;
+        return false;
+      }
+      unsigned int x = 0;
+      while (i < end && x < width) {
+        if (storage == 0) {
+          pixels[(y * width + x++) * components + z] = data[i++];
+          continue;
+        }
+        unsigned int count = data[i] & 0x7f;
+        bool is_literal = (data[i++] & 0x80) != 0;
+        if (count == 0) break;
+        for (unsigned int k = 0; k < count && x < width; k++) {
+          if (i >= end) {
+            cerr << "Error: truncated SGI image " << name << "!" << endl;
+            return false;
+          }
+          pixels[(y * width + x++) * components + z] = data[i];
+          if (is_literal) i++;
+        }
+        if (!is_literal) i++;
+      }
+    }
+  }
+  return true;
+}
+
+// string literals of the XPM array, tabs escaped
+static bool
+parse_xpm(const char *name, const vector<unsigned char>& data,
+          vector<string>& lines) {
+  string text(data.begin(), data.end());
+  string::size_type i = text.find('{');
+  while (i != string::npos &&
+         (i = text.find_first_of("\"}", i + 1)) != string::npos &&
+         text[i] == '"') {
+    string::size_type end = text.find('"', i + 1);
+    if (end == string::npos) break;
+    string line;
+    for (string::size_type j = i + 1; j < end; j++) {
+      line += (text[j] == '\t') ? string("\\t") : string(1, text[j]);
+    }
+    lines.push_back(line);
+    i = end;
+  }
+  if (lines.empty()) {
+    cerr << "Error: " << name << " is not an XPM image!" << endl;
+    return false;
+  }
+  return true;
+}
+
+// rgb/gooch.bw gives RGB_GOOCH_BW
+static string
+identifier(const string& name) {
+  string id;
+  for (string::size_type i = 0; i < name.size(); i++) {
+    char c = name[i];
+    id += (isalnum((unsigned char) c)) ? (char) toupper((unsigned char) c)
+                                       : '_';
+  }
+  return id;
+}
+
+int
+main(int argc, char **argv) {
+  if (argc < 2) {
+    cerr << "Usage: embed_resources file..." << endl;
+    return 1;
+  }
+  cout << "/* Generated by embed_resources, do not edit. */" << endl
+       << endl
+       << "#include <stdlib.h>" << endl
+       << endl
+       << "#include \"embedded_resources.h\"" << endl;
+  
+  vector<string> entries;
+  for (int a = 1; a < argc; a++) {
+    string name = argv[a];
+    for (string::size_type i = 0; i < name.size(); i++) {
+      if (name[i] == '\\') name[i] = '/';
+    }
+    string id = identifier(name);
+    vector<unsigned char> data;
+    if (!read_file(argv[a], data)) {
+      return 1;
+    }
+    char entry[256];
+    if (name.size() > 4 && name.substr(name.size() - 4) == ".xpm") {
+      vector<string> lines;
+      if (!parse_xpm(argv[a], data, lines)) {
+        return 1;
+      }
+      cout << endl << "static const char *" << id << "[] = {" << endl;
+      for (unsigned int i = 0; i < lines.size(); i++) {
+        cout << "  \"" << lines[i] << "\""
+             << ((i + 1 < lines.size()) ? "," : "") << endl;
+      }
+      cout << "};" << endl;
+      sprintf(entry, "  {\"%s\", 0, 0, 0, NULL, %s}",
+              name.c_str(), id.c_str());
+    } else {
+      unsigned int width, height, components;
+      vector<unsigned char> pixels;
+      if (!decode_sgi(argv[a], data, width, height, components, pixels)) {
+        return 1;
+      }
+      cout << endl << "static const unsigned char " << id << "[] = {";
+      for (unsigned int i = 0; i < pixels.size(); i++) {
+        char byte[8];
+        sprintf(byte, "0x%02x", pixels[i]);
+        cout << ((i % BYTES_PER_LINE == 0) ? "\n  " : " ") << byte
+             << ((i + 1 < pixels.size()) ? "," : "");
+      }
+      cout << endl << "};" << endl;
+      sprintf(entry, "  {\"%s\", %u, %u, %u, %s, NULL}",
+              name.c_str(), width, height, components, id.c_str());
+    }
+    entries.push_back(entry);
+  }
+  
+  cout << endl << "const Embedded_resource EMBEDDED_RESOURCES[] = {" << endl;
+  for (unsigned int i = 0; i < entries.size(); i++) {
+    cout << entries[i] << ((i + 1 < entries.size()) ? "," : "") << endl;
+  }
+  cout << "};" << endl
+       << endl
+       << "const unsigned int EMBEDDED_RESOURCES_NUMBER = "
+       << entries.size() << ";" << endl;
+  return 0;
+}
@@ -0,0 +1,3019 @@
+/* Generated by embed_resources, do not edit. */
+
+#include <stdlib.h>
+
+#include "embedded_resources.h"
+
+static const unsigned char RGB_GOOCH_BW[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+  0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
+  0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88,
+  0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
+  0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x88,
+  0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa,
+  0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99,
+  0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0x99,
+  0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88,
+  0x88, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99,
+  0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xdd, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99,
+  0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88,
+  0x88, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd, 0xee, 0xee,
+  0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99,
+  0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff,
+  0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xdd, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99,
+  0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88,
+  0x88, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xdd, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xee, 0xee, 0xee, 0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa,
+  0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99,
+  0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99,
+  0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+  0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
+  0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
+  0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+  0xcc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+  0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xbb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
+};
+
+static const unsigned char RGB_OVERLAY_BW[] = {
+  0xd1, 0xd4, 0xd9, 0xf1, 0xda, 0xcc, 0xac, 0xcf, 0x9f, 0x6d, 0x86, 0x9c,
+  0x6e, 0x72, 0x72, 0x91, 0x65, 0xa4, 0xb5, 0xe3, 0x9e, 0x98, 0x7b, 0xdd,
+  0xbc, 0xcc, 0xb1, 0xc2, 0xda, 0xc9, 0x9b, 0x5b, 0xae, 0x7c, 0x9a, 0x8a,
+  0x48, 0x4b, 0x69, 0xa9, 0x2d, 0x3f, 0x25, 0xae, 0x72, 0xbe, 0xeb, 0xa6,
+  0x91, 0x97, 0xa8, 0x80, 0xb6, 0x8a, 0x7e, 0x5d, 0x74, 0x96, 0xbe, 0x6f,
+  0x71, 0x61, 0x90, 0xb6, 0xc9, 0xc7, 0xd7, 0x7f, 0x92, 0xa7, 0x76, 0xa6,
+  0xc4, 0xa6, 0x48, 0xa3, 0x93, 0x7d, 0x69, 0x6c, 0x88, 0xda, 0x9b, 0xda,
+  0x9a, 0x6c, 0x8a, 0xca, 0xd7, 0xa9, 0xa7, 0x97, 0x4b, 0x58, 0x2e, 0x8f,
+  0xae, 0xc1, 0xee, 0x94, 0x86, 0xa1, 0x82, 0x5b, 0x4d, 0x92, 0x84, 0xab,
+  0xb2, 0x90, 0x93, 0x56, 0x4c, 0x7e, 0x92, 0x6c, 0xc2, 0x8a, 0x73, 0x79,
+  0x90, 0x74, 0x6e, 0x7e, 0xbb, 0xbe, 0xc4, 0xc7, 0xad, 0xbe, 0x81, 0xa0,
+  0xc8, 0x98, 0xa5, 0x99, 0xc0, 0xa6, 0x96, 0xce, 0xa3, 0x83, 0x65, 0x7f,
+  0x99, 0xb8, 0x9a, 0xb8, 0x82, 0xa2, 0x7e, 0x73, 0xc2, 0xde, 0xcc, 0x93,
+  0xca, 0xe4, 0xd3, 0x99, 0x7e, 0x9f, 0xe6, 0xce, 0x61, 0x7a, 0x71, 0x8c,
+  0x56, 0x85, 0x97, 0x7d, 0x81, 0x7b, 0xbc, 0x8a, 0xb6, 0xab, 0x9c, 0xa0,
+  0xa6, 0xad, 0x9d, 0x5d, 0x30, 0x4a, 0xd7, 0xd2, 0x84, 0xc6, 0x68, 0x53,
+  0x78, 0x5d, 0xb4, 0x9f, 0x62, 0xa8, 0xa0, 0xca, 0xc3, 0x9d, 0x89, 0x43,
+  0xcd, 0x94, 0x5d, 0xa2, 0xbc, 0xb9, 0xa8, 0x9f, 0xaa, 0x76, 0xad, 0x7d,
+  0xd7, 0xdc, 0xcc, 0xa3, 0x6c, 0x7c, 0x52, 0xb6, 0x9a, 0x87, 0xcd, 0xcc,
+  0x77, 0x3b, 0x74, 0xce, 0x9f, 0x65, 0xba, 0x75, 0xab, 0xca, 0xa6, 0xb1,
+  0xb8, 0xc5, 0xb1, 0x9e, 0x47, 0x8b, 0x96, 0x61, 0x4c, 0xc0, 0xeb, 0xbb,
+  0x6a, 0x7f, 0x79, 0x59, 0xad, 0xb8, 0x86, 0x7c, 0xa5, 0xa3, 0x48, 0x27,
+  0x3d, 0x5c, 0x9b, 0xd1, 0xf2, 0xc7, 0x7d, 0x7f, 0x6c, 0xa5, 0x90, 0x76,
+  0xb6, 0xa3, 0xa3, 0xc3, 0x87, 0x9e, 0x8e, 0x90, 0xb3, 0xe0, 0xc7, 0x91,
+  0xc9, 0x69, 0xaa, 0xc4, 0xd9, 0x63, 0x78, 0x89, 0x8c, 0x9b, 0xbd, 0x94,
+  0xcc, 0x82, 0x99, 0x9b, 0x9a, 0xb1, 0xdf, 0xa3, 0x7c, 0x92, 0xeb, 0xcf,
+  0xaa, 0xc5, 0x89, 0xc3, 0x9f, 0xb8, 0xd0, 0xe7, 0xdd, 0xa2, 0x76, 0xe1,
+  0x78, 0x74, 0x39, 0x9a, 0xc4, 0xa5, 0xce, 0xb0, 0xa2, 0xb9, 0xc8, 0xe7,
+  0xa4, 0xa2, 0xc1, 0x9e, 0xaf, 0x7b, 0x9e, 0x5c, 0xc2, 0xbc, 0xb2, 0xc7,
+  0x73, 0x41, 0x4c, 0xd8, 0x9d, 0x9a, 0xc7, 0xf2, 0xea, 0x99, 0x7e, 0x75,
+  0xa2, 0x72, 0x80, 0xdb, 0xdf, 0xb4, 0xad, 0x8e, 0x64, 0xad, 0x99, 0x99,
+  0x80, 0x67, 0x47, 0x9f, 0xcf, 0x7f, 0x7a, 0xc8, 0x98, 0x74, 0x84, 0x8c,
+  0x50, 0xa4, 0xa3, 0xba, 0xdd, 0xca, 0xab, 0x67, 0xb9, 0xab, 0x9b, 0xde,
+  0xe3, 0xf7, 0xbc, 0x9f, 0xa8, 0x78, 0x88, 0x93, 0xb6, 0xcf, 0x70, 0xb1,
+  0xc1, 0xde, 0xb9, 0xd7, 0xc9, 0xd4, 0xd8, 0x96, 0x99, 0x7d, 0x9b, 0xc5,
+  0x9d, 0x95, 0x5a, 0x8d, 0xc1, 0xd9, 0x9e, 0x80, 0xba, 0xcd, 0x9f, 0xd2,
+  0x6d, 0x56, 0x4d, 0x7b, 0x86, 0xa3, 0xaf, 0xcf, 0x9c, 0xb6, 0xb4, 0xc9,
+  0xb1, 0xb1, 0x92, 0x94, 0xc0, 0x7c, 0x77, 0xd1, 0xd1, 0xb1, 0x7b, 0x40,
+  0xba, 0xce, 0x95, 0xd5, 0xb0, 0x8f, 0x90, 0xb3, 0xc5, 0x5c, 0xca, 0xd5,
+  0xc2, 0x90, 0x5c, 0x82, 0xaf, 0xb9, 0xe2, 0xb4, 0xc1, 0xa1, 0xa3, 0xa5,
+  0xb2, 0x75, 0x59, 0xa9, 0xd3, 0xeb, 0xc8, 0x95, 0xa8, 0x8a, 0x5e, 0xaa,
+  0xc1, 0xad, 0x9a, 0xbf, 0x4f, 0x59, 0xb4, 0xc9, 0xd2, 0xa3, 0xa8, 0x8a,
+  0x9d, 0xab, 0xab, 0x64, 0xb8, 0x85, 0x67, 0x6a, 0xa1, 0xc5, 0xd1, 0xba,
+  0xd3, 0xd8, 0x87, 0x50, 0xb3, 0x7d, 0xa2, 0xc2, 0xab, 0xdc, 0xe9, 0xab,
+  0xa6, 0x90, 0xa4, 0xa8, 0x55, 0x7e, 0x7f, 0xb7, 0xb3, 0xcd, 0xb1, 0xc2,
+  0xb8, 0xcb, 0xa8, 0x35, 0x67, 0xaf, 0xea, 0xce, 0xbb, 0x73, 0x84, 0x53,
+  0xbb, 0x89, 0xa8, 0x4f, 0x85, 0xda, 0x88, 0xcb, 0xd8, 0x94, 0x38, 0x68,
+  0x53, 0x77, 0xb2, 0xb5, 0xa7, 0x6e, 0xcb, 0x7a, 0x4a, 0x9a, 0xd8, 0x9c,
+  0x8e, 0x75, 0x8a, 0xb4, 0xd8, 0x7f, 0x64, 0x39, 0x84, 0x9e, 0x93, 0xdb,
+  0xcc, 0x54, 0xb2, 0xaa, 0xdc, 0x86, 0xc4, 0xac, 0x67, 0x41, 0x38, 0x47,
+  0x4b, 0x9d, 0xc0, 0xa7, 0x9d, 0xd2, 0xdd, 0x77, 0x88, 0xc6, 0x31, 0x57,
+  0x9c, 0xdb, 0xa1, 0x38, 0x57, 0xd3, 0x9f, 0x7d, 0x66, 0x6b, 0xcb, 0xd2,
+  0xe1, 0x9b, 0x98, 0xc4, 0xbb, 0xc0, 0xc0, 0x9a, 0x9c, 0xb4, 0xaf, 0x7b,
+  0xb6, 0xab, 0x83, 0x98, 0xa8, 0xdb, 0xa9, 0x78, 0xcd, 0x9e, 0x9f, 0x36,
+  0xcf, 0x80, 0x6e, 0x61, 0xa3, 0x9c, 0xc6, 0xb8, 0x4b, 0x44, 0x70, 0x97,
+  0xc8, 0x90, 0x82, 0x93, 0x65, 0x7e, 0xa9, 0xae, 0x89, 0xcd, 0xd7, 0x74,
+  0x27, 0x59, 0xa8, 0xdd, 0xcb, 0xa8, 0xa5, 0xb4, 0xe7, 0xdc, 0x98, 0x9f,
+  0x5e, 0xbe, 0x85, 0x69, 0x93, 0x8b, 0xb2, 0x8a, 0xbb, 0x80, 0x65, 0xc9,
+  0xb9, 0xa9, 0xa3, 0xba, 0xa3, 0x97, 0xa1, 0x92, 0x86, 0x5a, 0x72, 0x7c,
+  0xae, 0x79, 0x9a, 0x89, 0xb8, 0xa9, 0x6a, 0xd4, 0xdd, 0xa7, 0x82, 0x7b,
+  0xd7, 0xab, 0x82, 0xc6, 0xa4, 0x5f, 0x70, 0x75, 0x57, 0x27, 0x88, 0xa4,
+  0x77, 0x50, 0xac, 0xd0, 0xa2, 0xb9, 0xb2, 0xa6, 0x63, 0x6e, 0xce, 0xca,
+  0x86, 0xaa, 0x6d, 0xb0, 0x8d, 0x6d, 0xbe, 0x9d, 0x9b, 0xe8, 0xc0, 0xab,
+  0x82, 0x8d, 0x99, 0x51, 0x34, 0xdb, 0x74, 0xde, 0xc3, 0xd9, 0x73, 0xbc,
+  0x76, 0xa7, 0xa7, 0xa5, 0xa8, 0xd9, 0x71, 0x1a, 0x79, 0x9b, 0x67, 0x60,
+  0x42, 0xbf, 0xc5, 0xdf, 0x85, 0x64, 0x86, 0x92, 0xab, 0xba, 0xa2, 0x8c,
+  0xb5, 0x73, 0xde, 0xba, 0x99, 0x5a, 0x83, 0x9e, 0x91, 0x32, 0x4d, 0xa2,
+  0x9c, 0xa6, 0x4e, 0x55, 0x9c, 0xbb, 0xdb, 0xd7, 0x90, 0x92, 0xd4, 0xd0,
+  0xb6, 0x50, 0x5b, 0xa0, 0xde, 0xb7, 0xe6, 0xd5, 0xc8, 0xc0, 0x96, 0xc1,
+  0xa7, 0xb6, 0x62, 0x8e, 0x5f, 0x66, 0xae, 0x70, 0x89, 0xb3, 0x91, 0xbe,
+  0x8a, 0xa8, 0x8c, 0xa9, 0xc0, 0x9e, 0x8f, 0x35, 0x52, 0xe0, 0xb4, 0x70,
+  0x70, 0x8d, 0x68, 0xc0, 0x76, 0x26, 0x23, 0x8a, 0x5d, 0x77, 0x66, 0x60,
+  0x88, 0x9b, 0xd9, 0x8b, 0x75, 0xa0, 0xda, 0xbf, 0xdb, 0x8e, 0x86, 0x92,
+  0xb9, 0x62, 0x65, 0xac, 0x70, 0x7b, 0xdc, 0xaa, 0xb7, 0xd3, 0xaa, 0xb9,
+  0x7e, 0x9b, 0x77, 0x2e, 0x90, 0xd2, 0xad, 0x56, 0x50, 0x52, 0xca, 0xb3,
+  0xb0, 0xd6, 0xcf, 0x55, 0x6e, 0xa5, 0x7e, 0xa8, 0x43, 0x7b, 0xbc, 0xd1,
+  0xb3, 0x6e, 0x94, 0xbc, 0x7c, 0xd5, 0xad, 0x86, 0xb6, 0xdc, 0xde, 0xd3,
+  0xba, 0x58, 0x22, 0x6d, 0x6d, 0xac, 0xc8, 0x97, 0x6b, 0x7c, 0x2a, 0x3f,
+  0xac, 0x63, 0xc7, 0x8a, 0x5c, 0x3d, 0xac, 0xbd, 0x61, 0xaa, 0x78, 0x80,
+  0x97, 0xac, 0xb4, 0xa6, 0xad, 0xb5, 0xad, 0x7d, 0x57, 0x6a, 0x6a, 0x6e,
+  0xcc, 0xb0, 0xa5, 0xa6, 0x90, 0x67, 0x49, 0xb5, 0x83, 0xad, 0xba, 0xbf,
+  0xb0, 0x8f, 0x5e, 0xa6, 0xab, 0x44, 0x65, 0x95, 0x9e, 0x5a, 0x71, 0x90,
+  0x9e, 0x83, 0x4b, 0x8e, 0xc6, 0xbe, 0xb0, 0x44, 0x4b, 0xaa, 0x8d, 0xd3,
+  0x97, 0x6e, 0x62, 0x6e, 0xa5, 0xe6, 0x7e, 0x53, 0x8e, 0xc4, 0xc7, 0xca,
+  0xd4, 0x86, 0x5d, 0x70, 0x90, 0xb0, 0x89, 0x61, 0x8a, 0x4d, 0x6c, 0x15,
+  0x44, 0x74, 0xa7, 0xd9, 0x9f, 0x9b, 0xa5, 0xc0, 0xa7, 0xb0, 0xb0, 0xbf,
+  0xcd, 0xcb, 0x94, 0xd6, 0x8d, 0xb8, 0xe4, 0xeb, 0xdf, 0xd0, 0xc4, 0xaa,
+  0x9c, 0xdc, 0xc8, 0x7c, 0x68, 0x9d, 0xc4, 0xb7, 0x9b, 0x64, 0x4f, 0x84,
+  0x7f, 0x80, 0xa6, 0xac, 0x9d, 0xa9, 0x94, 0x35, 0x6a, 0x6e, 0x8c, 0x70,
+  0x5a, 0x62, 0x60, 0x8b, 0x80, 0x5e, 0x9f, 0xcf, 0xaa, 0x9f, 0x9e, 0xd4,
+  0x9d, 0x7f, 0xa2, 0x91, 0x6d, 0x79, 0x73, 0x52, 0x97, 0xa4, 0xdc, 0xb7,
+  0xc7, 0xd2, 0x92, 0x86, 0x80, 0x6f, 0xac, 0xbf, 0x8e, 0x81, 0x79, 0x50,
+  0xac, 0x95, 0xbb, 0x7f, 0x60, 0x5f, 0x68, 0x71, 0x49, 0xa4, 0xb8, 0x9e,
+  0xa3, 0xb5, 0xb0, 0xa0, 0x72, 0x54, 0x62, 0x82, 0xaf, 0xbc, 0x93, 0x4a,
+  0x35, 0xdd, 0xb7, 0x5f, 0x4b, 0x63, 0xc6, 0xa8, 0x91, 0xaf, 0x74, 0x64,
+  0x33, 0xbd, 0x77, 0x38, 0x83, 0x72, 0x6c, 0xa8, 0x80, 0x85, 0x7b, 0x6f,
+  0x6d, 0xb0, 0xcc, 0xe1, 0xb8, 0xcf, 0x8d, 0x6d, 0x80, 0x81, 0x9e, 0xb1,
+  0x93, 0x33, 0xdc, 0xb3, 0xcc, 0xb9, 0xc2, 0x99, 0x60, 0xa1, 0xca, 0x99,
+  0x5f, 0x74, 0xd0, 0xa0, 0x56, 0x79, 0x44, 0x86, 0x7e, 0x3e, 0x0e, 0x96,
+  0x68, 0x5a, 0xd7, 0x68, 0x6b, 0xba, 0x7f, 0x85, 0x80, 0xa4, 0xa1, 0x6c,
+  0x61, 0x50, 0xb4, 0xb5, 0x8d, 0xda, 0xd2, 0xc8, 0xe0, 0xdd, 0xac, 0x97,
+  0x5d, 0xa0, 0x99, 0xa5, 0x44, 0x45, 0x8f, 0x7d, 0x80, 0x31, 0x2a, 0x50,
+  0x54, 0x47, 0x28, 0x97, 0xb2, 0xc2, 0xb9, 0xb0, 0xa9, 0xd7, 0xec, 0xbc,
+  0x77, 0x6e, 0x44, 0x2b, 0x2e, 0x32, 0x82, 0xc6, 0xaf, 0x78, 0xb4, 0xc5,
+  0x6e, 0x15, 0x2b, 0x96, 0xe0, 0xb3, 0xa0, 0x80, 0x58, 0xb9, 0x69, 0xb5,
+  0x9b, 0x43, 0x83, 0x93, 0x3f, 0x2e, 0xaa, 0x9e, 0x74, 0x4a, 0x83, 0x48,
+  0x64, 0xa9, 0x9c, 0xa9, 0xa9, 0xa5, 0x7d, 0x3e, 0x3e, 0x3f, 0x67, 0xd2,
+  0xe2, 0xba, 0xa6, 0x4f, 0x5b, 0x2e, 0x7e, 0x93, 0xcf, 0x7c, 0x58, 0x8e,
+  0xa3, 0xa3, 0xaa, 0xc2, 0x8e, 0x9c, 0xaf, 0x9c, 0x74, 0x44, 0x8b, 0x86,
+  0xb1, 0xca, 0xc7, 0x90, 0xa2, 0xb7, 0x61, 0xae, 0xcd, 0xb8, 0xd8, 0xcd,
+  0xab, 0xa4, 0xa9, 0x9a, 0xcc, 0x7a, 0x77, 0xa1, 0x91, 0x4c, 0x9e, 0xd9,
+  0x65, 0xcb, 0xce, 0x9a, 0x79, 0xa8, 0xae, 0xb8, 0x7f, 0x9f, 0xa6, 0xcd,
+  0xcc, 0x80, 0x6f, 0x73, 0x8f, 0x8c, 0x29, 0x39, 0x76, 0x59, 0x54, 0x4b,
+  0x48, 0x7a, 0x8f, 0xb4, 0x8a, 0x9d, 0xcc, 0xc8, 0xb2, 0x6e, 0x5a, 0xa1,
+  0xc3, 0x7e, 0x53, 0x42, 0x75, 0x49, 0x84, 0x85, 0x9c, 0xa2, 0x33, 0x4a,
+  0xaa, 0xbc, 0xd3, 0xac, 0xa2, 0x95, 0x76, 0x93, 0x87, 0x6a, 0x66, 0x83,
+  0xa3, 0x3e, 0x91, 0x84, 0xa2, 0x57, 0x56, 0xc7, 0x7c, 0xcc, 0x9f, 0x6e,
+  0x5d, 0xc5, 0xb6, 0xa1, 0x35, 0x6c, 0xb4, 0x9a, 0xbd, 0x9a, 0xce, 0xae,
+  0x6a, 0x3d, 0x2d, 0x75, 0x9a, 0xcd, 0xc3, 0xa3, 0xc2, 0x81, 0x43, 0xaf,
+  0x7b, 0x8a, 0xbe, 0xa5, 0x5b, 0x5c, 0x9a, 0xbb, 0xaa, 0x9c, 0xd2, 0xc5,
+  0xaa, 0xc1, 0x8c, 0x82, 0x9b, 0x93, 0xb4, 0xb1, 0x9c, 0x8a, 0x6d, 0x9c,
+  0xa0, 0x68, 0xad, 0xa3, 0xd3, 0x8a, 0x7b, 0xbc, 0x9d, 0x8a, 0xe9, 0xf0,
+  0xab, 0x3d, 0x60, 0xa8, 0xcd, 0x67, 0x83, 0xc3, 0xc7, 0xb3, 0x76, 0x61,
+  0x4f, 0x85, 0xae, 0xa3, 0xad, 0x67, 0x57, 0x90, 0xca, 0x6c, 0x89, 0x5f,
+  0x82, 0x53, 0x6a, 0x70, 0x88, 0x7c, 0x90, 0x62, 0x4f, 0x9c, 0x4d, 0x28,
+  0x43, 0x67, 0xc7, 0xcf, 0x95, 0xb3, 0x8d, 0x86, 0x7f, 0x4c, 0x93, 0xc0,
+  0xc1, 0xc5, 0xbc, 0x88, 0xab, 0xa3, 0xb2, 0xc1, 0xc8, 0x79, 0x64, 0x98,
+  0x65, 0xa2, 0xb4, 0xd8, 0xaa, 0x91, 0xba, 0x8e, 0x74, 0x94, 0xa2, 0x65,
+  0x82, 0x95, 0x41, 0x84, 0xbf, 0xb6, 0x7c, 0xd0, 0xa4, 0x5d, 0x91, 0x8f,
+  0xb8, 0x8a, 0x88, 0xe0, 0xa8, 0xbb, 0x8b, 0xd1, 0xbd, 0x31, 0xb8, 0xa3,
+  0xd2, 0xe3, 0xe5, 0xdb, 0xc7, 0x6d, 0x95, 0xdc, 0xad, 0x8f, 0x7c, 0x85,
+  0x83, 0xca, 0xc6, 0xad, 0x8c, 0x77, 0x2f, 0x67, 0x99, 0x50, 0x16, 0x68,
+  0x8a, 0xe2, 0x93, 0x7a, 0x86, 0x31, 0x7c, 0xee, 0xf3, 0xb4, 0x84, 0xbb,
+  0xd1, 0xe3, 0x80, 0x8b, 0x88, 0x98, 0x9f, 0x70, 0x70, 0xa0, 0x3f, 0x54,
+  0xab, 0xc7, 0xb9, 0x8d, 0xcf, 0xb7, 0x9c, 0x85, 0x5c, 0x6e, 0x95, 0x58,
+  0x77, 0x91, 0x95, 0x99, 0x93, 0x33, 0x72, 0x69, 0x8a, 0xab, 0xa0, 0xa5,
+  0xa7, 0xc8, 0xdd, 0xa9, 0x5c, 0xbc, 0x6b, 0x53, 0xc6, 0x9b, 0x9f, 0x7a,
+  0x61, 0x6b, 0x7f, 0x77, 0xaa, 0xb6, 0x79, 0xaa, 0xbe, 0x89, 0xba, 0xca,
+  0xd7, 0xd6, 0xcc, 0x6a, 0x75, 0x6c, 0xda, 0xc9, 0x74, 0x9c, 0xc8, 0x91,
+  0xca, 0xa0, 0x8f, 0x86, 0x7a, 0xb0, 0x3e, 0xa8, 0x79, 0x9e, 0x48, 0xb8,
+  0xb5, 0xca, 0xb9, 0xa0, 0xa2, 0x88, 0xbf, 0xb5, 0x84, 0xa6, 0xca, 0xbe,
+  0xeb, 0xd5, 0xbf, 0xb2, 0xd0, 0xc7, 0x92, 0x83, 0x65, 0x85, 0xd1, 0xce,
+  0xa5, 0x8e, 0x0b, 0x42, 0xa2, 0xd2, 0x82, 0x8f, 0x5a, 0xcd, 0xda, 0xb3,
+  0x74, 0x2a, 0x18, 0xa7, 0xcb, 0xe0, 0x8e, 0x6f, 0x76, 0xe3, 0xae, 0x9e,
+  0xc3, 0x97, 0xa0, 0x66, 0x5f, 0xa0, 0x93, 0x8d, 0x4e, 0xa9, 0x8a, 0x75,
+  0x6c, 0xcd, 0xb6, 0x86, 0x8c, 0x69, 0xb7, 0x9d, 0xba, 0x9d, 0x8c, 0xa1,
+  0xe1, 0x69, 0x8e, 0x83, 0xac, 0xc6, 0xd2, 0xc2, 0xa2, 0x98, 0xb6, 0xc4,
+  0x83, 0x9f, 0xb4, 0x9e, 0x82, 0x9c, 0x6a, 0xbc, 0x8b, 0xc5, 0x8c, 0xaa,
+  0x34, 0xb8, 0xb6, 0xb5, 0x7e, 0x5e, 0x60, 0xac, 0xd1, 0xaa, 0xc5, 0xb7,
+  0xbb, 0x99, 0xad, 0xb4, 0xa9, 0x68, 0x96, 0x51, 0xb1, 0xc4, 0x76, 0x5c,
+  0x4f, 0x77, 0x81, 0x77, 0xcc, 0x86, 0x64, 0x3b, 0x8c, 0xd0, 0xe0, 0xa0,
+  0x93, 0x97, 0xbe, 0xbd, 0x62, 0x7f, 0x95, 0x62, 0xbb, 0xe2, 0xa5, 0x8d,
+  0x7f, 0xce, 0xdc, 0xda, 0xc5, 0x79, 0x9a, 0xcd, 0xd9, 0xab, 0x38, 0x60,
+  0x30, 0x69, 0xa4, 0x9b, 0x96, 0xc7, 0xe8, 0xd5, 0xcd, 0xb4, 0xcb, 0x8d,
+  0xab, 0xcc, 0x97, 0x16, 0x2c, 0xab, 0xf0, 0xca, 0x82, 0x91, 0x36, 0x21,
+  0x48, 0xaf, 0x7f, 0x7e, 0x9b, 0xa2, 0xa8, 0x7c, 0x8c, 0x93, 0x51, 0x3c,
+  0xc6, 0x3b, 0x7c, 0x56, 0x61, 0xa2, 0xad, 0xc2, 0xd9, 0xc3, 0x70, 0x96,
+  0xd5, 0xb6, 0xc0, 0xd0, 0xa2, 0x95, 0x6a, 0x94, 0x6e, 0x32, 0x62, 0xc6,
+  0xa0, 0x98, 0x63, 0xbc, 0xc5, 0xa6, 0x93, 0x99, 0x8b, 0x52, 0x9b, 0xe3,
+  0xd8, 0xa5, 0x5c, 0x18, 0x70, 0x99, 0xa9, 0xc2, 0xde, 0xbb, 0xab, 0x7d,
+  0x80, 0x91, 0xb2, 0x9b, 0x79, 0xd0, 0xa7, 0x51, 0xb6, 0xc7, 0xa7, 0x68,
+  0x92, 0x9c, 0x6d, 0x7c, 0x5c, 0xac, 0x94, 0xa7, 0x95, 0x78, 0x93, 0xdb,
+  0xe4, 0xd9, 0xcf, 0x94, 0xa9, 0xe5, 0xc5, 0xcb, 0x91, 0x7c, 0x5c, 0xae,
+  0x77, 0x7a, 0x82, 0x91, 0x92, 0xc1, 0xb5, 0xaa, 0xe1, 0x85, 0xc9, 0xc0,
+  0xc3, 0x95, 0xb7, 0xa7, 0x7e, 0x7a, 0x76, 0x98, 0xbc, 0x9d, 0x9a, 0xab,
+  0x95, 0x64, 0x99, 0x94, 0xd5, 0xb5, 0x93, 0x36, 0x7e, 0xe7, 0xa6, 0xb2,
+  0xad, 0x6c, 0x6d, 0x98, 0xca, 0xb8, 0xa8, 0x9b, 0xbd, 0x95, 0x47, 0x9a,
+  0x33, 0x14, 0x9d, 0xcb, 0x9f, 0xba, 0xcb, 0xa8, 0xe5, 0xb9, 0x78, 0xba,
+  0xba, 0x9c, 0x85, 0x79, 0xbb, 0x65, 0x38, 0x73, 0x93, 0xb7, 0xa5, 0x5b,
+  0x9b, 0xcc, 0x89, 0x69, 0xa3, 0xaa, 0x59, 0x4c, 0x97, 0xe3, 0x98, 0x72,
+  0x95, 0x64, 0xb6, 0xab, 0x9d, 0x89, 0xe5, 0xb5, 0x87, 0x47, 0x98, 0xd4,
+  0xbe, 0xb4, 0x9c, 0x9a, 0x90, 0xb4, 0xc1, 0xbc, 0xad, 0x6e, 0x7e, 0xc3,
+  0x98, 0xa9, 0x9f, 0x80, 0x41, 0x4a, 0x58, 0x83, 0xa5, 0xcc, 0xd6, 0x8e,
+  0x74, 0xde, 0xcf, 0xc7, 0xb3, 0x93, 0xc0, 0xbe, 0x5c, 0x5e, 0xbb, 0x89,
+  0xbe, 0xa4, 0xbc, 0xa7, 0x91, 0x94, 0xb7, 0xcc, 0xae, 0xa4, 0x99, 0xca,
+  0xc3, 0x95, 0x90, 0xb5, 0xa0, 0x97, 0x74, 0xd6, 0xd2, 0xa5, 0xb6, 0x7b,
+  0x98, 0xa4, 0x8f, 0x29, 0x99, 0x9d, 0xc1, 0xb6, 0xc1, 0xc7, 0xaa, 0xb4,
+  0x83, 0xaa, 0x90, 0x8b, 0xbc, 0xbd, 0x76, 0x73, 0xa1, 0x50, 0x4a, 0xc4,
+  0xa4, 0x8e, 0x4a, 0x4d, 0xad, 0xd3, 0x98, 0x5d, 0x73, 0x46, 0x9e, 0x89,
+  0x96, 0xae, 0x4d, 0x4f, 0x72, 0xaf, 0x9c, 0xd1, 0x80, 0x47, 0xbf, 0x8a,
+  0x90, 0xcc, 0xb6, 0x73, 0xc1, 0xcd, 0xb0, 0x9a, 0x6a, 0x74, 0x74, 0x87,
+  0xb2, 0x9e, 0xca, 0xd1, 0xba, 0xa4, 0xc1, 0xa4, 0xb5, 0xde, 0xb8, 0xaf,
+  0xa7, 0xbf, 0xad, 0xbb, 0x87, 0x6c, 0xb6, 0xe2, 0x9e, 0xd3, 0xb7, 0x9e,
+  0x66, 0x57, 0xab, 0x7b, 0x8d, 0xaf, 0xd1, 0xaa, 0x65, 0x92, 0xb3, 0x6f,
+  0x73, 0x6e, 0x65, 0xbb, 0x95, 0xa2, 0x79, 0x88, 0xa1, 0xa2, 0xca, 0x73,
+  0x54, 0x88, 0x7d, 0x80, 0x84, 0xa2, 0x46, 0x4a, 0x67, 0x7f, 0xa0, 0xb3,
+  0xa2, 0xb8, 0x90, 0xa2, 0xe1, 0xbe, 0x74, 0x58, 0x9c, 0xe5, 0xbf, 0x68,
+  0x2f, 0x72, 0x35, 0x6b, 0xa5, 0xb6, 0x90, 0xa3, 0xa8, 0x9f, 0xd6, 0xaf,
+  0xb6, 0xed, 0xd1, 0xd2, 0x83, 0x95, 0x69, 0x3e, 0xac, 0xc1, 0xda, 0x9f,
+  0x79, 0xce, 0xbf, 0x98, 0xa1, 0x77, 0x79, 0x8c, 0x86, 0x97, 0xbc, 0xb2,
+  0x8a, 0x91, 0x1c, 0x6e, 0x82, 0x3f, 0x74, 0x77, 0x3f, 0x66, 0xa2, 0xa5,
+  0x9a, 0xde, 0xe8, 0xcc, 0xaa, 0x88, 0xb8, 0xd7, 0xc0, 0x8e, 0xa8, 0x99,
+  0xd8, 0x96, 0xc5, 0xbe, 0xc5, 0xc0, 0xb2, 0x9b, 0x6c, 0xbe, 0xde, 0xd4,
+  0xd5, 0x6a, 0x35, 0xb1, 0xb2, 0xec, 0x83, 0x78, 0x8d, 0x58, 0x5c, 0xbc,
+  0xbe, 0x95, 0xaa, 0xaa, 0x9d, 0x86, 0x9e, 0x7d, 0xa5, 0x61, 0x2b, 0xb0,
+  0xbc, 0xcf, 0xd5, 0xca, 0xb8, 0xbf, 0xb9, 0x86, 0xbc, 0x82, 0x81, 0x3a,
+  0x8c, 0x8d, 0x4c, 0x6b, 0x9e, 0x7f, 0x6c, 0xca, 0xc9, 0x90, 0x5c, 0x5f,
+  0x9e, 0x83, 0xae, 0x54, 0x73, 0x96, 0xb8, 0xa1, 0x48, 0x27, 0x8e, 0x78,
+  0x8b, 0xbc, 0x8e, 0x4b, 0x75, 0x83, 0xc1, 0xd0, 0x82, 0x88, 0xa0, 0xbb,
+  0xa4, 0x80, 0xa5, 0x72, 0x86, 0xac, 0x74, 0xb2, 0xa3, 0xa5, 0xcd, 0x5c,
+  0x3c, 0xd8, 0xa5, 0x87, 0x96, 0xb4, 0xa4, 0xab, 0xbb, 0xa8, 0x7c, 0x71,
+  0x6a, 0x48, 0x3d, 0x6e, 0xa2, 0xb2, 0xd8, 0xad, 0x81, 0xc8, 0xd7, 0xc2,
+  0xa5, 0x6d, 0x63, 0x7b, 0xaf, 0xd6, 0xb1, 0xae, 0xc9, 0x98, 0x5a, 0xe8,
+  0xae, 0x8a, 0xca, 0xa2, 0x7f, 0x82, 0x9b, 0x98, 0xb8, 0x96, 0x39, 0x3d,
+  0x86, 0x8e, 0xc9, 0x86, 0xaf, 0xcc, 0x51, 0x1c, 0x5e, 0x8f, 0x74, 0x69,
+  0x6b, 0xa2, 0x63, 0x9f, 0xdc, 0xd1, 0x94, 0x95, 0xa9, 0xaf, 0x8a, 0xa9,
+  0xbd, 0xe5, 0xda, 0xe4, 0xdc, 0xe1, 0xa7, 0x56, 0x46, 0x6d, 0x6f, 0x4d,
+  0x86, 0xb5, 0xaf, 0x72, 0xd3, 0xf1, 0xa5, 0x2d, 0x41, 0x7f, 0xc9, 0x97,
+  0x4a, 0x99, 0x41, 0x90, 0x7c, 0x72, 0x86, 0xb2, 0xc5, 0xc3, 0xc9, 0xa7,
+  0x6c, 0x66, 0x93, 0xdb, 0x6e, 0xcc, 0x89, 0x6a, 0x8b, 0x95, 0xe1, 0xba,
+  0xbc, 0xc8, 0x76, 0x5c, 0x8c, 0x91, 0xe0, 0xb8, 0x45, 0x48, 0xab, 0x9b,
+  0xe5, 0xcc, 0x9b, 0x80, 0xaa, 0x93, 0x3c, 0x8b, 0x8d, 0x76, 0x94, 0x50,
+  0x8d, 0x5f, 0x7b, 0x95, 0x5e, 0x72, 0xa2, 0x82, 0x5b, 0xd7, 0xbb, 0xbb,
+  0x90, 0xa8, 0xba, 0xa7, 0x83, 0xb2, 0x85, 0x9a, 0xa2, 0x9c, 0xc5, 0xbf,
+  0x82, 0xa9, 0x64, 0x51, 0x77, 0x85, 0x4c, 0x84, 0x93, 0x6f, 0xba, 0xb5,
+  0xc2, 0xb6, 0xaf, 0x79, 0x28, 0x8d, 0xd2, 0x6e, 0x82, 0xc4, 0x87, 0x74,
+  0xb4, 0xce, 0xc2, 0xc5, 0xaa, 0xc2, 0xb2, 0xa5, 0x84, 0x92, 0x88, 0xac,
+  0x8c, 0x79, 0x75, 0x83, 0x88, 0xc1, 0xd6, 0x9e, 0x70, 0xa2, 0xae, 0x85,
+  0x7a, 0x99, 0xb2, 0x51, 0x12, 0xb8, 0x5b, 0xcd, 0x7f, 0x9a, 0xbd, 0xcc,
+  0x87, 0x4d, 0x98, 0xaa, 0xb4, 0xa0, 0xa0, 0xd1, 0xae, 0xa2, 0x65, 0xcc,
+  0xc7, 0xa9, 0xab, 0x93, 0x5c, 0x6d, 0xe0, 0xbd, 0x88, 0x9e, 0xc2, 0x95,
+  0x9e, 0x55, 0x7a, 0xc4, 0xaa, 0x5b, 0x85, 0xb2, 0xd1, 0xbf, 0x72, 0x4b,
+  0x9d, 0xe0, 0xa3, 0xc1, 0xcd, 0xab, 0x87, 0x78, 0x72, 0xc3, 0x43, 0x69,
+  0xb6, 0xae, 0x90, 0x8f, 0xb0, 0xb1, 0x99, 0x9d, 0x92, 0x92, 0x9b, 0xa2,
+  0x50, 0xe8, 0xc3, 0x88, 0x87, 0x6c, 0xe2, 0xe3, 0x72, 0x49, 0xb9, 0xd3,
+  0xa0, 0xbc, 0xd1, 0xc3, 0xd1, 0xd5, 0xcd, 0xc2, 0xba, 0x9d, 0x92, 0x92,
+  0xba, 0xba, 0x9c, 0x78, 0x6a, 0xb6, 0xa7, 0x67, 0x7c, 0x40, 0xb7, 0xc6,
+  0xd2, 0xb2, 0x7d, 0x77, 0x9a, 0x4d, 0x1a, 0x4f, 0x6b, 0x4b, 0xb1, 0x53,
+  0x38, 0x8f, 0xc7, 0x83, 0xc3, 0xdd, 0xa1, 0xa0, 0xb4, 0xb5, 0x92, 0x97,
+  0x84, 0x77, 0x6e, 0x80, 0xb0, 0x98, 0x8c, 0xd2, 0xa8, 0x74, 0xa5, 0xb2,
+  0x5a, 0xb2, 0x87, 0xc1, 0x93, 0xca, 0x96, 0xad, 0xa3, 0x87, 0xb0, 0xb2,
+  0x75, 0x51, 0xe7, 0xb4, 0x74, 0x77, 0x5e, 0x95, 0xd3, 0xb9, 0xbf, 0xcb,
+  0xc3, 0xdf, 0x93, 0x63, 0x8e, 0xd2, 0xac, 0x66, 0x85, 0xdf, 0xdb, 0xd5,
+  0xe4, 0xc3, 0x77, 0xa9, 0xa2, 0xe5, 0xe4, 0xa6, 0xa7, 0xcb, 0xe4, 0xb6,
+  0x8c, 0x42, 0x22, 0x24, 0x3e, 0x63, 0xc5, 0x9f, 0x56, 0x57, 0xbd, 0xa3,
+  0xbf, 0x55, 0x9d, 0xef, 0xce, 0xc6, 0xc7, 0xe2, 0xe6, 0xc6, 0x78, 0x5d,
+  0x6d, 0x91, 0xcd, 0xd0, 0xc1, 0xba, 0x71, 0x9e, 0x4f, 0xc3, 0x48, 0x85,
+  0x18, 0xb6, 0xe5, 0xc6, 0x9a, 0x6f, 0x84, 0xad, 0xe4, 0xaa, 0x70, 0x4b,
+  0x9d, 0x7a, 0x71, 0x66, 0xa1, 0x6e, 0x78, 0x93, 0x66, 0x7d, 0xd7, 0x60,
+  0x8a, 0xc4, 0xb2, 0x6b, 0x3d, 0x7b, 0x72, 0xc9, 0xa1, 0x5f, 0x97, 0x1e,
+  0x82, 0x5c, 0x57, 0xa6, 0xc8, 0xd2, 0xb9, 0xb5, 0x66, 0xc0, 0x55, 0x8d,
+  0x73, 0x8a, 0xb6, 0x8a, 0xb0, 0x69, 0x56, 0xa8, 0x72, 0x3d, 0x95, 0xb8,
+  0xd5, 0x85, 0x6e, 0xad, 0xda, 0xd5, 0xbe, 0xa2, 0x9a, 0x8e, 0xd3, 0xd5,
+  0xa0, 0xdb, 0xbe, 0x7c, 0x84, 0xa6, 0x90, 0x57, 0x94, 0xaf, 0x87, 0x92,
+  0x8c, 0xad, 0xb1, 0xa6, 0xc0, 0x9a, 0x7c, 0xbd, 0x9f, 0x84, 0x8c, 0xbd,
+  0x83, 0x68, 0x9e, 0x93, 0x66, 0x8c, 0x6f, 0x52, 0xaf, 0xb6, 0x63, 0xc7,
+  0xc0, 0x9c, 0x64, 0xbb, 0xd8, 0xae, 0x80, 0x33, 0x17, 0x40, 0xba, 0x8f,
+  0x8f, 0x8c, 0x8e, 0xcf, 0xa0, 0xb9, 0x94, 0x6e, 0x24, 0x45, 0xa2, 0xd0,
+  0xcb, 0xaa, 0x5f, 0x71, 0xc1, 0xbf, 0x9b, 0x81, 0x89, 0x5e, 0x8a, 0xbb,
+  0xa3, 0xa8, 0x27, 0x2b, 0x56, 0x8b, 0xb7, 0x99, 0x27, 0x61, 0xb4, 0x77,
+  0x22, 0x69, 0x91, 0x7d, 0x82, 0x70, 0xd7, 0x98, 0xaf, 0x6a, 0x55, 0x78,
+  0x85, 0x92, 0xa5, 0xc9, 0xab, 0xc2, 0x82, 0x41, 0x9d, 0x98, 0xb8, 0x24,
+  0x78, 0x8f, 0x6c, 0x4f, 0xb7, 0x86, 0xa2, 0xb5, 0x99, 0xe2, 0xba, 0x4c,
+  0x98, 0xaf, 0x46, 0x56, 0x44, 0x46, 0x99, 0xcb, 0x83, 0x74, 0x90, 0x9f,
+  0x7a, 0xc7, 0xa3, 0x5f, 0x33, 0xa4, 0xbc, 0x68, 0x90, 0x8a, 0xa8, 0x51,
+  0x64, 0x5b, 0x96, 0x6a, 0x77, 0x6e, 0x43, 0x29, 0x68, 0x69, 0x98, 0x7c,
+  0x78, 0x87, 0x36, 0x35, 0x5a, 0xdf, 0xbd, 0x96, 0xd8, 0xbc, 0x71, 0x6a,
+  0xa4, 0xb6, 0x76, 0x4d, 0xa1, 0x70, 0xac, 0xd0, 0x8e, 0xc1, 0x92, 0xa8,
+  0xbe, 0x81, 0xba, 0xd6, 0x96, 0x6b, 0x95, 0x7c, 0x61, 0xa1, 0xb2, 0x57,
+  0x73, 0x77, 0xb5, 0xcf, 0xbf, 0xc6, 0x7e, 0x97, 0x92, 0xe0, 0xb0, 0xad,
+  0xb5, 0x6b, 0x6c, 0xb6, 0xc8, 0xdd, 0xbc, 0xc3, 0x7c, 0x74, 0x95, 0x7e,
+  0xb8, 0xd6, 0xba, 0xb6, 0xa5, 0xd9, 0x92, 0x6c, 0x5c, 0x8b, 0xa3, 0xa1,
+  0x9d, 0xd0, 0x92, 0xad, 0xbe, 0x77, 0x92, 0x45, 0x38, 0x40, 0x91, 0x75,
+  0x96, 0x8b, 0x80, 0x6d, 0x6f, 0x61, 0xca, 0x92, 0x3d, 0x8c, 0x93, 0x54,
+  0x99, 0x82, 0x54, 0x71, 0x5d, 0x3a, 0xb8, 0x9f, 0x71, 0x65, 0xb4, 0xb2,
+  0x8a, 0x9c, 0x85, 0xb0, 0xab, 0xdd, 0xcf, 0x87, 0x46, 0x83, 0x72, 0xca,
+  0x82, 0x56, 0x6b, 0x1e, 0xa7, 0x92, 0x66, 0x94, 0xaf, 0x94, 0xa0, 0x56,
+  0x74, 0x96, 0xb9, 0xcc, 0xd1, 0x91, 0xb8, 0x53, 0x70, 0xd3, 0xd5, 0xa3,
+  0x6b, 0xb6, 0xa2, 0xc8, 0xaf, 0xc1, 0x98, 0x54, 0x96, 0xbe, 0x75, 0xa8,
+  0xa6, 0x8e, 0x8f, 0x4a, 0x1b, 0x26, 0xb3, 0xab, 0x42, 0x8f, 0x56, 0xcf,
+  0xce, 0x94, 0x70, 0x65, 0x7c, 0x97, 0xb2, 0x9b, 0x94, 0x95, 0x1b, 0x24,
+  0x5f, 0xb2, 0xb3, 0x9b, 0xac, 0x8a, 0xb1, 0xcd, 0xbc, 0xd0, 0x7c, 0x71,
+  0x62, 0x9e, 0xa6, 0x52, 0x40, 0x6e, 0xbc, 0x8b, 0x68, 0xbf, 0xaf, 0x63,
+  0xae, 0x98, 0xad, 0x63, 0x44, 0x48, 0x6e, 0xa6, 0x6a, 0x46, 0x8e, 0x82,
+  0x4f, 0x34, 0x60, 0xa8, 0x42, 0x14, 0x8d, 0x8e, 0xa2, 0xa9, 0x7e, 0x40,
+  0x1b, 0x5a, 0x86, 0x91, 0xcd, 0x7e, 0x59, 0xb6, 0x96, 0xac, 0xc0, 0xb6,
+  0xc8, 0x9c, 0xc3, 0xb3, 0x87, 0xcd, 0x94, 0xb7, 0xab, 0x8c, 0x73, 0x58,
+  0x7b, 0x9c, 0x55, 0x6f, 0x71, 0x86, 0x7a, 0x5b, 0xb6, 0xd6, 0xb2, 0x96,
+  0x7c, 0xb7, 0xc3, 0x89, 0x50, 0xc6, 0xf2, 0xe3, 0xc4, 0x54, 0x5f, 0x4b,
+  0x69, 0x76, 0xa7, 0x29, 0x3e, 0xac, 0xad, 0x4b, 0x74, 0x71, 0xa2, 0x58,
+  0x92, 0x2b, 0x25, 0x99, 0x82, 0x27, 0x8a, 0xa8, 0xc7, 0xa0, 0x93, 0x93,
+  0x9c, 0x6a, 0x57, 0x54, 0x44, 0xb6, 0xcb, 0x82, 0x20, 0x87, 0x9c, 0xa2,
+  0x89, 0x64, 0x9d, 0xcc, 0xb4, 0xcc, 0xe3, 0xce, 0x93, 0x72, 0xa1, 0x54,
+  0x22, 0x08, 0x7d, 0x9f, 0x53, 0x61, 0xa7, 0x84, 0x8e, 0x90, 0xc5, 0xdc,
+  0xc3, 0xf2, 0xc5, 0xe9, 0xe7, 0xe0, 0xca, 0xcd, 0xd1, 0xb3, 0x6a, 0xe3,
+  0xc8, 0x78, 0x30, 0x49, 0x46, 0x7f, 0x63, 0x62, 0x6e, 0x70, 0x93, 0x1a,
+  0x71, 0xbb, 0xc3, 0x69, 0x52, 0x5d, 0x66, 0x7c, 0xa9, 0xbe, 0x92, 0x8d,
+  0x6e, 0x62, 0xa7, 0xd8, 0xac, 0xae, 0x8e, 0xb2, 0x90, 0x81, 0xab, 0x3f,
+  0xab, 0x72, 0x69, 0x30, 0x68, 0x97, 0x8a, 0xa9, 0xdf, 0xc4, 0x8e, 0xa2,
+  0x82, 0xad, 0x90, 0x94, 0xe2, 0x92, 0x4e, 0x7f, 0x52, 0x4f, 0xa8, 0xc0,
+  0x41, 0xbc, 0x8f, 0x7a, 0xa1, 0xdb, 0xd3, 0x9e, 0x8b, 0xc0, 0x20, 0x36,
+  0xb2, 0x8c, 0x99, 0xa8, 0x8b, 0x8d, 0xd2, 0x9e, 0xad, 0x57, 0x19, 0x3d,
+  0x14, 0x74, 0xc6, 0x8a, 0x55, 0x9a, 0x99, 0xe2, 0xb3, 0x88, 0xe2, 0xb7,
+  0xa0, 0xb6, 0xc6, 0xa3, 0x91, 0xa2, 0x9f, 0x58, 0x80, 0x65, 0x6e, 0x97,
+  0x55, 0x5c, 0xd5, 0xb0, 0xde, 0xa5, 0x70, 0xc8, 0xdc, 0x92, 0xa0, 0x43,
+  0x8e, 0xbc, 0x96, 0x9f, 0xb4, 0xb4, 0x5e, 0x8e, 0xd4, 0x95, 0x79, 0xc1,
+  0xba, 0xcd, 0xcb, 0x8b, 0x74, 0x7e, 0x8c, 0x60, 0x81, 0xc5, 0x98, 0x83,
+  0x99, 0xd9, 0xbf, 0xbb, 0x61, 0x5e, 0xc2, 0x90, 0x9d, 0x75, 0x96, 0xc7,
+  0xaf, 0xdb, 0xdd, 0xa5, 0xc3, 0xc5, 0xc4, 0x80, 0xd7, 0xe2, 0xa1, 0x7c,
+  0x34, 0x67, 0x2f, 0x58, 0x6e, 0x7e, 0x85, 0x61, 0x86, 0xd4, 0x7f, 0x96,
+  0xb7, 0xd1, 0x47, 0x72, 0x42, 0x5a, 0x3c, 0x52, 0x64, 0x7d, 0x96, 0x30,
+  0x33, 0x81, 0xd1, 0x57, 0xd8, 0xa3, 0x8d, 0x83, 0x9f, 0xb2, 0xd1, 0xcf,
+  0xa5, 0xbd, 0xa2, 0x8c, 0x99, 0xb0, 0x67, 0xd0, 0x86, 0x77, 0xd2, 0x85,
+  0x6c, 0x73, 0xb2, 0xdc, 0xc2, 0x85, 0xaa, 0xdc, 0xd9, 0xde, 0xc0, 0x87,
+  0x5f, 0x45, 0xbf, 0xa6, 0x51, 0x7a, 0x5e, 0x95, 0xd5, 0xb8, 0x9a, 0xad,
+  0xb0, 0xd5, 0xb5, 0x90, 0xbd, 0xb4, 0xa0, 0xc3, 0x9a, 0xa9, 0xbd, 0x61,
+  0xa0, 0xd0, 0xb8, 0x9f, 0xf0, 0xf0, 0xb7, 0xbb, 0xa8, 0xab, 0xdd, 0xb6,
+  0xa9, 0xb7, 0x54, 0x46, 0x6c, 0xa2, 0x86, 0x76, 0xad, 0x9d, 0xa5, 0xb8,
+  0x8a, 0x2d, 0x5a, 0xd8, 0xd3, 0x9a, 0x8c, 0xba, 0x88, 0xe1, 0xce, 0xca,
+  0x98, 0x6d, 0xa3, 0x8a, 0x82, 0xc1, 0xe0, 0xcf, 0x8c, 0x9d, 0xdb, 0x93,
+  0xd3, 0xb9, 0xe0, 0xab, 0xc8, 0xc9, 0x56, 0x64, 0xa5, 0xdc, 0xac, 0xa0,
+  0x9d, 0x86, 0x59, 0x3a, 0xc0, 0xcd, 0xd6, 0x81, 0x2f, 0x43, 0x8f, 0x86,
+  0x80, 0xbd, 0x7b, 0x55, 0xb3, 0xc5, 0x92, 0xb6, 0xae, 0x5a, 0x73, 0x85,
+  0xa0, 0xaa, 0xa2, 0x62, 0x97, 0xb1, 0x97, 0x78, 0x7f, 0xd9, 0xc0, 0xbe,
+  0xa4, 0x72, 0x51, 0x8b, 0x7e, 0x9c, 0xca, 0xe9, 0xa0, 0x79, 0x79, 0xe2,
+  0xb2, 0x8b, 0x9b, 0xb1, 0x97, 0xbb, 0x85, 0x8a, 0x85, 0xa0, 0x99, 0x75,
+  0xc2, 0xd6, 0xbe, 0xd0, 0xe4, 0xd7, 0xd3, 0xbb, 0xc4, 0x9e, 0x86, 0xa9,
+  0xea, 0xe5, 0xb7, 0xb5, 0x72, 0x9a, 0x95, 0xa7, 0x96, 0xbd, 0x7d, 0x89,
+  0xad, 0xc8, 0xd7, 0xcd, 0xb7, 0xd6, 0xdf, 0xa8, 0xd7, 0x6b, 0x30, 0x1e,
+  0xa8, 0x34, 0x46, 0xba, 0xd8, 0x9e, 0xb8, 0xb6, 0xb5, 0x8a, 0xca, 0x97,
+  0xb4, 0xad, 0xbe, 0xca, 0xc4, 0x48, 0xbc, 0xa2, 0x89, 0xa0, 0xd5, 0xb5,
+  0x99, 0xc1, 0x67, 0x9c, 0x99, 0xc6, 0xa0, 0x88, 0xbf, 0x80, 0x72, 0x5b,
+  0xb0, 0xb8, 0xd5, 0x4f, 0x44, 0x67, 0x38, 0x90, 0x79, 0xc5, 0x8e, 0xc4,
+  0xc3, 0x73, 0x64, 0x67, 0xd3, 0xa5, 0x3c, 0x36, 0x44, 0x1d, 0xc6, 0x9a,
+  0x78, 0xc8, 0x7a, 0x51, 0x73, 0xc7, 0x59, 0x4f, 0x9a, 0x22, 0x59, 0x90,
+  0x72, 0x4d, 0x66, 0xe3, 0x94, 0x55, 0x90, 0xb5, 0xa8, 0x84, 0x56, 0xac,
+  0x7d, 0x9d, 0x90, 0x7f, 0x5a, 0x51, 0xa8, 0xc3, 0x90, 0xc1, 0xd2, 0xd8,
+  0xca, 0xcd, 0xc0, 0x87, 0xae, 0xc6, 0x5d, 0x27, 0x8e, 0x79, 0xc8, 0xa0,
+  0x82, 0x4f, 0x4c, 0xa6, 0x6e, 0xb4, 0xcb, 0x77, 0x7d, 0xd9, 0xa6, 0xa6,
+  0xb9, 0xa1, 0xba, 0xd0, 0x98, 0xbb, 0xa1, 0x46, 0x95, 0xaa, 0x96, 0xb8,
+  0xba, 0xa7, 0xe1, 0xaf, 0x32, 0x5e, 0x80, 0xb8, 0xce, 0xd8, 0xd7, 0x81,
+  0x91, 0x5f, 0x82, 0xc9, 0xb0, 0x7f, 0x7c, 0xa1, 0xbb, 0x8f, 0xac, 0x9c,
+  0x8b, 0xd1, 0xd4, 0x61, 0x96, 0x70, 0xba, 0xa4, 0x6d, 0x49, 0x9d, 0x9d,
+  0x6a, 0xdd, 0xa1, 0x50, 0x9f, 0xb7, 0x9c, 0xdb, 0xdf, 0xc0, 0x83, 0x32,
+  0x67, 0xc3, 0x95, 0x8c, 0xbc, 0x85, 0x91, 0x77, 0x6d, 0xd8, 0xa8, 0x8e,
+  0x49, 0xed, 0xc3, 0xbb, 0x5e, 0x0e, 0x5b, 0x84, 0xc6, 0xae, 0x8a, 0xbc,
+  0x82, 0x89, 0x30, 0x40, 0x78, 0xcd, 0xa7, 0x8f, 0x8c, 0x68, 0xb9, 0x6e,
+  0xae, 0xce, 0x8e, 0xc7, 0xcd, 0xaf, 0xc0, 0xd0, 0xda, 0xd6, 0xb2, 0xb6,
+  0x9e, 0xc7, 0xb4, 0x7a, 0xb8, 0x88, 0x51, 0x71, 0x78, 0xc1, 0xde, 0xa8,
+  0x74, 0xc6, 0xc0, 0x9b, 0xa0, 0xd2, 0xe2, 0x97, 0x8a, 0xb4, 0xa5, 0xd7,
+  0xd5, 0xaf, 0x87, 0x4c, 0x26, 0x95, 0x74, 0x92, 0xbc, 0xa3, 0x83, 0xc0,
+  0x81, 0x2f, 0x29, 0x72, 0x84, 0x84, 0xb5, 0x87, 0x5a, 0x63, 0x36, 0x6b,
+  0xc4, 0xe0, 0xb0, 0x72, 0x88, 0x94, 0xd4, 0xaf, 0x31, 0x67, 0xa5, 0x67,
+  0xaa, 0x94, 0x4d, 0x68, 0x77, 0x99, 0x69, 0xa6, 0xc2, 0xb8, 0xaa, 0x60,
+  0x86, 0xcd, 0xac, 0x94, 0xbb, 0xa5, 0x48, 0x72, 0x4e, 0xe1, 0xce, 0xae,
+  0x8b, 0xbf, 0x68, 0xce, 0x89, 0x96, 0xb0, 0xa7, 0x6f, 0xad, 0xb8, 0x7d,
+  0x84, 0x66, 0x55, 0xc3, 0x97, 0x75, 0x50, 0xb8, 0x5b, 0xc9, 0x5a, 0x33,
+  0xa0, 0xcb, 0xd1, 0xcb, 0xdf, 0x8d, 0x68, 0xa7, 0x92, 0xa7, 0xd4, 0xb5,
+  0xc8, 0xca, 0xbc, 0xb0, 0xa6, 0xaf, 0xd3, 0xbf, 0xdb, 0xc6, 0xdc, 0xac,
+  0x53, 0xd0, 0x60, 0x31, 0x36, 0x43, 0xa9, 0xc0, 0x9a, 0x79, 0xaf, 0x69,
+  0x4a, 0x86, 0xc9, 0xc8, 0xa1, 0xb4, 0xc1, 0xa7, 0xc5, 0xbd, 0xaf, 0xb0,
+  0x8a, 0xc8, 0x84, 0x2e, 0x95, 0x9d, 0x73, 0x78, 0x9d, 0x9d, 0x81, 0x5e,
+  0x55, 0x43, 0x4e, 0x3f, 0x5e, 0x76, 0xa1, 0x94, 0x63, 0xa7, 0xd4, 0x8a,
+  0x61, 0xcc, 0xc0, 0xd9, 0xd7, 0xc7, 0xba, 0x56, 0x6b, 0xbc, 0x9e, 0x3b,
+  0x55, 0x7a, 0x7f, 0xa8, 0xad, 0xbd, 0xa7, 0x5b, 0x33, 0xa4, 0xd0, 0xa4,
+  0x78, 0x41, 0x4c, 0xba, 0x6a, 0xab, 0xc6, 0xba, 0xae, 0xb0, 0x76, 0xad,
+  0xcf, 0xd2, 0xb3, 0xbc, 0x98, 0x95, 0xa8, 0x73, 0xb1, 0xbe, 0x94, 0x7e,
+  0xdd, 0xc4, 0x94, 0x86, 0x62, 0x70, 0x90, 0x6f, 0x29, 0x87, 0xc4, 0xb8,
+  0xad, 0xa5, 0x5d, 0xa3, 0xde, 0xd3, 0xd1, 0xae, 0xe3, 0xdd, 0xcc, 0xb5,
+  0xc3, 0x79, 0xa1, 0x8d, 0xc2, 0xb4, 0xa9, 0xb2, 0x72, 0x4d, 0x99, 0x6a,
+  0x83, 0x72, 0x86, 0x9f, 0x8a, 0x4c, 0x54, 0x30, 0x4c, 0x31, 0x45, 0xd6,
+  0xee, 0xac, 0xec, 0xd4, 0xc5, 0xb4, 0xc8, 0xbe, 0xdc, 0xcb, 0xb8, 0x6e,
+  0x82, 0x9d, 0x7c, 0x3f, 0x40, 0x79, 0xbf, 0x7d, 0x97, 0xa9, 0x64, 0x96,
+  0x87, 0x36, 0xb2, 0xec, 0xc4, 0xa3, 0xb4, 0xbf, 0x43, 0x5e, 0x93, 0xc8,
+  0xbd, 0x88, 0xb0, 0x7b, 0x93, 0xa0, 0xdd, 0xa1, 0xb6, 0x86, 0x5b, 0xa1,
+  0xdb, 0xaa, 0x91, 0xb5, 0xbf, 0xb5, 0xaa, 0xaa, 0x78, 0x9f, 0x42, 0x8c,
+  0x48, 0x94, 0x7d, 0x9a, 0xce, 0xc6, 0x9d, 0x86, 0x9c, 0xd1, 0xcc, 0xb8,
+  0xc7, 0x80, 0x9f, 0x74, 0x81, 0xbb, 0xdc, 0xc1, 0xa7, 0xa1, 0xd8, 0xd1,
+  0xd6, 0xb4, 0xbc, 0xc2, 0xa6, 0x53, 0xaa, 0xa1, 0x94, 0xce, 0x47, 0x8a,
+  0x91, 0xb8, 0xce, 0x98, 0xbc, 0xc9, 0x9f, 0x86, 0xa5, 0xc7, 0xdb, 0xb8,
+  0xa2, 0x9b, 0x89, 0x90, 0xb3, 0x50, 0xa8, 0xa4, 0x50, 0x1f, 0x90, 0xb7,
+  0x8a, 0xc5, 0x56, 0x3c, 0x49, 0x80, 0x44, 0x7f, 0xc7, 0x79, 0xca, 0xe3,
+  0xd5, 0xc1, 0xc7, 0xdc, 0x97, 0xa0, 0x9c, 0x7b, 0x3e, 0xe1, 0xae, 0x99,
+  0x60, 0xba, 0xd2, 0xbc, 0xd3, 0xae, 0xdd, 0x91, 0x88, 0x1c, 0x06, 0x47,
+  0xb2, 0xcd, 0xdc, 0xb4, 0xbc, 0x30, 0x1d, 0x78, 0xa0, 0x61, 0xcb, 0x95,
+  0x7c, 0x79, 0xd8, 0xad, 0x5a, 0x19, 0x24, 0x40, 0xad, 0xe4, 0x8d, 0x9e,
+  0xd6, 0xd7, 0x55, 0x54, 0x56, 0x63, 0xab, 0x93, 0x66, 0x5c, 0xa9, 0x25,
+  0xb0, 0xa0, 0xce, 0xd3, 0xbd, 0xc8, 0x9e, 0x80, 0x9f, 0x9a, 0x9a, 0x9a,
+  0x72, 0xa1, 0xa8, 0xb8, 0x90, 0x36, 0x14, 0x23, 0x70, 0xb4, 0xda, 0xe8,
+  0xda, 0xcf, 0xba, 0xb9, 0x9b, 0x98, 0x7b, 0x41, 0x37, 0xbf, 0xe8, 0xbc,
+  0xc3, 0xc5, 0x80, 0x71, 0x78, 0xa1, 0xe1, 0xc5, 0xa4, 0xa0, 0x9a, 0x78,
+  0x98, 0x9b, 0x7c, 0xcd, 0x82, 0x38, 0x30, 0x50, 0x70, 0xda, 0x44, 0x1f,
+  0xa0, 0x35, 0x49, 0x79, 0xb6, 0x77, 0x84, 0x77, 0x4d, 0xa7, 0x96, 0xbb,
+  0x6a, 0xa0, 0xc1, 0xc5, 0xa0, 0x86, 0xb4, 0xcd, 0x4f, 0x24, 0x50, 0x8c,
+  0x51, 0xaf, 0xb6, 0x64, 0xb1, 0x66, 0x85, 0x13, 0x64, 0x88, 0xa5, 0xb5,
+  0xbd, 0x8f, 0x96, 0xb5, 0xa9, 0x45, 0x94, 0xcb, 0xaa, 0x90, 0xc0, 0xae,
+  0x4e, 0x4d, 0x76, 0x73, 0x55, 0xaa, 0xbe, 0x6f, 0xc0, 0xb7, 0x93, 0x44,
+  0x5b, 0x83, 0x82, 0x8e, 0xcd, 0xab, 0xca, 0x5e, 0x54, 0xc7, 0x8c, 0xaf,
+  0xa4, 0xad, 0xcb, 0xab, 0x61, 0xe0, 0xd7, 0xd5, 0xa7, 0x8e, 0xc7, 0xb9,
+  0x9d, 0x8b, 0x82, 0x5d, 0x2a, 0x26, 0x97, 0xcc, 0xca, 0xbc, 0x97, 0xac,
+  0xc9, 0xd1, 0xa5, 0x89, 0x9e, 0xa4, 0x97, 0xac, 0x7a, 0x9f, 0x80, 0x34,
+  0x44, 0x68, 0xa0, 0xd5, 0xc9, 0xa6, 0xca, 0x7b, 0x32, 0x6b, 0xa1, 0xd6,
+  0xa3, 0x96, 0xa9, 0x9f, 0x63, 0x82, 0xa5, 0x71, 0x7f, 0x77, 0x42, 0x61,
+  0x79, 0x85, 0xaf, 0xb0, 0x9c, 0x8f, 0x80, 0x91, 0x97, 0x92, 0xc9, 0xa9,
+  0xd9, 0xbf, 0x8f, 0xbe, 0x9b, 0x9d, 0x76, 0x26, 0xa6, 0x99, 0xb0, 0x3b,
+  0x4f, 0x5f, 0x58, 0xaa, 0x70, 0xa5, 0x78, 0x99, 0xb0, 0xab, 0xc9, 0xd8,
+  0xda, 0xcf, 0xba, 0xbb, 0xb9, 0xc5, 0xbd, 0xd2, 0xb4, 0x75, 0x66, 0x8a,
+  0x8a, 0xaa, 0x62, 0x44, 0x61, 0xa5, 0xa0, 0x9f, 0x64, 0x91, 0xaf, 0x2f,
+  0x7a, 0x7b, 0xc4, 0xe1, 0x92, 0x96, 0xcc, 0xd5, 0xa5, 0x68, 0xc2, 0xbe,
+  0x3e, 0x77, 0x5e, 0x92, 0xaf, 0x76, 0x8f, 0xa2, 0x83, 0xa5, 0x4d, 0x67,
+  0x72, 0x1c, 0x97, 0x88, 0x75, 0x9a, 0x9f, 0xc0, 0x89, 0xa8, 0xb8, 0x5b,
+  0xa2, 0xc0, 0xcb, 0xb0, 0xb9, 0xd2, 0x9b, 0x58, 0xa1, 0x29, 0x9d, 0xbc,
+  0xb0, 0xa4, 0xc6, 0xa5, 0x5c, 0x65, 0x7e, 0xc3, 0xd1, 0xbd, 0xd4, 0xd1,
+  0xa3, 0xb8, 0x7e, 0x7b, 0xa2, 0x9e, 0xd1, 0x96, 0x9c, 0x9c, 0x7c, 0x74,
+  0x7a, 0x48, 0x5b, 0xca, 0xd9, 0xbb, 0xa5, 0x84, 0xd4, 0xd4, 0x5c, 0xae,
+  0xd8, 0xa4, 0x8f, 0x71, 0x95, 0x79, 0x90, 0xbf, 0x91, 0x5a, 0xa2, 0x9a,
+  0x76, 0xd0, 0xa9, 0xa1, 0x90, 0xa9, 0x74, 0xa2, 0xcf, 0xac, 0xce, 0x60,
+  0x9c, 0x7f, 0x74, 0x82, 0xda, 0xae, 0x94, 0xcd, 0xa3, 0xaa, 0x8b, 0x5a,
+  0x32, 0x90, 0x7d, 0x69, 0x60, 0x4c, 0xb1, 0x8f, 0x7c, 0xd6, 0x8a, 0x75,
+  0x9e, 0xb8, 0xc3, 0xb5, 0xb7, 0xa5, 0xde, 0xc7, 0x6f, 0x7b, 0xa6, 0xbc,
+  0x8f, 0x76, 0x91, 0xb3, 0x99, 0xb2, 0x9a, 0x73, 0x97, 0x5f, 0x96, 0x9e,
+  0x59, 0x6f, 0x73, 0xaa, 0xa2, 0x9d, 0xcb, 0x8f, 0x43, 0x55, 0x9a, 0x77,
+  0xb0, 0x7a, 0x9f, 0x3f, 0x7a, 0x92, 0x71, 0x83, 0x8f, 0x95, 0xa2, 0xb9,
+  0xc2, 0x9f, 0x8a, 0x86, 0xaa, 0xd5, 0xba, 0x87, 0x5d, 0xb9, 0xba, 0x83,
+  0xa6, 0x76, 0x60, 0x98, 0x7b, 0x77, 0xa2, 0xc0, 0xa2, 0x92, 0x65, 0x32,
+  0x53, 0xa3, 0xaa, 0x70, 0xd8, 0xe9, 0xac, 0x60, 0xd1, 0xd2, 0x91, 0xb3,
+  0xcc, 0x68, 0x71, 0xbd, 0x65, 0x35, 0x4d, 0x5e, 0x7b, 0x6b, 0xd7, 0xa9,
+  0x88, 0xc2, 0xd3, 0x7a, 0x93, 0x92, 0xcb, 0x8c, 0xaf, 0x3c, 0xa6, 0x98,
+  0x82, 0xca, 0xb9, 0x93, 0x90, 0x70, 0x67, 0x4f, 0x6f, 0x89, 0x9b, 0x7b,
+  0xab, 0x6a, 0x9f, 0xb0, 0xb7, 0xb1, 0xbb, 0xb9, 0x54, 0x7a, 0xab, 0x8e,
+  0x81, 0xa4, 0xb5, 0xd7, 0xc9, 0x56, 0x8d, 0x8f, 0xa9, 0x63, 0xc6, 0xcb,
+  0xc1, 0xb1, 0xb8, 0x88, 0xa4, 0x66, 0x83, 0xbd, 0xa9, 0xbd, 0x9c, 0xa1,
+  0xc1, 0xb4, 0x9c, 0xac, 0x99, 0x95, 0xae, 0xa4, 0xe7, 0xa8, 0x8a, 0x8c,
+  0x95, 0x9c, 0x73, 0xc2, 0x9a, 0x85, 0xa1, 0xc6, 0xcf, 0x92, 0xba, 0x39,
+  0x81, 0xba, 0xe2, 0xaa, 0x65, 0xc8, 0xd3, 0x8c, 0x7e, 0xaa, 0xc6, 0xd6,
+  0xba, 0xb3, 0x4d, 0x80, 0x8d, 0xa8, 0x90, 0xc5, 0x65, 0x3d, 0x8a, 0x7f,
+  0x99, 0xd1, 0xb6, 0xae, 0xc4, 0xb9, 0x5b, 0x2e, 0xb1, 0x9c, 0xc0, 0xc5,
+  0x9e, 0x70, 0x4f, 0x40, 0x83, 0x28, 0x79, 0xd2, 0xbc, 0xa6, 0xd0, 0xbe,
+  0xa9, 0xc6, 0xb7, 0xaa, 0xd0, 0x34, 0x26, 0x86, 0x99, 0x8d, 0xcf, 0x96,
+  0x77, 0xae, 0x4d, 0x68, 0x9f, 0xb9, 0x41, 0x85, 0x53, 0x9e, 0x5f, 0x8a,
+  0x82, 0xb2, 0xbe, 0xab, 0xcc, 0x98, 0x89, 0x86, 0x3f, 0x24, 0x1c, 0x30,
+  0xa4, 0xb1, 0xef, 0xc3, 0x95, 0x4a, 0x61, 0x70, 0xc0, 0xb8, 0x9a, 0xd2,
+  0xba, 0xb9, 0x55, 0x8b, 0xc7, 0x6c, 0x9c, 0xd4, 0xb1, 0xa7, 0x7f, 0x88,
+  0xb5, 0xc1, 0xb9, 0xa6, 0xa6, 0xdb, 0xbe, 0xc0, 0xc4, 0x55, 0x54, 0x72,
+  0x81, 0x81, 0x84, 0x95, 0xca, 0xcf, 0xe2, 0xa2, 0x53, 0x5e, 0xc6, 0xd4,
+  0x87, 0xcb, 0xe0, 0xd4, 0x6b, 0x82, 0xbc, 0xcb, 0xc5, 0xc9, 0x7d, 0xa9,
+  0xa1, 0x98, 0xaf, 0xdc, 0xd2, 0x9a, 0xc5, 0xbb, 0xaf, 0xb7, 0x91, 0x79,
+  0x6a, 0xd5, 0x74, 0x6c, 0x6d, 0xc9, 0xde, 0xcd, 0xd2, 0xb2, 0x98, 0x24,
+  0xb9, 0x84, 0x7d, 0x73, 0xa9, 0xac, 0x9c, 0xb8, 0xe9, 0xda, 0xad, 0x9b,
+  0xbf, 0xb7, 0x29, 0x63, 0xba, 0xa8, 0xe8, 0xaa, 0x9d, 0xb4, 0x78, 0x38,
+  0x6f, 0xbd, 0x8a, 0xae, 0x49, 0x5b, 0x94, 0xcd, 0xc2, 0xc9, 0xa6, 0x91,
+  0x5c, 0xb2, 0xd1, 0xca, 0xd1, 0xd1, 0xbe, 0x8c, 0x69, 0xbe, 0xf1, 0xd4,
+  0xac, 0x6d, 0x6b, 0x35, 0x9c, 0x75, 0x7d, 0x89, 0xba, 0xea, 0xaf, 0x9c,
+  0xc7, 0x8f, 0x75, 0xcb, 0xe0, 0xc6, 0xb0, 0x75, 0x4a, 0x9e, 0x62, 0x90,
+  0xc4, 0xb0, 0xa8, 0x62, 0x97, 0xa4, 0x75, 0x91, 0x87, 0xa2, 0xc1, 0xc2,
+  0xc4, 0xcb, 0xee, 0xc3, 0x9f, 0xab, 0x93, 0xb2, 0xaa, 0xaf, 0x70, 0xe7,
+  0xcc, 0x77, 0x47, 0x8e, 0xa0, 0x99, 0x99, 0x4c, 0x72, 0x94, 0xb5, 0x9f,
+  0xa8, 0x9a, 0x6e, 0xb3, 0xd0, 0xad, 0x88, 0x62, 0x52, 0x7f, 0x8b, 0x3a,
+  0x8f, 0x9a, 0xcc, 0xb2, 0x8e, 0xc2, 0xba, 0x87, 0xab, 0xdc, 0xb9, 0x8d,
+  0x77, 0xbc, 0x94, 0xb7, 0xcc, 0xd8, 0xa3, 0x5f, 0x54, 0xb0, 0xa2, 0x89,
+  0x46, 0x64, 0xbc, 0xa5, 0x7e, 0x7c, 0xa2, 0x81, 0x93, 0xb6, 0x8a, 0x99,
+  0x83, 0x45, 0x3a, 0x77, 0x9e, 0xab, 0xbf, 0x75, 0x4c, 0x26, 0x86, 0x74,
+  0xb2, 0xd3, 0x6e, 0xa7, 0x3d, 0xab, 0xe2, 0xb9, 0x6e, 0x45, 0x49, 0x82,
+  0xa2, 0x8d, 0x3a, 0x28, 0x32, 0x92, 0x9c, 0x9b, 0x84, 0xcb, 0xc1, 0xaa,
+  0xa0, 0xce, 0xc3, 0x8f, 0x76, 0x9a, 0xae, 0x38, 0x9d, 0x5b, 0x46, 0x69,
+  0xcc, 0x94, 0x7f, 0xce, 0xd1, 0x83, 0x64, 0xb4, 0xb0, 0x9e, 0x94, 0xbc,
+  0x4c, 0x63, 0x8c, 0xb2, 0xbd, 0xaa, 0x75, 0xa5, 0xc3, 0xa0, 0x58, 0x40,
+  0x9e, 0x90, 0xda, 0xa5, 0x6b, 0x2d, 0x05, 0x50, 0x54, 0x3c, 0x35, 0x17,
+  0x97, 0xb5, 0xb0, 0x79, 0x32, 0x3a, 0x97, 0xbb, 0xdd, 0xa3, 0xab, 0xc0,
+  0xbe, 0x32, 0x86, 0xba, 0xb0, 0x92, 0x64, 0xaa, 0x7e, 0xa9, 0xc3, 0x92,
+  0xac, 0xa9, 0xb6, 0x9d, 0xb0, 0x8f, 0x88, 0xbc, 0xc3, 0xbe, 0x96, 0x88,
+  0xab, 0x83, 0x64, 0x98, 0xe3, 0x7d, 0x8a, 0x67, 0x91, 0xb3, 0xc3, 0x82,
+  0xae, 0x99, 0x85, 0xa9, 0xb2, 0x2a, 0x65, 0xa0, 0x49, 0x86, 0xa4, 0x8c,
+  0x72, 0x87, 0xe3, 0xc2, 0xd2, 0xd3, 0x96, 0x9c, 0xb9, 0xce, 0x5d, 0x9b,
+  0x70, 0x6e, 0x77, 0x73, 0x8a, 0xb4, 0xca, 0x9c, 0x49, 0x86, 0xb7, 0xda,
+  0xd6, 0xd3, 0xc8, 0xbc, 0x7e, 0x64, 0x87, 0x8e, 0xa6, 0xcd, 0xa4, 0xb4,
+  0xc4, 0xcb, 0xab, 0x91, 0xa1, 0xdc, 0x9a, 0x94, 0x98, 0x96, 0x9d, 0x9f,
+  0x99, 0xb5, 0x66, 0x7c, 0xca, 0xaa, 0xbc, 0x73, 0x43, 0x69, 0xaa, 0xc7,
+  0xa1, 0xbf, 0x69, 0xca, 0xc8, 0x95, 0x99, 0x3e, 0x45, 0x50, 0x86, 0xb2,
+  0xab, 0xc0, 0x74, 0x94, 0xae, 0x9f, 0x88, 0xa2, 0xd4, 0x76, 0x31, 0x5f,
+  0xb5, 0x9e, 0x1f, 0x4e, 0x81, 0x51, 0x56, 0x7b, 0xb8, 0xe0, 0xa2, 0xb3,
+  0x67, 0x74, 0x76, 0x52, 0xa7, 0xdc, 0xab, 0x8e, 0x8e, 0xba, 0x70, 0x9f,
+  0xba, 0xe2, 0xb9, 0xd7, 0xd7, 0xb0, 0xcf, 0xaa, 0xe1, 0xd5, 0xb1, 0xa1,
+  0xbf, 0x8c, 0xb4, 0xaf, 0x77, 0x7e, 0xa0, 0xb3, 0x72, 0x71, 0x9d, 0xc8,
+  0xd3, 0xe3, 0xab, 0xa4, 0xcc, 0xcb, 0xa7, 0x6a, 0xdf, 0x6d, 0x95, 0x32,
+  0x3b, 0x71, 0x88, 0xdb, 0x9d, 0xca, 0xac, 0xac, 0xd2, 0xdf, 0xd8, 0xc4,
+  0x8a, 0x9c, 0x8c, 0xb4, 0xe4, 0xe2, 0xc3, 0xcf, 0xcc, 0xc1, 0x5b, 0xb1,
+  0x8c, 0xe0, 0xc1, 0xa4, 0xae, 0x82, 0xa8, 0x77, 0xd1, 0xa7, 0x81, 0x35,
+  0x5f, 0xb1, 0xd4, 0xd9, 0xd1, 0xb7, 0x91, 0xa5, 0xa6, 0xbd, 0x94, 0xc2,
+  0xf0, 0xd3, 0x8b, 0x58, 0x84, 0xb7, 0x50, 0xb2, 0x9f, 0xcc, 0xd0, 0xca,
+  0xac, 0x9f, 0x9c, 0xd9, 0xd4, 0xce, 0xac, 0xaa, 0x73, 0x8f, 0x42, 0x3a,
+  0x73, 0xa7, 0x7c, 0xb1, 0x74, 0x8c, 0xb8, 0x70, 0xb2, 0xd6, 0xa1, 0xb6,
+  0xb7, 0xca, 0x87, 0x89, 0x83, 0x82, 0xa1, 0x9c, 0xb3, 0xc4, 0xa9, 0x79,
+  0x9f, 0xd4, 0xde, 0xa4, 0xd7, 0xc1, 0xcd, 0xae, 0xa6, 0xd8, 0xa5, 0x8e,
+  0x62, 0x32, 0x65, 0xa6, 0x96, 0x9f, 0x86, 0x94, 0xa3, 0x77, 0x58, 0x6f,
+  0x7c, 0x93, 0xcd, 0xc1, 0x85, 0xa0, 0x66, 0x66, 0x22, 0x9e, 0x70, 0xab,
+  0xc6, 0x9e, 0x8d, 0x81, 0xdc, 0xd4, 0xa2, 0xae, 0x9a, 0x88, 0x8b, 0x7d,
+  0x88, 0x9f, 0x88, 0x75, 0x8e, 0xc8, 0x7f, 0x58, 0xa1, 0x75, 0xe9, 0xbf,
+  0xf2, 0xd8, 0xdf, 0xd1, 0xbe, 0x92, 0x62, 0xb6, 0x76, 0x71, 0xbb, 0x8f,
+  0x8c, 0x61, 0x97, 0x3d, 0x4a, 0x57, 0x71, 0x6e, 0x99, 0xa4, 0xb4, 0x9e,
+  0x86, 0xc7, 0xc5, 0x8e, 0x73, 0xbc, 0xdc, 0xc0, 0x9c, 0x94, 0x6b, 0xa6,
+  0xc2, 0xd5, 0xa4, 0x9a, 0x8f, 0x52, 0x66, 0x5d, 0xc1, 0x8c, 0x7c, 0xa4,
+  0xb7, 0x67, 0x7d, 0x37, 0x2f, 0x95, 0x97, 0x94, 0xa9, 0xd0, 0x91, 0x8f,
+  0xa6, 0x45, 0x89, 0x69, 0xa6, 0xc3, 0x95, 0xbb, 0xa8, 0x9c, 0xd2, 0xc8,
+  0x8f, 0xa7, 0xba, 0x8f, 0xa2, 0xc4, 0xd0, 0xd0, 0x96, 0x9e, 0x93, 0xb9,
+  0xce, 0xcc, 0xae, 0xc2, 0xd3, 0x9a, 0x3a, 0x94, 0x84, 0xa1, 0xab, 0xb1,
+  0x87, 0x95, 0x7f, 0x8d, 0x54, 0x52, 0xac, 0x71, 0xa5, 0xd6, 0x9a, 0x87,
+  0x74, 0xb1, 0xe7, 0xd1, 0xd3, 0xae, 0x9c, 0xb7, 0xae, 0xbe, 0x8d, 0x99,
+  0x3e, 0xda, 0xce, 0x90, 0xb5, 0x5f, 0xc4, 0x97, 0xa6, 0x88, 0x99, 0xd7,
+  0x7c, 0xb8, 0x76, 0x94, 0xb1, 0x71, 0x98, 0xa0, 0xa3, 0xa2, 0xda, 0xb3,
+  0x61, 0x41, 0xb0, 0x76, 0xc7, 0xaf, 0xca, 0x97, 0x8e, 0x80, 0xd2, 0xc6,
+  0x6a, 0x82, 0xab, 0x90, 0xad, 0x61, 0x24, 0x46, 0x76, 0x9e, 0x7c, 0x25,
+  0x53, 0x5b, 0x3b, 0x3b, 0xbe, 0x60, 0xae, 0x48, 0x46, 0x2c, 0x9f, 0x35,
+  0x30, 0x9e, 0x9b, 0xbc, 0x81, 0xbe, 0xc6, 0x91, 0xa0, 0x60, 0x43, 0x5d,
+  0x44, 0xb7, 0x97, 0x71, 0x36, 0x1c, 0x33, 0xa3, 0xb2, 0xaa, 0xc0, 0xc4,
+  0xab, 0xaf, 0x93, 0x61, 0x58, 0x8f, 0xb4, 0x90, 0x94, 0xa3, 0x8f, 0x89,
+  0xb5, 0xad, 0xa4, 0x9c, 0xbb, 0x84, 0x65, 0x41, 0x93, 0x2d, 0x4b, 0x76,
+  0xbb, 0x5c, 0xb9, 0x8e, 0x95, 0xa0, 0x83, 0xa2, 0x8d, 0x1c, 0x8d, 0xb7,
+  0xe8, 0xee, 0x83, 0x91, 0xc9, 0xd4, 0xcd, 0xa9, 0x89, 0x8a, 0xb4, 0x9c,
+  0xb4, 0x5a, 0x69, 0x8c, 0xe6, 0x89, 0xa9, 0xdc, 0x80, 0xc7, 0xa8, 0x6b,
+  0x26, 0x66, 0x48, 0x74, 0xd5, 0xe5, 0xb8, 0xb1, 0x99, 0xda, 0xc9, 0x9a,
+  0x5c, 0x51, 0x77, 0xbb, 0x70, 0x66, 0x99, 0xbe, 0xb9, 0xb7, 0x9a, 0x66,
+  0xa5, 0xbc, 0x8f, 0x54, 0x78, 0x43, 0x7a, 0xa4, 0xb8, 0x9c, 0xc4, 0x87,
+  0xcd, 0xab, 0xa7, 0x8e, 0x88, 0x7e, 0x9d, 0x82, 0x6e, 0x32, 0x4f, 0x99,
+  0x9a, 0x78, 0xa1, 0x5c, 0x7b, 0xbc, 0x6b, 0x31, 0x95, 0x4f, 0x65, 0xc3,
+  0x88, 0x83, 0xaf, 0xd7, 0xae, 0x7f, 0xa1, 0xd8, 0xa8, 0xb4, 0x81, 0x99,
+  0x91, 0xaf, 0x98, 0xad, 0xba, 0xa4, 0xb9, 0x54, 0x84, 0x7e, 0x71, 0x66,
+  0xa7, 0x85, 0x52, 0x95, 0xb2, 0x8f, 0x7d, 0x7d, 0x8d, 0x37, 0xd6, 0xcf,
+  0xa6, 0x8e, 0xcf, 0x98, 0xd3, 0x9a, 0x8a, 0xa6, 0xbe, 0xe2, 0xab, 0x2c,
+  0x76, 0xa2, 0xc5, 0xce, 0xe4, 0xe3, 0xd4, 0x9d, 0x89, 0x8e, 0xb8, 0x86,
+  0x77, 0x9a, 0x3b, 0xa6, 0x98, 0xb0, 0xc8, 0x9d, 0x64, 0xd2, 0xbe, 0xd1,
+  0xca, 0xd7, 0xc1, 0xba, 0xa4, 0xa3, 0xc2, 0xc1, 0x9d, 0x58, 0x1a, 0x81,
+  0x93, 0xc3, 0xc0, 0xc9, 0xd7, 0xca, 0xae, 0xa9, 0x71, 0xc3, 0xaf, 0x5f,
+  0x9b, 0xc0, 0x5e, 0x74, 0xc2, 0xb1, 0xa6, 0xbd, 0x90, 0xbf, 0xac, 0xe2,
+  0xc6, 0xb4, 0x81, 0x8c, 0x5d, 0x29, 0x0c, 0x4f, 0x8b, 0x39, 0x6a, 0x5f,
+  0x86, 0x8e, 0xb1, 0x6c, 0x9d, 0xa9, 0x3c, 0x62, 0xcb, 0x91, 0x62, 0xb6,
+  0x9a, 0x91, 0x5c, 0xad, 0xcd, 0xd0, 0xc9, 0xa9, 0x9a, 0xc3, 0x95, 0x7d,
+  0x80, 0xaa, 0xac, 0x70, 0x64, 0x59, 0x8e, 0x88, 0x55, 0xd8, 0xb9, 0x95,
+  0xb8, 0xac, 0xd7, 0xc4, 0x98, 0x25, 0x86, 0x9b, 0x86, 0x45, 0x9c, 0x96,
+  0x93, 0xd8, 0x97, 0x7d, 0x8a, 0xb7, 0xdd, 0x93, 0x35, 0xaa, 0x94, 0x9f,
+  0xbc, 0xb2, 0xb8, 0xab, 0x66, 0x53, 0x88, 0x99, 0x5e, 0xa7, 0x60, 0x36,
+  0x81, 0xb7, 0xc8, 0xa0, 0x6f, 0x91, 0xc6, 0xbc, 0x62, 0xa6, 0xb8, 0x8d,
+  0x8c, 0x56, 0xb9, 0xc2, 0xca, 0xd6, 0xd6, 0xcd, 0xc3, 0x84, 0xb2, 0xce,
+  0x8a, 0xb8, 0xba, 0xc1, 0x88, 0xba, 0xf3, 0xb8, 0xb7, 0xbd, 0x7c, 0x1c,
+  0xbd, 0xd6, 0xcc, 0x7e, 0x56, 0x4d, 0x93, 0x6e, 0x87, 0xe0, 0xad, 0x88,
+  0xb6, 0x8b, 0x63, 0x39, 0xa3, 0xaa, 0x53, 0x48, 0xa7, 0x5a, 0x48, 0x65,
+  0x80, 0x87, 0x64, 0x5e, 0xc0, 0xc5, 0x93, 0x97, 0x82, 0xa4, 0xdf, 0xa0,
+  0xa6, 0x9f, 0xad, 0x9b, 0x7d, 0xa2, 0x95, 0x5b, 0x95, 0xa2, 0xa4, 0x5f,
+  0x3a, 0x6c, 0xb2, 0xc0, 0x67, 0x75, 0x96, 0xb7, 0x98, 0x89, 0xb1, 0x95,
+  0x7f, 0x40, 0x5e, 0x99, 0x45, 0x94, 0x7a, 0x74, 0xb2, 0xb2, 0x64, 0x7d,
+  0x99, 0xa8, 0xe3, 0xcd, 0x78, 0x93, 0x8e, 0x92, 0xb6, 0xbb, 0x81, 0x91,
+  0xa3, 0x79, 0x5e, 0x57, 0x79, 0x8a, 0xb4, 0x4e, 0x4c, 0xab, 0xb4, 0xd3,
+  0xbe, 0x97, 0x79, 0xb9, 0xc1, 0x97, 0x79, 0x77, 0x5d, 0x9e, 0xac, 0x97,
+  0x63, 0x87, 0x7a, 0x9b, 0xa3, 0x95, 0x92, 0x87, 0x77, 0x6d, 0x8b, 0xb8,
+  0x98, 0xc7, 0xe7, 0xca, 0xb4, 0x89, 0x67, 0x6b, 0xca, 0x91, 0xd1, 0x8a,
+  0xa1, 0x26, 0x2d, 0x47, 0x1b, 0x4a, 0x8c, 0x87, 0xbf, 0xaa, 0xbf, 0x6f,
+  0x5b, 0x96, 0xa6, 0xa6, 0xa8, 0x71, 0x31, 0x23, 0x93, 0xae, 0x3d, 0x60,
+  0xb4, 0xbd, 0xba, 0xcf, 0xcc, 0x6c, 0x6d, 0x6c, 0x97, 0x75, 0x7c, 0xb0,
+  0x28, 0x5d, 0xbf, 0x3a, 0x58, 0x91, 0x6c, 0x7d, 0x43, 0x28, 0x5a, 0x98,
+  0xd1, 0x6a, 0x52, 0x9f, 0xcf, 0x89, 0xd8, 0xc0, 0x78, 0x40, 0x78, 0x96,
+  0x96, 0x98, 0xaf, 0x9e, 0xb1, 0xbc, 0x9a, 0x5e, 0x9c, 0x5e, 0xa2, 0xc0,
+  0x99, 0xa0, 0xcd, 0xb7, 0xc3, 0xd0, 0x88, 0x1d, 0x56, 0x5f, 0xa1, 0xb6,
+  0x9b, 0x74, 0x76, 0x67, 0x28, 0x93, 0x5d, 0xa1, 0xac, 0x78, 0x66, 0x7e,
+  0xe4, 0x80, 0x9b, 0xaf, 0x7e, 0x93, 0xb5, 0x95, 0x64, 0x79, 0x59, 0x85,
+  0xc5, 0xa2, 0xa1, 0xa3, 0x86, 0x63, 0x66, 0xaa, 0x44, 0x7b, 0x92, 0xac,
+  0x9c, 0x9f, 0x90, 0x4f, 0x9d, 0x91, 0x9b, 0x97, 0x4c, 0x6a, 0x87, 0x8b,
+  0x59, 0x8e, 0x6c, 0x71, 0x78, 0x8e, 0x9e, 0xa1, 0x6a, 0x59, 0x58, 0x72,
+  0x78, 0x91, 0x83, 0x44, 0x58, 0xbc, 0xa0, 0x5c, 0x5e, 0x7d, 0xab, 0x9e,
+  0x90, 0x9f, 0x71, 0x5b, 0x5c, 0xc0, 0x5c, 0x68, 0x32, 0x08, 0x3c, 0x86,
+  0x2d, 0x5f, 0x79, 0x41, 0x86, 0x5f, 0x89, 0xa0, 0x86, 0x9d, 0xb1, 0x57,
+  0xcc, 0x9a, 0xa5, 0x9e, 0xd8, 0xb6, 0xc2, 0x77, 0x3a, 0x23, 0x78, 0xc5,
+  0xd0, 0xe1, 0xb4, 0xb8, 0xba, 0xb0, 0xa7, 0xcb, 0x91, 0x88, 0x85, 0xc8,
+  0xc3, 0xbc, 0x86, 0x38, 0xa7, 0x5e, 0x90, 0x9d, 0xc6, 0x9a, 0xa2, 0x9b,
+  0x2b, 0x56, 0x78, 0x8d, 0x9c, 0x55, 0x1e, 0x62, 0x8b, 0x92, 0x5a, 0xae,
+  0x92, 0x89, 0x9f, 0x8a, 0x7a, 0x5a, 0x77, 0x62, 0xa0, 0xaf, 0xcf, 0xb3,
+  0xbb, 0xcc, 0x87, 0x7a, 0x58, 0x5f, 0x8c, 0x66, 0x91, 0xa9, 0xda, 0xae,
+  0xab, 0xdf, 0xdd, 0xab, 0x54, 0x80, 0x3f, 0x4d, 0x2e, 0x4c, 0x95, 0xb8,
+  0xa9, 0x82, 0xb2, 0xbb, 0x5b, 0x1d, 0x32, 0xba, 0xc8, 0xb4, 0x9f, 0x86,
+  0x66, 0xb0, 0x71, 0xb8, 0x75, 0x49, 0x93, 0x86, 0x25, 0x50, 0xb7, 0x9a,
+  0x5a, 0x59, 0x89, 0x6f, 0xc8, 0x56, 0x06, 0x70, 0x7b, 0x2d, 0xb9, 0xc7,
+  0xa8, 0xb2, 0x72, 0x75, 0x50, 0x42, 0x96, 0xb3, 0xe8, 0xa9, 0xd3, 0xc5,
+  0x77, 0x8e, 0x94, 0x9e, 0x72, 0xa6, 0x53, 0x73, 0xba, 0xc1, 0xd2, 0xcb,
+  0xb1, 0x74, 0x86, 0xd9, 0xaf, 0x6d, 0x52, 0xc7, 0xbe, 0x79, 0x6e, 0x4d,
+  0x6c, 0x5c, 0x77, 0x21, 0x52, 0x82, 0x54, 0xae, 0x8e, 0x52, 0x76, 0x8c,
+  0x73, 0x74, 0x90, 0x9c, 0x5d, 0x85, 0x66, 0x96, 0xd8, 0xd2, 0xa2, 0x8a,
+  0x69, 0x9d, 0xa1, 0x8b, 0x33, 0x5c, 0x94, 0x79, 0x75, 0x34, 0x2e, 0x56,
+  0xa6, 0x77, 0xaf, 0xa4, 0x4c, 0x8f, 0x90, 0xb6, 0x85, 0xa9, 0xc1, 0xc2,
+  0x9b, 0x62, 0x68, 0xa5, 0xb3, 0x76, 0x54, 0x53, 0x73, 0x54, 0x83, 0x7d,
+  0xb6, 0x7c, 0x33, 0x6f, 0xa1, 0xc1, 0xce, 0xa8, 0xa5, 0x97, 0x87, 0xa4,
+  0x7e, 0x5b, 0x6f, 0x9d, 0x88, 0x51, 0x9f, 0xa9, 0xa0, 0x5f, 0x94, 0xb0,
+  0x9c, 0xb3, 0x3a, 0x34, 0xb3, 0x5a, 0xab, 0x7b, 0x6c, 0x73, 0x84, 0xb7,
+  0xa9, 0x7c, 0x6d, 0x99, 0xbc, 0xce, 0xa6, 0xa3, 0x6e, 0x62, 0x2c, 0x80,
+  0x66, 0x72, 0xa9, 0x9b, 0x74, 0x85, 0xa9, 0xb4, 0xcf, 0x9b, 0x7a, 0xa6,
+  0xbc, 0x87, 0x43, 0x87, 0x95, 0x91, 0x74, 0x9d, 0x8f, 0x72, 0xa4, 0x8a,
+  0x83, 0xc4, 0x98, 0xa2, 0xb4, 0xc6, 0xb9, 0xa1, 0x8d, 0xbe, 0xa5, 0xb1,
+  0x7f, 0xbe, 0x74, 0x83, 0x96, 0xa2, 0xab, 0xad, 0x85, 0xb1, 0xb8, 0xbd,
+  0xba, 0x5b, 0x67, 0x85, 0xbb, 0x82, 0x33, 0x88, 0xa2, 0x7b, 0x57, 0xa1,
+  0x69, 0x6c, 0x7a, 0x86, 0x8c, 0x4e, 0x69, 0x75, 0x90, 0x7f, 0x7a, 0x60,
+  0x46, 0xaa, 0x58, 0x45, 0x72, 0x8c, 0x89, 0x5d, 0x96, 0xaf, 0xbb, 0x74,
+  0x7f, 0x5b, 0x8f, 0x99, 0xc8, 0xd5, 0x98, 0x7c, 0xa5, 0x98, 0xa3, 0xb6,
+  0x7e, 0x54, 0x68, 0x95, 0x97, 0x94, 0xa2, 0xab, 0x80, 0xbf, 0xc1, 0x6b,
+  0x6c, 0xb8, 0xbc, 0xd5, 0x9a, 0x9d, 0x8c, 0xda, 0xc9, 0xc5, 0xab, 0xbc,
+  0xb7, 0x99, 0x81, 0xae, 0xa7, 0x75, 0x45, 0x38, 0x74, 0x7c, 0x61, 0x54,
+  0xa6, 0x87, 0x9e, 0x73, 0x82, 0xa2, 0x8d, 0xa7, 0xba, 0x6e, 0x48, 0x92,
+  0xb4, 0xae, 0xae, 0x95, 0x7c, 0x66, 0x7d, 0x9e, 0x9b, 0x85, 0xb5, 0xa9,
+  0x6a, 0x8a, 0xbe, 0xa9, 0xab, 0xb2, 0x91, 0x8f, 0x84, 0x9c, 0xb9, 0xc8,
+  0x92, 0x80, 0x88, 0xae, 0x7d, 0x70, 0x85, 0x92, 0xd9, 0xc0, 0x78, 0x56,
+  0x7d, 0x94, 0x4b, 0x63, 0xe0, 0xba, 0xba, 0x9e, 0x9f, 0xb2, 0xbd, 0xc6,
+  0xa5, 0x79, 0x5f, 0x84, 0xa2, 0xa0, 0x89, 0x50, 0x2c, 0x7c, 0xaf, 0xbe,
+  0x87, 0x88, 0x8c, 0xa3, 0x78, 0x87, 0xd2, 0xa7, 0x61, 0x32, 0x14, 0x4d,
+  0x6d, 0x86, 0x91, 0x7b, 0xb8, 0xac, 0x76, 0x83, 0x8f, 0x17, 0x73, 0xa0,
+  0xbf, 0x7c, 0x44, 0xc2, 0x68, 0xae, 0x79, 0x66, 0xd7, 0xdf, 0xbe, 0xe0,
+  0xae, 0xa7, 0xae, 0xc9, 0xaf, 0xa1, 0xa2, 0xc0, 0xea, 0xc4, 0x82, 0x98,
+  0x76, 0x89, 0x80, 0x83, 0x91, 0x72, 0x96, 0xa1, 0x6d, 0x53, 0x28, 0x27,
+  0x58, 0x68, 0x8d, 0x88, 0x70, 0x75, 0x4c, 0xa1, 0x96, 0x6f, 0xb7, 0xb0,
+  0xc0, 0xa7, 0xd4, 0xaf, 0x7d, 0xa4, 0xa1, 0xb8, 0xd5, 0x82, 0x60, 0x5e,
+  0xb2, 0xdc, 0x70, 0x35, 0x6a, 0xd7, 0xb3, 0x88, 0x6e, 0xdd, 0x9f, 0xa4,
+  0x9b, 0x3e, 0x48, 0x2b, 0xcf, 0xaa, 0xcb, 0xaa, 0x7a, 0x4b, 0x97, 0x89,
+  0x96, 0x54, 0x97, 0xbe, 0xbe, 0xbc, 0xa5, 0x6f, 0xa2, 0xc9, 0x92, 0x43,
+  0x5b, 0x96, 0xa1, 0x97, 0x8c, 0x73, 0x7c, 0x8d, 0x7e, 0x5c, 0xbd, 0xb5,
+  0x86, 0x55, 0x65, 0xc2, 0x9b, 0x7d, 0x71, 0x7a, 0xb7, 0xa6, 0x5f, 0x87,
+  0x7b, 0x66, 0x33, 0x42, 0xd0, 0xa9, 0x4a, 0x68, 0xbd, 0xa4, 0x89, 0x8e,
+  0x8d, 0x89, 0x45, 0x2c, 0xd5, 0xcf, 0xc0, 0xb7, 0x9b, 0xac, 0xe2, 0xcc,
+  0xb7, 0xea, 0xd4, 0xb3, 0xc4, 0xba, 0x96, 0xa3, 0x8f, 0x59, 0x5e, 0xb0,
+  0xa4, 0x5c, 0x6e, 0x9e, 0xb9, 0xc3, 0xba, 0x51, 0x4e, 0x8a, 0xa7, 0xab,
+  0x86, 0x8e, 0x8a, 0x66, 0x88, 0xa4, 0x97, 0x5a, 0x62, 0x84, 0xc2, 0xcd,
+  0x59, 0x92, 0x9a, 0x84, 0x82, 0x99, 0x8a, 0x96, 0x83, 0xdc, 0xc8, 0xaa,
+  0xae, 0x5a, 0x8c, 0xb6, 0xa4, 0xd2, 0xcc, 0xa7, 0x84, 0xa9, 0xdf, 0xa4,
+  0xa4, 0xa5, 0xbd, 0xbc, 0x7b, 0x64, 0xa0, 0x35, 0xcb, 0x55, 0x48, 0x96,
+  0x60, 0x2f, 0x40, 0x82, 0x6d, 0xe8, 0xeb, 0x73, 0x25, 0x72, 0x97, 0xda,
+  0xcd, 0x94, 0xb7, 0xaa, 0x8a, 0x5f, 0x8c, 0xa8, 0xa1, 0xaa, 0xbd, 0x95,
+  0xc8, 0xa3, 0xbf, 0xcf, 0xab, 0xa5, 0x79, 0x97, 0xd2, 0x97, 0x9f, 0x6d,
+  0x5d, 0xb4, 0xa8, 0x65, 0xe1, 0xcb, 0xe2, 0xcd, 0xd0, 0x89, 0x36, 0x86,
+  0xad, 0xdc, 0xc3, 0xb2, 0xb6, 0x9d, 0xae, 0xe1, 0xca, 0xb6, 0xea, 0xbd,
+  0xb1, 0x9e, 0x39, 0xac, 0xb4, 0x4f, 0x69, 0x63, 0xa0, 0xc2, 0xaa, 0x9f,
+  0xa4, 0xa7, 0x89, 0x64, 0x36, 0x31, 0xa5, 0xa2, 0x94, 0x72, 0x99, 0x78,
+  0x3c, 0x71, 0xd2, 0xcd, 0xd8, 0x95, 0x9c, 0xdf, 0x93, 0x81, 0xae, 0x9d,
+  0x7f, 0xac, 0x70, 0x5a, 0x37, 0x78, 0xb4, 0xe7, 0xcc, 0x9a, 0x56, 0x64,
+  0x9b, 0xbb, 0xde, 0x7a, 0x98, 0xa8, 0xb4, 0xcf, 0xd6, 0xb0, 0x88, 0xc2,
+  0xbd, 0xc5, 0xb3, 0xae, 0xb0, 0xbb, 0x5a, 0x97, 0xd6, 0xab, 0x70, 0xac,
+  0x96, 0xb4, 0xe6, 0xcc, 0x79, 0xa8, 0xce, 0xa7, 0xd0, 0xb5, 0xa6, 0x69,
+  0x54, 0x42, 0x1a, 0x51, 0x9d, 0xcf, 0xd0, 0x4c, 0x42, 0x99, 0x57, 0x46,
+  0x56, 0xd0, 0xbd, 0xa6, 0xae, 0xb9, 0xc9, 0x67, 0x20, 0x55, 0xa6, 0xda,
+  0xde, 0xb7, 0x85, 0x5a, 0x6d, 0xa6, 0x4d, 0x35, 0x6f, 0xa9, 0xd5, 0xc2,
+  0xa1, 0xbe, 0x88, 0xb9, 0xad, 0x80, 0x8d, 0x9d, 0x71, 0xbe, 0x61, 0x57,
+  0xcd, 0x72, 0xbe, 0x7f, 0x8f, 0xb5, 0x76, 0x87, 0xc3, 0xd6, 0xd2, 0xc4,
+  0xc2, 0x7a, 0x63, 0x9d, 0x5a, 0x9b, 0x81, 0xa8, 0x39, 0x88, 0x90, 0xa8,
+  0xc1, 0x8e, 0x40, 0xc8, 0xb8, 0x85, 0x84, 0x50, 0x67, 0x7b, 0xad, 0xa1,
+  0x56, 0x1b, 0x51, 0xd4, 0xc9, 0xb4, 0x76, 0x29, 0x31, 0x92, 0xcf, 0xe3,
+  0x7c, 0x89, 0x94, 0x8c, 0xdb, 0xb6, 0x6f, 0x88, 0x6c, 0xbf, 0xbc, 0x6f,
+  0x70, 0xcf, 0xa9, 0x72, 0x72, 0x62, 0xa9, 0x9b, 0x6b, 0x80, 0x7d, 0xed,
+  0xc9, 0x97, 0xb6, 0x7a, 0x54, 0xaa, 0xc7, 0xdc, 0xc5, 0x89, 0x5d, 0xb2,
+  0x9d, 0x5b, 0xa1, 0xc2, 0x83, 0xc5, 0xbe, 0x7c, 0x91, 0x9d, 0xd6, 0xe8,
+  0xbb, 0x7f, 0xaf, 0x88, 0x76, 0x65, 0xbf, 0x6a, 0xbd, 0xd2, 0xbe, 0x98,
+  0xb6, 0xcc, 0xdb, 0xa5, 0xc9, 0xea, 0xb8, 0xc7, 0xc2, 0xeb, 0xbd, 0xc1,
+  0xc3, 0xc1, 0xa5, 0x74, 0x40, 0x6d, 0xb0, 0x7a, 0x97, 0x99, 0x67, 0x9a,
+  0x82, 0x93, 0x96, 0x70, 0x9c, 0xb9, 0x91, 0x74, 0x64, 0x9a, 0x41, 0x9a,
+  0x70, 0x99, 0xd2, 0xbd, 0xa3, 0x89, 0xa2, 0x71, 0x90, 0xb0, 0x7b, 0x8f,
+  0xc4, 0xc8, 0xb4, 0xab, 0xd9, 0x9a, 0x7b, 0xb3, 0xc0, 0xae, 0x99, 0x79,
+  0x93, 0x81, 0xbb, 0xb0, 0x40, 0x47, 0xba, 0xa9, 0xb0, 0xb8, 0xa2, 0x79,
+  0xb3, 0xcf, 0x94, 0xca, 0x61, 0x55, 0xb2, 0x8e, 0x6b, 0xb9, 0xb5, 0x37,
+  0x03, 0x10, 0x66, 0x85, 0xba, 0x9f, 0x77, 0xc7, 0xe1, 0xaa, 0xa4, 0x72,
+  0x17, 0x92, 0xbe, 0xc4, 0x8f, 0x62, 0x39, 0x8c, 0xad, 0x4a, 0x51, 0xac,
+  0xad, 0x87, 0xb6, 0xa6, 0xab, 0x94, 0x8a, 0xcd, 0xc4, 0x96, 0xae, 0x82,
+  0xaa, 0xd6, 0xb9, 0x71, 0x26, 0x62, 0xc7, 0xdb, 0xec, 0xea, 0xce, 0x7b,
+  0xc3, 0xbf, 0xb4, 0xd2, 0xb9, 0xad, 0xba, 0xc5, 0xbe, 0xb9, 0xe2, 0xb2,
+  0x58, 0x2e, 0x8e, 0xb9, 0x8b, 0xbf, 0xa1, 0xb6, 0x8f, 0xa2, 0xa4, 0x77,
+  0x98, 0xbf, 0xa8, 0xd8, 0x61, 0x87, 0x95, 0x5f, 0x4a, 0x76, 0x6d, 0x93,
+  0xb6, 0x98, 0x66, 0x4e, 0x76, 0xae, 0xbb, 0x28, 0x2f, 0xa7, 0xd7, 0xd5,
+  0xb5, 0x7f, 0x66, 0x45, 0x3c, 0x58, 0x52, 0x9a, 0xb8, 0xa8, 0x71, 0x5c,
+  0x78, 0x81, 0xc5, 0x9c, 0x84, 0xc2, 0x9b, 0x38, 0x6f, 0xc9, 0xa6, 0x9a,
+  0x99, 0x74, 0xd3, 0xcd, 0x70, 0x56, 0xb0, 0xa4, 0x5b, 0x96, 0xad, 0x92,
+  0x8e, 0xdf, 0xa6, 0x9f, 0x9a, 0x56, 0x80, 0x87, 0x1d, 0x78, 0x6c, 0xb3,
+  0x8e, 0x41, 0x8c, 0x3d, 0xa8, 0xc8, 0xd1, 0xe8, 0xaf, 0x70, 0x61, 0x42,
+  0xad, 0x94, 0x98, 0x9c, 0xcd, 0xbb, 0xcf, 0x8e, 0x9f, 0xa6, 0xb2, 0xdf,
+  0xc2, 0x8d, 0x87, 0xb0, 0xb7, 0xce, 0xb5, 0x87, 0x91, 0xe0, 0xd1, 0xa5,
+  0x97, 0x4d, 0x63, 0x6a, 0x79, 0x33, 0x90, 0x9f, 0xbb, 0x9c, 0xae, 0xc0,
+  0xaa, 0xc0, 0xb7, 0xa0, 0xb1, 0x84, 0x59, 0x6f, 0x81, 0x9a, 0x91, 0xa7,
+  0x86, 0xac, 0x96, 0xae, 0xa4, 0xc7, 0xa5, 0x3e, 0x7a, 0xa8, 0xbe, 0x52,
+  0xaa, 0x7b, 0xa6, 0x56, 0x5b, 0x44, 0xc5, 0xe5, 0xe1, 0xa6, 0x97, 0x79,
+  0x9c, 0x88, 0xb8, 0x98, 0xa1, 0x9d, 0xc9, 0x90, 0x7a, 0x45, 0x71, 0xc3,
+  0x9d, 0x76, 0xd5, 0xd0, 0x8b, 0x9b, 0x98, 0x9b, 0xb2, 0xcf, 0xba, 0xe6,
+  0xd9, 0x91, 0xb2, 0xc9, 0xbe, 0x81, 0x5f, 0xaa, 0x46, 0x9f, 0x76, 0x72,
+  0x70, 0x48, 0xac, 0xc3, 0xc2, 0x54, 0xa7, 0xbe, 0xa4, 0xb4, 0xdc, 0xb5,
+  0xcb, 0x9d, 0x93, 0xe7, 0xde, 0xcf, 0x7c, 0x33, 0xcf, 0xc8, 0x6e, 0xa7,
+  0xb5, 0xa4, 0xa1, 0xb4, 0x51, 0x33, 0x49, 0x60, 0x4b, 0xb2, 0xd0, 0xb4,
+  0x82, 0xbd, 0xae, 0xdb, 0xa9, 0xac, 0xdf, 0xdb, 0xe7, 0xcb, 0x95, 0xa1,
+  0x85, 0x66, 0x6f, 0xad, 0xa7, 0x97, 0xb4, 0xac, 0xa6, 0xa1, 0x86, 0xb9,
+  0xa5, 0x98, 0x75, 0x78, 0xa2, 0x7e, 0x69, 0x46, 0x55, 0x85, 0x9e, 0xd3,
+  0x9c, 0xd8, 0xe7, 0xac, 0xa5, 0x6d, 0x7e, 0x8d, 0x6d, 0x95, 0xc9, 0xd0,
+  0x6e, 0x31, 0xbf, 0xb1, 0xb4, 0xb8, 0xc1, 0xd2, 0xc4, 0xc3, 0x83, 0xaa,
+  0xbc, 0xb5, 0x6a, 0x9d, 0x75, 0x3d, 0x2e, 0xb8, 0xe2, 0x8e, 0xb0, 0xb8,
+  0xc7, 0xd6, 0x74, 0x42, 0x90, 0xd0, 0x9b, 0xbf, 0xc2, 0xce, 0xc0, 0xb3,
+  0x70, 0xaf, 0xe0, 0xe3, 0x8f, 0x7e, 0x3b, 0xa3, 0xae, 0xc0, 0x23, 0xc3,
+  0xef, 0xcf, 0x9d, 0xb4, 0x86, 0x47, 0x56, 0x42, 0x88, 0x8d, 0x37, 0xb2,
+  0xbd, 0xa2, 0xb5, 0x72, 0x9a, 0x84, 0x8f, 0x56, 0xbd, 0xb8, 0x94, 0xd4,
+  0xb1, 0x7d, 0x56, 0x35, 0x2a, 0x77, 0xae, 0xa6, 0xb6, 0x46, 0x65, 0x85,
+  0x8d, 0x6c, 0xcf, 0xab, 0x88, 0xce, 0xc8, 0x99, 0x86, 0xcf, 0xa4, 0xbb,
+  0x72, 0x7f, 0xaf, 0x97, 0xab, 0xcf, 0x71, 0x53, 0x5c, 0x71, 0xa0, 0xc2,
+  0x7f, 0x66, 0x48, 0xa4, 0x9b, 0x55, 0x63, 0x7f, 0x8b, 0x57, 0xab, 0xa4,
+  0xbd, 0xb0, 0x4a, 0x68, 0x8e, 0x6b, 0x86, 0xdc, 0xd5, 0x7a, 0x68, 0x92,
+  0x7c, 0x81, 0x6e, 0xb8, 0xb2, 0xda, 0xd4, 0xea, 0xc8, 0xc8, 0x9c, 0x74,
+  0x5e, 0xaf, 0x93, 0x4b, 0xe2, 0xe2, 0xcd, 0xa3, 0xc1, 0xb3, 0xb3, 0x83,
+  0x93, 0xb5, 0xb6, 0x9e, 0xba, 0xbe, 0xaa, 0x7e, 0x63, 0x44, 0x8f, 0xc4,
+  0xb2, 0xc1, 0xbc, 0x51, 0x7b, 0xd0, 0x9c, 0x66, 0xa0, 0x8b, 0xc4, 0xc2,
+  0x5b, 0x87, 0x6a, 0xb0, 0x73, 0x93, 0x52, 0x6a, 0xd4, 0x6a, 0x6b, 0x9f,
+  0xa2, 0xaf, 0xa4, 0xad, 0x56, 0x5b, 0x8a, 0x8e, 0x91, 0xa0, 0x6e, 0x46,
+  0x81, 0x74, 0x9b, 0x7c, 0xc4, 0x6d, 0xac, 0x80, 0xb7, 0xa3, 0x89, 0xb8,
+  0x6d, 0x51, 0xda, 0xcc, 0x97, 0x83, 0x57, 0xa5, 0xbe, 0x93, 0xaf, 0xb6,
+  0xcd, 0xca, 0xba, 0xb1, 0x84, 0x85, 0x36, 0x79, 0xa2, 0x75, 0x46, 0xcd,
+  0xb0, 0x6b, 0xbd, 0xb5, 0x9a, 0x49, 0xa1, 0x9a, 0xa0, 0xc6, 0xb5, 0x9a,
+  0xb2, 0xba, 0xac, 0xd3, 0xaa, 0x9e, 0x71, 0x68, 0x51, 0x26, 0x1a, 0x11,
+  0x5b, 0xa3, 0xbe, 0x96, 0xc7, 0xe9, 0xa4, 0xc9, 0x9a, 0x6b, 0xcb, 0x4c,
+  0x79, 0xaf, 0x9e, 0x90, 0x97, 0xa1, 0xbd, 0xb5, 0xa0, 0x71, 0x62, 0x7d,
+  0x36, 0x9d, 0x89, 0xdd, 0xb6, 0x5a, 0x15, 0x1d, 0x70, 0xbd, 0xc8, 0xc2,
+  0x5a, 0xbc, 0xe8, 0xdb, 0xb7, 0x50, 0x56, 0xbe, 0x8a, 0x7c, 0x96, 0x81,
+  0x7e, 0x5e, 0x57, 0x30, 0xb7, 0xc7, 0x82, 0x82, 0x50, 0x5e, 0xb5, 0xd3,
+  0xa6, 0x89, 0x73, 0xc4, 0xe6, 0xc5, 0xc5, 0x58, 0x40, 0x82, 0xa3, 0x6c,
+  0x90, 0xc7, 0xc4, 0xad, 0xd8, 0xc4, 0xb7, 0xb2, 0x9b, 0x82, 0xa5, 0x9c,
+  0x8e, 0x91, 0x6e, 0x2a, 0x93, 0xa1, 0xb2, 0x4c, 0x4e, 0x6e, 0xa3, 0xc8,
+  0xa1, 0x9a, 0x56, 0x73, 0xa0, 0xbc, 0x88, 0xb9, 0xb9, 0xc5, 0x53, 0x74,
+  0xe3, 0xeb, 0xf0, 0x8a, 0x58, 0xe3, 0x9d, 0x2c, 0x74, 0xb9, 0x43, 0x8e,
+  0xae, 0x91, 0x55, 0x2d, 0x62, 0x8c, 0xc7, 0x8e, 0x6d, 0x75, 0xac, 0x3a,
+  0xb7, 0xac, 0xac, 0x5d, 0x1c, 0x4a, 0xa8, 0xa4, 0x98, 0x6e, 0x4c, 0xb1,
+  0x3b, 0x86, 0x61, 0x92, 0xe1, 0xc8, 0x97, 0x22, 0x3b, 0x7f, 0x5c, 0x63,
+  0xa4, 0x41, 0x55, 0x90, 0xa0, 0x8a, 0x60, 0xb0, 0x4d, 0x62, 0x99, 0xb3,
+  0x9b, 0x98, 0x80, 0xb3, 0xd1, 0xc5, 0x80, 0xb5, 0xc6, 0xbb, 0x82, 0x61,
+  0x5b, 0x88, 0x87, 0xa9, 0xa0, 0x6e, 0xb8, 0xbf, 0xd2, 0xa2, 0x72, 0xba,
+  0xdf, 0xc6, 0xf8, 0xe1, 0x8f, 0x7a, 0xa0, 0xbf, 0xaf, 0xb6, 0x63, 0x76,
+  0x79, 0x9f, 0xa4, 0xd2, 0xa7, 0x4b, 0xe1, 0xdb, 0x93, 0x90, 0xb7, 0x76,
+  0x5a, 0x8f, 0xb9, 0x56, 0x8c, 0xac, 0x8b, 0xec, 0xe7, 0xa9, 0x6e, 0x6f,
+  0xa7, 0x93, 0x89, 0x88, 0xc4, 0x96, 0x8e, 0x22, 0x7d, 0xb0, 0x9f, 0xa7,
+  0x6e, 0x73, 0xf1, 0x9f, 0x31, 0xc4, 0xda, 0xd4, 0xc7, 0xe8, 0x4d, 0x58,
+  0xcc, 0x8a, 0xa9, 0xae, 0xc0, 0x6f, 0x85, 0x71, 0x70, 0x84, 0xd8, 0x9f,
+  0x71, 0xbc, 0xbf, 0xab, 0x93, 0x89, 0x1c, 0xaf, 0x81, 0x76, 0xb7, 0xaf,
+  0x72, 0x56, 0x7d, 0x8b, 0x88, 0x86, 0x9d, 0xb2, 0x6a, 0x7e, 0xc2, 0x9a,
+  0x6c, 0xc3, 0x92, 0x8e, 0x63, 0x1b, 0xb6, 0x4c, 0x36, 0x46, 0xb3, 0x6e,
+  0xab, 0xdc, 0xd9, 0xa2, 0x7e, 0xda, 0xd3, 0x78, 0x54, 0xdb, 0x94, 0x99,
+  0x5c, 0xa6, 0xa4, 0xaf, 0xa3, 0xa8, 0x81, 0x8d, 0xdf, 0xb5, 0xc7, 0xf2,
+  0xf0, 0xaa, 0xbe, 0x83, 0xbb, 0x93, 0x77, 0x81, 0x32, 0x6e, 0xa2, 0xca,
+  0x91, 0x3f, 0xdd, 0xdd, 0x47, 0x86, 0x66, 0xce, 0xd6, 0xbf, 0xb7, 0x91,
+  0x68, 0x61, 0x9c, 0xcb, 0xcf, 0xb2, 0x5c, 0x5b, 0xe0, 0x92, 0x91, 0xab,
+  0xb6, 0x5e, 0x85, 0x4d, 0x33, 0x84, 0x6b, 0x62, 0x99, 0x47, 0xad, 0xa1,
+  0x28, 0x6f, 0xdd, 0xb3, 0x8c, 0xab, 0x8c, 0x61, 0xa3, 0x82, 0x53, 0xc9,
+  0x91, 0x88, 0x3a, 0x6e, 0xa0, 0x78, 0x81, 0xc7, 0xbb, 0xc6, 0xc4, 0xc4,
+  0x9f, 0x8d, 0xb1, 0xd6, 0xde, 0xc8, 0xcc, 0x7a, 0x69, 0x1d, 0x13, 0x7e,
+  0x67, 0x44, 0x8a, 0xc2, 0x9e, 0x5b, 0x95, 0xc8, 0xc2, 0x5d, 0x55, 0xc1,
+  0xe2, 0xae, 0xac, 0xc2, 0x95, 0x70, 0x8a, 0xae, 0x9b, 0xb3, 0xd7, 0xdc,
+  0xbd, 0xc5, 0xda, 0x96, 0x37, 0x64, 0x85, 0x6e, 0x7d, 0x6a, 0x81, 0x8a,
+  0x9e, 0xeb, 0xdb, 0xb1, 0xa2, 0xa6, 0xcc, 0xdd, 0xcc, 0xc9, 0xd0, 0xb5,
+  0xb5, 0xac, 0x45, 0x49, 0x8b, 0x90, 0x71, 0x88, 0x9e, 0x25, 0x3b, 0xd3,
+  0xde, 0xb1, 0xcf, 0xad, 0x81, 0x91, 0xb1, 0xa6, 0xa4, 0x37, 0x2c, 0x9a,
+  0x81, 0x5e, 0x8c, 0xd1, 0x94, 0xa5, 0x57, 0x5b, 0xa8, 0xbd, 0xd8, 0xce,
+  0x90, 0xbe, 0xdc, 0xc2, 0x93, 0x9d, 0x48, 0x67, 0x62, 0x79, 0x70, 0x7f,
+  0x6c, 0x51, 0xd2, 0xb0, 0xcc, 0xa8, 0x66, 0x7c, 0x77, 0x7b, 0x89, 0x61,
+  0x48, 0x6b, 0xb3, 0x56, 0x75, 0x6f, 0x70, 0x8c, 0x7e, 0x69, 0x56, 0x99,
+  0xdb, 0x87, 0xc6, 0xc6, 0xec, 0xc9, 0x78, 0x3b, 0xbb, 0x56, 0x3f, 0xa0,
+  0x96, 0x27, 0x63, 0x77, 0x67, 0xa9, 0x44, 0x40, 0x93, 0xea, 0xdd, 0xd1,
+  0xd7, 0xde, 0xc2, 0x9a, 0x84, 0x51, 0x84, 0x80, 0xc0, 0xd4, 0xce, 0xa4,
+  0x82, 0xb0, 0x65, 0x62, 0x84, 0x48, 0x8b, 0x6f, 0xbe, 0xdd, 0xcb, 0xc0,
+  0xc8, 0x7d, 0x8f, 0xb6, 0xbe, 0x75, 0xc9, 0xdc, 0x89, 0x9d, 0x81, 0x71,
+  0xba, 0xa5, 0xb8, 0x45, 0x63, 0x8c, 0x6d, 0x88, 0xde, 0xd1, 0xde, 0xc8,
+  0xc9, 0x6a, 0x30, 0x60, 0xa7, 0xaf, 0x6c, 0x7a, 0xc9, 0x89, 0x76, 0xc2,
+  0x7c, 0x8c, 0xb0, 0x57, 0x93, 0xa7, 0x81, 0xbf, 0xb2, 0xe1, 0xc8, 0xe7,
+  0x8b, 0x47, 0x47, 0x3c, 0x49, 0x32, 0x7c, 0xce, 0xd8, 0x92, 0x9f, 0xc2,
+  0xa5, 0x9e, 0x93, 0x54, 0x84, 0xb1, 0xa2, 0xaa, 0xa4, 0x42, 0x7d, 0x8c,
+  0x70, 0xa8, 0x9b, 0x99, 0x94, 0x80, 0xc2, 0x4d, 0x87, 0x95, 0x68, 0xc6,
+  0xc5, 0xcb, 0xac, 0x92, 0xba, 0x92, 0x63, 0x71, 0x70, 0x03, 0x28, 0xb5,
+  0x5d, 0x71, 0x93, 0xae, 0x97, 0xd9, 0xe9, 0xc3, 0xa9, 0xde, 0x48, 0x39,
+  0x56, 0x69, 0x36, 0x1b, 0x51, 0x63, 0x5f, 0x81, 0x6c, 0x8c, 0x6b, 0x5c,
+  0x76, 0x38, 0x63, 0x5a, 0x8c, 0xcf, 0x99, 0x85, 0x7c, 0x83, 0xbb, 0x34,
+  0x8a, 0x54, 0x1d, 0x8c, 0x82, 0x67, 0x5a, 0xb1, 0xa2, 0x8c, 0xc3, 0xcc,
+  0x88, 0xae, 0xb8, 0x3e, 0xa5, 0xaf, 0xac, 0xac, 0xcf, 0xd6, 0x98, 0x8b,
+  0xb5, 0x88, 0xab, 0x70, 0x98, 0xa6, 0x4d, 0x9c, 0xcc, 0xa1, 0x79, 0x2c,
+  0x36, 0x4a, 0x6f, 0x6e, 0x65, 0x32, 0x6f, 0xd8, 0xdb, 0xbc, 0x8b, 0x71,
+  0xbc, 0xad, 0x80, 0xb9, 0xbc, 0x5f, 0xa2, 0xa4, 0x62, 0x63, 0x95, 0xd3,
+  0xd7, 0xbe, 0xa7, 0x77, 0x81, 0xc3, 0x97, 0x5e, 0x75, 0x41, 0x35, 0x85,
+  0x84, 0xcd, 0xbf, 0x9d, 0xc8, 0xa4, 0x9b, 0xa2, 0x5d, 0x2c, 0x51, 0xb9,
+  0xb8, 0x9d, 0xcb, 0xb2, 0xaf, 0x90, 0x3c, 0x4b, 0xb6, 0x7b, 0x5a, 0x66,
+  0x60, 0x98, 0xb0, 0xaf, 0xa2, 0xb0, 0x7d, 0x6a, 0x6f, 0x8b, 0x52, 0x78,
+  0xaa, 0xae, 0xba, 0x92, 0xb4, 0x51, 0x46, 0x5c, 0xd1, 0x9f, 0x6a, 0x59,
+  0x93, 0xbf, 0xdd, 0x99, 0x81, 0x85, 0x94, 0xa2, 0x94, 0x49, 0x9d, 0x6a,
+  0x80, 0xa8, 0xa4, 0x8d, 0xbf, 0x82, 0xb0, 0xdb, 0xa6, 0x66, 0xa9, 0xa5,
+  0x94, 0xa0, 0xb4, 0x8c, 0x6a, 0xaa, 0xab, 0x73, 0x77, 0x99, 0xab, 0xcc,
+  0x9c, 0x6e, 0x91, 0x72, 0x4c, 0x97, 0xb4, 0x94, 0xaa, 0x84, 0xe9, 0xb1,
+  0x88, 0x49, 0x35, 0x7a, 0xa6, 0xd0, 0xc7, 0x89, 0x9e, 0xae, 0x9e, 0x63,
+  0x95, 0xae, 0x92, 0xad, 0x77, 0x7a, 0x44, 0x89, 0xd2, 0x89, 0x68, 0x5c,
+  0x7d, 0x7d, 0xa2, 0x71, 0x6b, 0x80, 0x6b, 0x7f, 0x53, 0x72, 0xbd, 0xc6,
+  0xf1, 0xdb, 0xab, 0x60, 0xa8, 0x9e, 0x4a, 0x74, 0xd4, 0x7a, 0x8d, 0xbf,
+  0xbc, 0x88, 0x77, 0x54, 0x36, 0x22, 0x59, 0x56, 0xb4, 0x46, 0x53, 0x87,
+  0xdb, 0xe1, 0x81, 0x30, 0x78, 0xc2, 0x8b, 0x18, 0x54, 0x45, 0x9d, 0xd8,
+  0xb2, 0x8c, 0x0f, 0x5e, 0xc5, 0xb5, 0xcd, 0xc4, 0x87, 0x7e, 0x9e, 0x9d,
+  0x9b, 0x64, 0x94, 0x5b, 0xd6, 0xa4, 0xb2, 0xbe, 0xb0, 0xaa, 0xd7, 0xb5,
+  0xc4, 0xd3, 0x9f, 0xc2, 0xd9, 0xa7, 0x80, 0xd1, 0xd2, 0xb6, 0x71, 0xb9,
+  0xb1, 0xbf, 0x5f, 0xad, 0x70, 0x52, 0x33, 0xa3, 0xdd, 0xb1, 0xa8, 0xa4,
+  0x5b, 0x61, 0x9c, 0xa1, 0xca, 0x9e, 0xb9, 0xd5, 0x9b, 0xcc, 0xbd, 0xa2,
+  0x8c, 0x97, 0xab, 0x9b, 0xbc, 0xae, 0x6a, 0x41, 0xc9, 0xcc, 0xc5, 0xa4,
+  0x98, 0xc6, 0x81, 0xa5, 0xc7, 0xe3, 0xe2, 0xb3, 0xb7, 0x92, 0x9c, 0xc0,
+  0x62, 0x1a, 0x22, 0x5c, 0x68, 0x49, 0x82, 0xb0, 0x88, 0xbc, 0xb6, 0xa9,
+  0xa8, 0x62, 0x6a, 0xd0, 0x9e, 0xac, 0x3f, 0x80, 0xb7, 0xb3, 0x6a, 0x80,
+  0xd6, 0xc7, 0xd7, 0x96, 0xc3, 0xb2, 0x76, 0x4c, 0x7a, 0xdc, 0xce, 0x5e,
+  0x8a, 0xb9, 0xba, 0x92, 0x83, 0x9c, 0x7e, 0xc7, 0xc9, 0xb1, 0x8d, 0x32,
+  0x9f, 0x58, 0x99, 0x90, 0x8d, 0xa7, 0x9e, 0xb1, 0xcd, 0x7c, 0xc0, 0x83,
+  0x79, 0xb4, 0x9f, 0x67, 0x48, 0xa0, 0xc3, 0xac, 0x91, 0xaf, 0x93, 0x73,
+  0x79, 0xbe, 0xc8, 0x83, 0xba, 0xe4, 0x6e, 0x94, 0x9d, 0xc7, 0xc6, 0x9d,
+  0xa0, 0x73, 0x80, 0x2d, 0x78, 0x84, 0x89, 0xa1, 0xa5, 0x6f, 0x4b, 0x76,
+  0x61, 0xc8, 0xd0, 0xe2, 0xa2, 0x71, 0x92, 0xb4, 0xdc, 0xc8, 0xc8, 0x9c,
+  0xa1, 0xcb, 0xa0, 0x95, 0xc8, 0x98, 0x99, 0x82, 0x63, 0xaf, 0xa3, 0xa3,
+  0xda, 0xb0, 0x92, 0x58, 0xba, 0xbc, 0x5d, 0x99, 0xa9, 0xae, 0xc8, 0x88,
+  0x79, 0x26, 0x82, 0xd7, 0x91, 0x7c, 0xc4, 0xc0, 0x85, 0x88, 0x95, 0x4d,
+  0xc8, 0xcf, 0x80, 0x72, 0x64, 0xb7, 0xac, 0xc6, 0x72, 0xd3, 0xd0, 0xc5,
+  0xb5, 0x97, 0x88, 0xc3, 0xa7, 0x99, 0xd1, 0x8f, 0xa8, 0xbf, 0xc1, 0x99,
+  0x60, 0x62, 0xcc, 0x91, 0xc1, 0x7f, 0xa5, 0x55, 0xa2, 0x84, 0x96, 0xc7,
+  0xb8, 0x85, 0x5f, 0xa0, 0xbc, 0xac, 0xa1, 0xcd, 0x74, 0x5b, 0x74, 0xb5,
+  0x93, 0x90, 0xd8, 0xbb, 0x7b, 0x54, 0x8d, 0x3c, 0x2a, 0x46, 0x9e, 0xcf,
+  0x4a, 0xa0, 0x55, 0x8b, 0xc8, 0x8e, 0x7e, 0x7e, 0xa9, 0x79, 0x95, 0xa2,
+  0x4b, 0x8e, 0x7f, 0xb6, 0xa9, 0x74, 0x88, 0xd0, 0x8b, 0x74, 0xb8, 0xe1,
+  0xdc, 0xa5, 0xb3, 0x8e, 0x8a, 0x9a, 0xc7, 0xa0, 0x67, 0xbc, 0x9d, 0x4f,
+  0x95, 0x92, 0x55, 0x55, 0x49, 0x4f, 0x84, 0x70, 0x8a, 0x98, 0x58, 0xa6,
+  0xaf, 0xc8, 0x88, 0x5b, 0x85, 0xa4, 0xe9, 0xa9, 0xcd, 0x54, 0x7f, 0xdc,
+  0xbf, 0xbd, 0x8f, 0xa7, 0xbc, 0xa7, 0xb4, 0xaf, 0x6c, 0xbc, 0xc6, 0xc3,
+  0xb4, 0xb1, 0x60, 0x98, 0x97, 0x8f, 0x9d, 0x60, 0x71, 0x6c, 0x1b, 0x16,
+  0x90, 0x62, 0x81, 0x68, 0x2b, 0x24, 0x7b, 0x39, 0x5a, 0x5d, 0x67, 0x76,
+  0xa1, 0x6f, 0x4e, 0x7e, 0x73, 0x70, 0x9e, 0x80, 0x90, 0x9a, 0x6e, 0x56,
+  0xb2, 0x9f, 0x7b, 0x91, 0x8e, 0x84, 0x88, 0x93, 0xd6, 0xc9, 0xac, 0xa6,
+  0xbc, 0x72, 0xc9, 0xc8, 0xb6, 0xa1, 0x5a, 0xe1, 0x67, 0x72, 0x68, 0x34,
+  0xae, 0x8e, 0x77, 0x8d, 0x95, 0xaa, 0xa8, 0x8c, 0x5c, 0x54, 0x43, 0x9a,
+  0x86, 0x97, 0xa3, 0xa3, 0xe2, 0x83, 0x41, 0x92, 0x8a, 0x7d, 0x9a, 0x76,
+  0x86, 0x5a, 0x88, 0xbc, 0x91, 0x84, 0xb6, 0x4e, 0x6d, 0xbb, 0xc4, 0xc6,
+  0xaa, 0xa1, 0x9e, 0x91, 0x73, 0x77, 0xd9, 0xc6, 0x95, 0xbe, 0xa9, 0x50,
+  0x7f, 0xac, 0x91, 0xab, 0xa4, 0xb1, 0x7d, 0x9c, 0xd2, 0x76, 0x77, 0xb8,
+  0x6d, 0x4f, 0x3a, 0x44, 0x46, 0x55, 0xc5, 0xab, 0x68, 0xab, 0xd3, 0xbe,
+  0xc7, 0xc8, 0xc7, 0x90, 0x3b, 0x3d, 0x79, 0x24, 0x41, 0xba, 0x57, 0x65,
+  0x44, 0x55, 0x4c, 0x6f, 0x9a, 0xa3, 0xaf, 0x53, 0xa7, 0x8c, 0xa6, 0x7a,
+  0x94, 0x53, 0x9b, 0x90, 0x94, 0x7d, 0x9e, 0x9f, 0x8d, 0xd1, 0xb0, 0xd7,
+  0xdf, 0xb2, 0x84, 0xba, 0xe0, 0xc7, 0x9c, 0xc3, 0x9d, 0x7b, 0x72, 0x6f,
+  0x40, 0xb9, 0x6e, 0x66, 0x75, 0x2a, 0x9f, 0x1c, 0x87, 0x8e, 0xa9, 0x86,
+  0x98, 0x7c, 0xdb, 0xa8, 0x52, 0x5a, 0x72, 0xd4, 0xc5, 0x9a, 0x86, 0x31,
+  0x92, 0x68, 0x45, 0x3b, 0x31, 0x6f, 0x64, 0x9f, 0xab, 0x5b, 0x46, 0xc4,
+  0xb0, 0xa1, 0xb4, 0xb8, 0x7c, 0xb1, 0x99, 0xa5, 0x9b, 0x84, 0xf0, 0xcd,
+  0xb7, 0x7e, 0x7c, 0xb6, 0xb3, 0x65, 0xd5, 0x99, 0x47, 0x78, 0xbb, 0xda,
+  0xd9, 0xd2, 0xa8, 0x70, 0xa0, 0xb9, 0x8e, 0xc4, 0xad, 0x90, 0xbd, 0x5d,
+  0xb0, 0x7b, 0x7f, 0xb0, 0x4a, 0x65, 0x9b, 0x95, 0x6d, 0x82, 0x95, 0xb7,
+  0xa5, 0xd8, 0xb3, 0x43, 0x0a, 0x71, 0xae, 0xcb, 0xe5, 0xe1, 0xb9, 0x4b,
+  0x1d, 0x35, 0xac, 0x8b, 0xac, 0x7c, 0x3a, 0x4d, 0x8e, 0xa4, 0x90, 0x50,
+  0x34, 0x70, 0x72, 0xab, 0x1b, 0x47, 0xa0, 0xc1, 0xde, 0xd8, 0x87, 0x5c,
+  0x48, 0x5b, 0x7a, 0xc3, 0xea, 0x9b, 0x85, 0x5d, 0x70, 0xcf, 0x8a, 0x1e,
+  0x47, 0x25, 0x77, 0x75, 0x7a, 0x96, 0x7e, 0xc6, 0xb9, 0x27, 0x87, 0x8f,
+  0x5f, 0x93, 0x9f, 0xb2, 0x96, 0x91, 0x42, 0x54, 0x47, 0x4d, 0x3b, 0x8b,
+  0x8b, 0x7b, 0xb4, 0xd6, 0xd8, 0xb8, 0x98, 0x67, 0x54, 0xd0, 0x9c, 0xd0,
+  0x9c, 0x67, 0x8e, 0x93, 0x86, 0x82, 0x9f, 0x73, 0xc5, 0x8b, 0x42, 0x68,
+  0xb6, 0x99, 0x50, 0xa4, 0x4b, 0x3f, 0x78, 0x97, 0xd9, 0xb4, 0xa6, 0x46,
+  0x35, 0xce, 0xdf, 0xc7, 0x99, 0x39, 0x4e, 0xa2, 0x91, 0x70, 0x42, 0x75,
+  0x8d, 0x6a, 0x7e, 0x8e, 0x58, 0x81, 0x59, 0x2d, 0x24, 0x53, 0xc0, 0xe1,
+  0x58, 0x36, 0xb3, 0xd4, 0xd6, 0x7b, 0xb5, 0x89, 0xb2, 0x4e, 0x48, 0xaf,
+  0xe6, 0xac, 0x79, 0x86, 0xcd, 0xd4, 0xb9, 0x8b, 0x5d, 0xc8, 0x58, 0x88,
+  0xc6, 0x51, 0x79, 0x82, 0x9c, 0x83, 0x4f, 0x26, 0x70, 0x76, 0x7d, 0x6e,
+  0xa3, 0xd0, 0xb6, 0xba, 0x57, 0xb9, 0x79, 0x84, 0xce, 0x86, 0xa0, 0x7f,
+  0xaa, 0xb6, 0x7f, 0x79, 0x8a, 0x6b, 0xad, 0xad, 0x68, 0x97, 0xae, 0xd3,
+  0xa9, 0xad, 0xbe, 0xc6, 0xa4, 0x70, 0x63, 0x77, 0x2c, 0x25, 0x48, 0x90,
+  0xbc, 0xd1, 0xd8, 0x96, 0x64, 0xa6, 0x9a, 0x98, 0x92, 0x5a, 0x7d, 0x8c,
+  0xe4, 0xb2, 0xa9, 0x78, 0x62, 0xc5, 0xbd, 0x87, 0xd2, 0xc2, 0x8d, 0x98,
+  0x84, 0x48, 0xde, 0xc0, 0xca, 0xde, 0xcd, 0xa1, 0x6a, 0x74, 0xd6, 0xd8,
+  0xbf, 0xb7, 0xa0, 0x47, 0x73, 0xa4, 0x63, 0x40, 0x6f, 0x3a, 0x93, 0x7b,
+  0x6e, 0xbb, 0xb2, 0xa1, 0xb2, 0x88, 0x91, 0x8c, 0xca, 0xa7, 0x3a, 0x40,
+  0xd5, 0xbe, 0xde, 0xd6, 0xc3, 0xc0, 0xb3, 0x82, 0x94, 0xcb, 0xa5, 0xd0,
+  0x67, 0xca, 0xd9, 0xcb, 0xaa, 0xb4, 0x9e, 0x93, 0x7a, 0xa6, 0xb3, 0x70,
+  0xa6, 0xbd, 0x4f, 0x0b, 0x14, 0x10, 0x25, 0x96, 0xa6, 0x56, 0x86, 0xe8,
+  0xa8, 0x86, 0x7e, 0x58, 0x7d, 0x58, 0x9e, 0x9e, 0x61, 0x71, 0x81, 0xaf,
+  0x44, 0x44, 0xba, 0xb8, 0xba, 0xa2, 0x8d, 0xcb, 0xc5, 0xbb, 0x86, 0x7b,
+  0xdf, 0x68, 0x6f, 0x8b, 0xd5, 0x74, 0x56, 0x43, 0x7a, 0xdc, 0xda, 0xa0,
+  0x6b, 0x58, 0x5b, 0x5e, 0xa5, 0xaa, 0x53, 0x4d, 0xac, 0xb0, 0xd5, 0xc0,
+  0x4a, 0x86, 0xb4, 0x7d, 0xd9, 0xc0, 0x98, 0x6e, 0xb6, 0x41, 0x5b, 0x52,
+  0x92, 0x7f, 0x93, 0x9a, 0xbc, 0x62, 0x27, 0x4e, 0x63, 0xb4, 0xd8, 0x78,
+  0x57, 0x6a, 0x4a, 0x72, 0xa1, 0x4c, 0x4c, 0xb0, 0x8c, 0x60, 0x8e, 0x9d,
+  0xd0, 0x8d, 0xbd, 0x7e, 0xc9, 0xe9, 0xc2, 0x58, 0x9c, 0xc5, 0xb9, 0xc2,
+  0xa7, 0xc6, 0xdd, 0xb4, 0x78, 0xaf, 0xd3, 0xbc, 0x97, 0x22, 0x8d, 0xbb,
+  0x9c, 0x88, 0x79, 0xa6, 0xbf, 0x9a, 0xd1, 0xed, 0xbd, 0xac, 0x87, 0xbf,
+  0xc3, 0xac, 0x57, 0x8d, 0xbc, 0x5b, 0x6c, 0xc8, 0xe0, 0xd4, 0x9c, 0xcd,
+  0xbb, 0xa2, 0x82, 0xce, 0x8a, 0x70, 0x7b, 0xa9, 0x7f, 0x4a, 0x5f, 0xcb,
+  0xa4, 0xd7, 0xbc, 0x52, 0xb0, 0x85, 0x7d, 0x40, 0xc9, 0xcc, 0xab, 0xa4,
+  0x94, 0x71, 0x98, 0x9e, 0x60, 0x82, 0xd5, 0xe5, 0xb4, 0xb4, 0xb5, 0xc7,
+  0x8c, 0xba, 0x9c, 0xdc, 0x94, 0x8f, 0xa5, 0xd8, 0x9c, 0x62, 0x85, 0x8d,
+  0xac, 0xc0, 0xd6, 0xa7, 0xa9, 0x96, 0x9d, 0x4f, 0x7a, 0x95, 0x87, 0x8b,
+  0x72, 0x84, 0x6c, 0x9e, 0x50, 0x4e, 0xc4, 0xc0, 0x6e, 0x58, 0x76, 0x40,
+  0x7b, 0xcd, 0x6d, 0x5b, 0x71, 0xa1, 0x67, 0x75, 0x8c, 0xa2, 0x89, 0xa6,
+  0x72, 0xc2, 0xc0, 0x92, 0x41, 0x92, 0xd1, 0xd0, 0x8e, 0x95, 0xbf, 0xe0,
+  0xdb, 0xa7, 0xce, 0xc5, 0xa3, 0x37, 0x31, 0xdd, 0xc6, 0x88, 0x7c, 0x98,
+  0x7e, 0x9c, 0xbe, 0xcb, 0xd0, 0xdd, 0xa4, 0x63, 0xb2, 0xb6, 0x7c, 0xa1,
+  0xbf, 0xaf, 0x8b, 0xf3, 0xd1, 0xba, 0xb0, 0x9c, 0xa4, 0xce, 0xba, 0xaf,
+  0xd9, 0xb1, 0xc9, 0xc4, 0xbe, 0x68, 0x92, 0x9d, 0x9a, 0x9a, 0xcd, 0xa0,
+  0x76, 0x78, 0xac, 0x6a, 0xb7, 0xdd, 0xe8, 0xc9, 0x96, 0x78, 0x73, 0x8e,
+  0x53, 0x86, 0xde, 0xeb, 0xc8, 0x9a, 0xb5, 0xcb, 0xcd, 0xcf, 0xa7, 0x8c,
+  0x9e, 0x7b, 0x73, 0xba, 0x84, 0x5e, 0x66, 0x7b, 0xa9, 0xbf, 0xd2, 0xd1,
+  0x9b, 0x7c, 0xac, 0x69, 0x88, 0x8b, 0xa9, 0xb1, 0x9c, 0x89, 0x8f, 0xad,
+  0xd4, 0x94, 0xce, 0xb0, 0x47, 0x32, 0x7b, 0x57, 0x12, 0x5f, 0x8d, 0xd0,
+  0x5b, 0x25, 0x22, 0x91, 0xa6, 0x7d, 0x9a, 0xcf, 0xac, 0x71, 0x5b, 0xb9,
+  0x9c, 0x86, 0x70, 0xd1, 0xb1, 0x96, 0x6b, 0xcc, 0xce, 0xb1, 0x84, 0xc5,
+  0xb0, 0x94, 0x75, 0x92, 0xbb, 0xba, 0x56, 0x97, 0x85, 0x44, 0x73, 0xdb,
+  0xc3, 0xd3, 0xbe, 0xd4, 0xd1, 0x74, 0x43, 0x70, 0xb8, 0x92, 0x70, 0x7d,
+  0x6d, 0xe5, 0xd6, 0xd8, 0xa4, 0xda, 0x84, 0x6a, 0x5d, 0x7b, 0xac, 0xa0,
+  0xd1, 0x8a, 0x5c, 0x44, 0x59, 0x40, 0xae, 0xb1, 0x62, 0x87, 0x6e, 0x16,
+  0x23, 0xb1, 0xc5, 0x8d, 0xac, 0x5f, 0x5c, 0xa4, 0xba, 0x87, 0x86, 0xa9,
+  0x93, 0x74, 0xbb, 0x80, 0xc5, 0xd4, 0xc6, 0xc4, 0xca, 0x9e, 0x46, 0x71,
+  0x87, 0x9e, 0xb6, 0xc7, 0xaa, 0xcc, 0xd6, 0xd8, 0xe9, 0xcf, 0xb3, 0x8c,
+  0x3e, 0x27, 0x48, 0x49, 0x84, 0xb5, 0x96, 0x84, 0x9c, 0x80, 0x9a, 0x6e,
+  0x48, 0x5a, 0x7a, 0x7b, 0x3e, 0x68, 0x65, 0xb8, 0x89, 0x67, 0x66, 0x92,
+  0x92, 0xac, 0xdc, 0xaf, 0xac, 0xc0, 0x95, 0xc5, 0xca, 0xd6, 0x62, 0x5a,
+  0xb1, 0xa4, 0x72, 0x7f, 0xb6, 0xa2, 0xab, 0xb3, 0xd1, 0xd6, 0xc7, 0xa0,
+  0xa0, 0x9a, 0x73, 0x53, 0xd3, 0x84, 0x92, 0xa6, 0xd3, 0xdd, 0xc7, 0xd8,
+  0xcc, 0xbb, 0x86, 0x86, 0x8f, 0x8b, 0xc9, 0xb7, 0xb0, 0xb0, 0xa7, 0xa5,
+  0x96, 0xd7, 0xdc, 0x7e, 0x3d, 0x8a, 0x61, 0x8e, 0x82, 0xb0, 0x4d, 0xac,
+  0xdb, 0xad, 0xc6, 0xc3, 0x5e, 0x44, 0x92, 0x69, 0x7d, 0x63, 0xb4, 0xa4,
+  0xa7, 0x47, 0x23, 0x89, 0xc5, 0xb6, 0x98, 0x58, 0x92, 0x32, 0x51, 0x6d,
+  0x42, 0xa9, 0xb1, 0xda, 0xb5, 0xac, 0x6b, 0x6c, 0x8b, 0xe5, 0xc9, 0xdf,
+  0xda, 0xc0, 0x92, 0x64, 0xa1, 0xa3, 0xa2, 0x9e, 0x43, 0x47, 0x29, 0x66,
+  0x78, 0x3c, 0x81, 0x67, 0x6c, 0xb0, 0xe0, 0x87, 0x83, 0xab, 0xc9, 0xcb,
+  0xbb, 0x8a, 0x42, 0x8d, 0xdc, 0xd3, 0x8c, 0x6b, 0x6c, 0x7c, 0x7b, 0xa4,
+  0x8b, 0x6c, 0x45, 0x69, 0x84, 0xcb, 0xbf, 0x6d, 0xaf, 0xb4, 0xbf, 0xaf,
+  0xa6, 0x7b, 0x80, 0x8c, 0xcb, 0xc6, 0xb2, 0xb7, 0xae, 0x61, 0x47, 0x2a,
+  0xb8, 0xe1, 0xb7, 0x39, 0xc9, 0xb5, 0xa7, 0xac, 0x9d, 0xba, 0xb1, 0xd0,
+  0xc0, 0xa0, 0xd6, 0x7a, 0x79, 0x44, 0xbc, 0x92, 0xb4, 0xa5, 0xb8, 0xb5,
+  0x6d, 0x3d, 0xaf, 0x5d, 0xbb, 0xdb, 0xc1, 0xc1, 0xc9, 0x84, 0x70, 0xcc,
+  0x96, 0x6c, 0x7d, 0xc3, 0xb5, 0xb0, 0xc5, 0x63, 0x93, 0xe6, 0x99, 0xac,
+  0xc9, 0x5d, 0x5c, 0xdc, 0xa0, 0x48, 0xaf, 0x85, 0x95, 0x72, 0x58, 0xc0,
+  0xe5, 0xc3, 0xa9, 0x91, 0x96, 0x96, 0xd3, 0xbf, 0xc6, 0x7f, 0xa6, 0x56,
+  0x31, 0x2b, 0x45, 0xab, 0xd5, 0xc9, 0x92, 0xa3, 0x53, 0x49, 0x52, 0x73,
+  0x73, 0xd1, 0xe7, 0xbe, 0x70, 0x7b, 0xbb, 0xb4, 0xd9, 0x8f, 0x8a, 0x79,
+  0x73, 0x78, 0xa1, 0x7c, 0x47, 0xdb, 0xc2, 0xc2, 0xda, 0xc4, 0x80, 0x7c,
+  0xcf, 0xa0, 0x88, 0x83, 0x84, 0xd8, 0xef, 0xa5, 0xa4, 0xa2, 0xc3, 0xcd,
+  0xd7, 0xbc, 0xa1, 0xcb, 0xa1, 0x96, 0xba, 0x62, 0xab, 0xa8, 0xbe, 0x89,
+  0x8e, 0xc3, 0xa6, 0x7c, 0xa1, 0xc8, 0xa6, 0x77, 0xb0, 0xbb, 0xa1, 0xa8,
+  0xd1, 0x57, 0x71, 0x96, 0x76, 0x80, 0x6f, 0x88, 0xd0, 0x9f, 0x9b, 0x99,
+  0x90, 0xc1, 0xbe, 0xb5, 0x99, 0xbb, 0x5a, 0x9c, 0xc4, 0x9b, 0x67, 0x82,
+  0xa7, 0x59, 0x9f, 0xba, 0x70, 0xc4, 0x9c, 0xa6, 0xd0, 0x9a, 0x41, 0xcb,
+  0xb9, 0x3b, 0x41, 0x6d, 0x6c, 0xb0, 0x9d, 0x66, 0xdf, 0xe5, 0xa5, 0x9d,
+  0x53, 0x56, 0x5e, 0xa1, 0xa0, 0x8f, 0x83, 0x6a, 0x6d, 0x87, 0x26, 0x2c,
+  0xae, 0xd4, 0xc5, 0xb1, 0x87, 0x49, 0xbe, 0xc1, 0x77, 0x98, 0xac, 0x95,
+  0x8e, 0xba, 0x82, 0x9a, 0xa7, 0xcf, 0xe3, 0xa0, 0x3a, 0x20, 0xd2, 0xd2,
+  0xae, 0xba, 0xd2, 0x83, 0xbf, 0x8b, 0x60, 0x6f, 0xe0, 0xd5, 0x9c, 0x8c,
+  0xa8, 0x88, 0xaa, 0xa7, 0x3d, 0x41, 0x79, 0xd7, 0x94, 0xb8, 0x84, 0x64,
+  0x1c, 0x22, 0x71, 0x8f, 0x7f, 0x6a, 0x69, 0x50, 0x39, 0x80, 0xdf, 0xc1,
+  0x51, 0x9e, 0x94, 0x5f, 0x47, 0xb8, 0x70, 0x7f, 0xce, 0xbc, 0x54, 0x8f,
+  0x6f, 0x83, 0xc2, 0x6d, 0x91, 0xcc, 0xab, 0xde, 0xb5, 0xdf, 0xd1, 0xf2,
+  0xd3, 0xd1, 0xc1, 0xc1, 0xbf, 0xc6, 0x9c, 0x72, 0xcb, 0x48, 0x3a, 0x98,
+  0x9f, 0xa3, 0xa1, 0xb9, 0x4e, 0x70, 0x85, 0xd2, 0xc3, 0x86, 0x48, 0x48,
+  0x78, 0xc1, 0x9c, 0x91, 0x6a, 0xc6, 0x90, 0x6f, 0x6e, 0xb2, 0x82, 0x42,
+  0xa6, 0x8c, 0x79, 0x40, 0x76, 0x7d, 0x5e, 0x3f, 0xb4, 0x8c, 0xb5, 0x77,
+  0x9f, 0xab, 0xc4, 0xf0, 0xbe, 0x80, 0xac, 0xc9, 0xc4, 0x8e, 0xac, 0xc4,
+  0xc5, 0x9f, 0xac, 0xd4, 0xaa, 0x1f, 0x3a, 0x5b, 0x4e, 0x5e, 0x9e, 0x82,
+  0xaa, 0x89, 0x96, 0x8f, 0xbe, 0xd9, 0x74, 0x2f, 0x8d, 0x85, 0x74, 0x98,
+  0xbb, 0xa0, 0x64, 0xc4, 0xcb, 0x96, 0xc2, 0x98, 0x73, 0x7d, 0x59, 0x88,
+  0xb7, 0x9d, 0xb2, 0x83, 0x58, 0x11, 0x7b, 0xd7, 0x71, 0x6b, 0xa8, 0x88,
+  0x31, 0x75, 0x66, 0x38, 0x16, 0x64, 0x9f, 0xa8, 0xb3, 0x7f, 0x6a, 0x68,
+  0x9c, 0xcd, 0xcd, 0xab, 0x9a, 0x9c, 0xbf, 0xc6, 0xb4, 0xc8, 0xbc, 0x9b,
+  0x78, 0x60, 0xae, 0xa7, 0xbd, 0xb9, 0x98, 0xb3, 0xa0, 0xbe, 0xba, 0xae,
+  0x8a, 0xa6, 0x91, 0xb4, 0x9a, 0xa8, 0xb2, 0x7f, 0x57, 0x7a, 0x52, 0x9e,
+  0xaf, 0xd6, 0xe2, 0xb1, 0xac, 0xca, 0x94, 0x71, 0x81, 0xac, 0x96, 0x4b,
+  0x73, 0x9a, 0xa3, 0xd4, 0x9d, 0x81, 0x9a, 0x97, 0x7c, 0xca, 0x8c, 0xc3,
+  0xaa, 0x92, 0x58, 0x97, 0x9f, 0x80, 0xbf, 0xa8, 0x5f, 0x9b, 0x6d, 0x46,
+  0xa3, 0x4c, 0x28, 0x3d, 0x9c, 0xb1, 0xb7, 0x97, 0xc8, 0xb6, 0x8d, 0x76,
+  0x75, 0xc1, 0xb8, 0xae, 0x52, 0x3b, 0x42, 0xb5, 0x7e, 0xc2, 0x99, 0x6e,
+  0xa3, 0xaa, 0x54, 0x57, 0x86, 0x33, 0x40, 0xae, 0x68, 0x70, 0x7e, 0x90,
+  0x73, 0x2f, 0x67, 0xb1, 0x90, 0x5c, 0xcd, 0xaf, 0xaa, 0x8a, 0x39, 0x61,
+  0xb0, 0x77, 0x86, 0xb4, 0xcb, 0xde, 0xdc, 0xbe, 0xa8, 0xa1, 0xa7, 0x94,
+  0xb1, 0x83, 0x93, 0x94, 0x87, 0x9b, 0xb2, 0x3d, 0x35, 0x4d, 0x20, 0x90,
+  0xbf, 0xc1, 0x73, 0x41, 0xb8, 0xb4, 0xdf, 0x97, 0xa4, 0xa9, 0xa7, 0xc9,
+  0xa7, 0xe3, 0x78, 0x41, 0x80, 0x3d, 0x6d, 0x8b, 0xbc, 0x95, 0xb0, 0xa2,
+  0x9e, 0x85, 0xb6, 0xce, 0x9a, 0xa7, 0x9b, 0x91, 0x27, 0x85, 0xc9, 0xdc,
+  0x91, 0x7b, 0x79, 0x6a, 0x94, 0x58, 0xa6, 0xc5, 0xa4, 0x70, 0x53, 0x4f,
+  0xba, 0x89, 0x97, 0xd1, 0xc2, 0xba, 0xd3, 0x63, 0x14, 0x5e, 0xd2, 0x48,
+  0x7f, 0xa4, 0xb6, 0x98, 0x74, 0xac, 0xc3, 0xf0, 0xb7, 0x8e, 0x96, 0xc8,
+  0xb1, 0x77, 0x8d, 0xb5, 0xdc, 0x94, 0x88, 0x64, 0x67, 0x95, 0xb9, 0xa9,
+  0xcd, 0xbf, 0x77, 0x8c, 0x66, 0x39, 0x1b, 0x46, 0x9e, 0x95, 0x7b, 0x76,
+  0x56, 0x46, 0xc1, 0x8e, 0xb7, 0xee, 0xc7, 0xa2, 0xbc, 0x9b, 0xa6, 0xb5,
+  0x8b, 0x7f, 0x83, 0x8a, 0x8e, 0x68, 0x33, 0x70, 0x93, 0x97, 0x8f, 0x5c,
+  0x52, 0x31, 0x7c, 0x97, 0x86, 0x95, 0x72, 0x60, 0xaa, 0xeb, 0xd4, 0xbb,
+  0xad, 0x8a, 0x96, 0xa8, 0x79, 0x95, 0x59, 0x45, 0x53, 0xc3, 0xaa, 0x4e,
+  0x70, 0xa3, 0x83, 0xb8, 0xc2, 0x9b, 0x66, 0x53, 0xc5, 0x92, 0x87, 0x9d,
+  0x7c, 0x7d, 0x5c, 0xb2, 0x68, 0x68, 0xf5, 0xf1, 0xdd, 0xbf, 0xd8, 0x99,
+  0xa9, 0x8f, 0xba, 0xd4, 0xeb, 0xc3, 0xc8, 0xdc, 0xa8, 0xa4, 0x6e, 0xa8,
+  0xc5, 0x56, 0x8f, 0xbf, 0x4b, 0x86, 0xe9, 0x9d, 0xa8, 0xcc, 0xad, 0x9a,
+  0xaf, 0xac, 0xc5, 0x7c, 0x95, 0x67, 0x27, 0xaa, 0xd5, 0xc2, 0x91, 0x9d,
+  0x9e, 0xb8, 0x84, 0x5d, 0x87, 0xb8, 0x7a, 0xbe, 0x9b, 0xb7, 0xbc, 0xde,
+  0xa3, 0x5d, 0x69, 0x72, 0x62, 0x9e, 0xb5, 0xba, 0xca, 0x93, 0xc8, 0xba,
+  0x82, 0x96, 0x3f, 0x5b, 0x6b, 0x99, 0x74, 0x45, 0xa5, 0x98, 0x73, 0x2e,
+  0x7f, 0xae, 0xaa, 0x9a, 0x9c, 0x9e, 0xbe, 0xc9, 0x71, 0x50, 0x1e, 0x82,
+  0x86, 0x75, 0x66, 0x6e, 0x6c, 0x9b, 0xc7, 0xc3, 0xd3, 0x70, 0x58, 0x38,
+  0x90, 0xa1, 0x68, 0x5e, 0xb0, 0xa5, 0xc7, 0x7c, 0x72, 0xcb, 0x4c, 0x58,
+  0xc2, 0xc0, 0xc2, 0x92, 0xc5, 0xbc, 0x99, 0xba, 0x46, 0xab, 0x7a, 0x9b,
+  0xce, 0x38, 0xac, 0xc2, 0xa4, 0xad, 0xc3, 0x62, 0x88, 0xac, 0x7e, 0x83,
+  0xc2, 0xd3, 0xb7, 0xdb, 0x57, 0x72, 0xcc, 0x73, 0x65, 0x3e, 0x98, 0xae,
+  0x84, 0x86, 0xea, 0xda, 0xb3, 0xca, 0xb4, 0x7f, 0x89, 0x89, 0xde, 0xbe,
+  0xaa, 0xcd, 0x81, 0x86, 0x9e, 0xc5, 0xbc, 0xb6, 0xc2, 0x4f, 0x57, 0x9d,
+  0x9b, 0xd2, 0xb0, 0xa3, 0x76, 0x6d, 0x8d, 0xc1, 0xd1, 0xcb, 0xb2, 0xc2,
+  0xa5, 0x74, 0x13, 0x1b, 0x51, 0x58, 0x72, 0x93, 0x84, 0x76, 0x1b, 0x1d,
+  0x7f, 0x91, 0xac, 0x8b, 0x91, 0xac, 0x94, 0xc6, 0xa9, 0x96, 0xb9, 0xb6,
+  0xad, 0x74, 0x55, 0xa7, 0xd6, 0xce, 0x61, 0x30, 0x66, 0x77, 0x48, 0x0d,
+  0x12, 0x1f, 0x2b, 0x5f, 0xa6, 0x7c, 0x2b, 0x30, 0x89, 0x6d, 0xb6, 0x87,
+  0xb2, 0xb3, 0xdf, 0xb7, 0x84, 0x79, 0x8d, 0x38, 0xb2, 0xae, 0x81, 0xc7,
+  0xcc, 0xa4, 0x77, 0x75, 0x74, 0x98, 0xa4, 0x46, 0xb1, 0xae, 0x82, 0xa5,
+  0xdf, 0xd2, 0xb8, 0xb5, 0x59, 0x25, 0x32, 0x28, 0x85, 0xbe, 0xab, 0x54,
+  0xc2, 0xb0, 0xa8, 0xdf, 0x9f, 0x3e, 0x2b, 0x76, 0x8a, 0x6c, 0x9f, 0xae,
+  0xb8, 0xe0, 0xb3, 0x75, 0x9c, 0x83, 0xb8, 0xb3, 0x67, 0xae, 0x8b, 0x66,
+  0x7b, 0x5d, 0xa7, 0x72, 0xa0, 0x8f, 0x1e, 0x94, 0x8b, 0x80, 0xd5, 0xbb,
+  0x8a, 0x8e, 0x9e, 0x8b, 0xa1, 0xac, 0xbe, 0xd5, 0xd0, 0xa6, 0x7e, 0x7e,
+  0x6a, 0xa6, 0xc9, 0x8e, 0xa1, 0x9f, 0xae, 0x75, 0x9f, 0x86, 0x89, 0xb6,
+  0x77, 0x6d, 0x7a, 0x7e, 0x8d, 0x82, 0x60, 0x5e, 0x74, 0xb4, 0x80, 0xe2,
+  0x9e, 0xc4, 0xae, 0x8d, 0xc3, 0x9a, 0x8f, 0x3b, 0x39, 0x92, 0x6b, 0x51,
+  0x7b, 0xb1, 0xac, 0x9d, 0xa6, 0xc2, 0x79, 0x93, 0x2c, 0x4e, 0x7f, 0xb5,
+  0xc0, 0xae, 0x95, 0x7b, 0x53, 0x9b, 0x49, 0x52, 0xbd, 0xaa, 0xc7, 0xc8,
+  0xb5, 0x9e, 0xcd, 0x8f, 0x61, 0xb9, 0xc0, 0xb3, 0xa0, 0xc5, 0xa8, 0xcb,
+  0xba, 0xb3, 0x63, 0x9b, 0xa9, 0x9c, 0x8f, 0x8c, 0x5e, 0xb6, 0xc2, 0xb6,
+  0xd6, 0x7c, 0x32, 0x71, 0x94, 0x67, 0x97, 0x96, 0x97, 0xbf, 0xb3, 0x79,
+  0x55, 0x92, 0x3e, 0x70, 0x74, 0x19, 0x73, 0x8a, 0x4f, 0xbb, 0xc8, 0x71,
+  0x28, 0xb4, 0x9d, 0x78, 0x4a, 0x26, 0xad, 0x60, 0x1f, 0x9d, 0x98, 0x2f,
+  0x8c, 0x71, 0x70, 0xb5, 0xb6, 0x88, 0x66, 0xa6, 0xb1, 0x93, 0x77, 0xa2,
+  0x42, 0x35, 0x8f, 0xa5, 0xb9, 0x97, 0x8b, 0xc0, 0x96, 0x88, 0x28, 0x3a,
+  0x2b, 0x4d, 0x2e, 0x11, 0x2f, 0x4d, 0x70, 0x9b, 0xda, 0xdd, 0xdc, 0x9e,
+  0xaf, 0x9e, 0x94, 0xd1, 0xbc, 0xae, 0xcc, 0xab, 0x7b, 0x63, 0x6e, 0x60,
+  0x50, 0xd5, 0x87, 0xcf, 0xb8, 0x38, 0x5d, 0x83, 0x8f, 0xb2, 0xc9, 0xa0,
+  0x4d, 0x98, 0x56, 0x2c, 0x73, 0x9e, 0x4d, 0x86, 0x86, 0xc0, 0x9c, 0xbe,
+  0x98, 0xd0, 0xbb, 0xab, 0x3e, 0x9d, 0xac, 0x9a, 0xba, 0x82, 0x6a, 0xa8,
+  0xd0, 0x97, 0x61, 0xaf, 0x68, 0x38, 0x98, 0x8b, 0xab, 0xd9, 0x97, 0x3e,
+  0xa4, 0xde, 0xe6, 0xe6, 0xde, 0xbd, 0xcd, 0xaf, 0x83, 0x9d, 0x86, 0x74,
+  0x62, 0x84, 0xc2, 0xcb, 0x8b, 0x6d, 0x89, 0x68, 0x2e, 0x2c, 0xac, 0x60,
+  0x8c, 0x76, 0x7a, 0xc8, 0x5e, 0xc4, 0xb1, 0x95, 0x67, 0x9c, 0x8f, 0x88,
+  0x62, 0x96, 0xad, 0x54, 0x6f, 0x75, 0x96, 0xa3, 0xaa, 0x6f, 0x42, 0x70,
+  0xce, 0xb0, 0x5c, 0x3e, 0x86, 0xa4, 0x72, 0x3f, 0x6a, 0x33, 0x87, 0x91,
+  0xbd, 0xba, 0xab, 0x38, 0xb9, 0xd1, 0xbc, 0xab, 0xce, 0x9f, 0x6f, 0xa7,
+  0xb5, 0xb9, 0xd4, 0xca, 0xe3, 0xa3, 0x81, 0xa6, 0x54, 0x95, 0x8a, 0x36,
+  0xaf, 0x86, 0x8d, 0xc2, 0xaf, 0xa0, 0x9a, 0x7a, 0x3f, 0x72, 0x44, 0x16,
+  0x87, 0xc6, 0xc9, 0xcd, 0xd0, 0xa9, 0xa3, 0x61, 0x52, 0x6c, 0x75, 0x9c,
+  0x68, 0x4e, 0xbe, 0x6c, 0xd4, 0x96, 0xc5, 0xc5, 0xb1, 0x78, 0x6e, 0x8f,
+  0xd2, 0x78, 0x3b, 0x9e, 0x83, 0xc6, 0xd6, 0xb3, 0x35, 0x8c, 0xd5, 0xdb,
+  0xd7, 0xaf, 0x7d, 0x8d, 0xc3, 0x9f, 0x97, 0xaa, 0xcb, 0xd1, 0x97, 0xd0,
+  0xd1, 0xab, 0x8d, 0x7e, 0x76, 0x9e, 0x8c, 0xbf, 0x64, 0x89, 0x7c, 0x7c,
+  0x83, 0xc5, 0xb6, 0xe1, 0xdb, 0xa9, 0xa5, 0x96, 0x62, 0x42, 0x8c, 0x6f,
+  0x56, 0x6e, 0xb3, 0xb8, 0xd4, 0xdc, 0xcc, 0xbf, 0xb1, 0x6c, 0x2f, 0x3d,
+  0x3c, 0xbe, 0x85, 0xac, 0x87, 0x30, 0x81, 0x5b, 0x80, 0x6c, 0xaa, 0x84,
+  0xc2, 0xa4, 0x6e, 0xb4, 0xab, 0xc5, 0x9e, 0x98, 0xa7, 0xb5, 0x73, 0x24,
+  0xad, 0xe1, 0xe3, 0xd4, 0xe2, 0xd2, 0xc1, 0xa2, 0xa3, 0xdf, 0xbf, 0xbb,
+  0xca, 0xb8, 0xb0, 0x5b, 0x0c, 0xb0, 0x72, 0x2c, 0x76, 0xc0, 0xae, 0x89,
+  0x6e, 0x50, 0xb6, 0xbc, 0x7f, 0x87, 0x72, 0xc9, 0xac, 0x76, 0xbe, 0x54,
+  0x6a, 0x85, 0x63, 0x8f, 0xa6, 0x64, 0x59, 0xba, 0x7a, 0xc8, 0xa5, 0x8a,
+  0x77, 0x90, 0x92, 0xb4, 0x84, 0x78, 0xd4, 0xae, 0xb1, 0xa0, 0xb7, 0x70,
+  0x42, 0x70, 0x7b, 0x52, 0x4f, 0xab, 0xb5, 0xb4, 0xef, 0xbc, 0x98, 0x7e,
+  0x52, 0xdc, 0x99, 0xcc, 0x90, 0xa3, 0xbc, 0x42, 0x6f, 0x97, 0xc4, 0xd8,
+  0xd6, 0xc7, 0xb2, 0x4a, 0xb7, 0x5a, 0x23, 0x70, 0xa5, 0x8d, 0x68, 0xb0,
+  0x69, 0x8f, 0xd5, 0xc5, 0x9a, 0x66, 0x56, 0x8b, 0x84, 0x6c, 0x8e, 0x73,
+  0xb3, 0x98, 0xba, 0x74, 0xb4, 0xcf, 0x61, 0x3a, 0x9f, 0xb4, 0x88, 0x58,
+  0x5d, 0x74, 0x6f, 0x91, 0xe5, 0x6a, 0xb6, 0x7d, 0x4f, 0xcb, 0xac, 0xaa,
+  0xb9, 0xba, 0xde, 0xed, 0xb5, 0xc3, 0x5a, 0x20, 0x6d, 0x87, 0xc3, 0xa0,
+  0x48, 0x8d, 0xd9, 0x7c, 0x3a, 0xc4, 0xb7, 0x9c, 0xc2, 0x71, 0x20, 0x2c,
+  0x3b, 0x59, 0x9d, 0x9c, 0x96, 0xb0, 0xc0, 0x95, 0x5a, 0x90, 0x73, 0xbf,
+  0xd9, 0xdc, 0x99, 0x68, 0x86, 0x64, 0xc9, 0xac, 0x5e, 0x87, 0x95, 0xe7,
+  0xee, 0xd6, 0xc7, 0x9d, 0x72, 0x98, 0x60, 0x97, 0xb8, 0x62, 0xc8, 0x82,
+  0x48, 0x59, 0xe7, 0xd4, 0xc6, 0xcb, 0xd3, 0x7d, 0x2c, 0xa7, 0xb8, 0xce,
+  0x6d, 0x3c, 0xa1, 0xba, 0xaa, 0xcd, 0x6b, 0xa6, 0xcb, 0xc5, 0xa8, 0x34,
+  0x78, 0xe1, 0x88, 0x91, 0xba, 0x95, 0xcb, 0xc5, 0xad, 0x9e, 0xc2, 0x83,
+  0xd5, 0xcb, 0x9c, 0xd4, 0x81, 0x59, 0xa8, 0x85, 0x6d, 0x9d, 0x6f, 0x7f,
+  0x18, 0x9f, 0xa1, 0x5e, 0x89, 0x9b, 0xcf, 0x63, 0xaa, 0xd0, 0x9b, 0xba,
+  0xcd, 0x93, 0x87, 0xc7, 0x82, 0xa5, 0x63, 0x81, 0xae, 0xb5, 0x9d, 0xb9,
+  0xb8, 0xb8, 0xc2, 0x69, 0xa5, 0xb2, 0xcb, 0xa9, 0x43, 0x41, 0xdb, 0x85,
+  0xad, 0xa0, 0xb8, 0x8a, 0x76, 0x96, 0xb1, 0x92, 0x73, 0xb8, 0xaa, 0xc3,
+  0xa7, 0x76, 0xdb, 0x73, 0xab, 0x99, 0xcb, 0x81, 0x77, 0x9f, 0xa8, 0xb4,
+  0xd4, 0xa7, 0xca, 0x92, 0xc2, 0x89, 0x75, 0xcd, 0xa6, 0x89, 0x66, 0x74,
+  0x71, 0x8e, 0x86, 0x84, 0xa7, 0x85, 0xb9, 0xc8, 0xa6, 0x47, 0x5c, 0x93,
+  0xa9, 0x9c, 0xca, 0xcc, 0x80, 0x85, 0x75, 0x79, 0x97, 0xba, 0x74, 0xdc,
+  0x91, 0xa5, 0xa7, 0x92, 0xd5, 0xd9, 0xbb, 0x6f, 0x3b, 0xaa, 0xa8, 0x6e,
+  0x3f, 0xc0, 0x43, 0xcb, 0x9f, 0xc0, 0xe9, 0xd9, 0x71, 0x5a, 0x5d, 0xa8,
+  0x77, 0x13, 0x5b, 0x5d, 0x7b, 0xbe, 0xb3, 0x7d, 0x50, 0x74, 0x76, 0x1c,
+  0x28, 0x49, 0x67, 0xa1, 0x9c, 0x9d, 0xaf, 0x74, 0xaf, 0xb6, 0xc0, 0xb1,
+  0xc1, 0xaf, 0x9e, 0x3d, 0x83, 0x78, 0x6d, 0x6c, 0x5d, 0x63, 0xbb, 0xe4,
+  0xa5, 0xcd, 0x98, 0xb2, 0x88, 0x8e, 0x94, 0xb8, 0x8f, 0x1d, 0x8d, 0x9a,
+  0xb0, 0xe2, 0xd2, 0xa3, 0xc3, 0xcb, 0xd5, 0xa4, 0x7d, 0x3a, 0xaf, 0x8f,
+  0x62, 0x36, 0x6e, 0xb6, 0xbb, 0x9c, 0x89, 0xb0, 0xb0, 0xab, 0xb6, 0x82,
+  0x49, 0x4a, 0x95, 0x9a, 0xce, 0xc1, 0x93, 0xca, 0xa6, 0xb4, 0x8c, 0x72,
+  0xe0, 0x4f, 0x80, 0xa0, 0xe5, 0xa7, 0x6c, 0x30, 0x64, 0xa0, 0xca, 0x94,
+  0x95, 0x7d, 0xc2, 0x8b, 0xc0, 0x93, 0x9b, 0xbc, 0xc8, 0xc6, 0xde, 0x9f,
+  0xac, 0xb8, 0x9e, 0x85, 0x68, 0x6a, 0x7b, 0xb8, 0x6c, 0x65, 0x6d, 0x4a,
+  0x76, 0x29, 0xda, 0xc7, 0x9c, 0x80, 0x73, 0x7f, 0xad, 0x7f, 0x76, 0xb7,
+  0x8c, 0x96, 0x43, 0x55, 0x61, 0x77, 0x99, 0xa8, 0xa9, 0x72, 0x36, 0x72,
+  0xba, 0x8f, 0x97, 0x4c, 0x84, 0xad, 0xa8, 0x63, 0x7e, 0x74, 0x90, 0x87,
+  0xcc, 0x9e, 0x76, 0xce, 0xc4, 0x38, 0x85, 0x95, 0xb2, 0x93, 0x9e, 0xd4,
+  0xa6, 0xd1, 0xc3, 0xa8, 0x9c, 0xc0, 0x41, 0xb9, 0x9b, 0x70, 0x9f, 0xc7,
+  0xae, 0x97, 0xaf, 0xa0, 0x6d, 0x39, 0x94, 0xcf, 0xd6, 0x98, 0xb1, 0x8d,
+  0x86, 0x8a, 0x2f, 0x7c, 0xac, 0xb5, 0xc7, 0xbc, 0x99, 0x85, 0x67, 0x89,
+  0x93, 0xd2, 0x80, 0x93, 0x98, 0x6f, 0xc5, 0x29, 0x8d, 0xb6, 0x6e, 0x66,
+  0xc2, 0x9a, 0x8b, 0xa7, 0xb2, 0x71, 0xdd, 0x84, 0x93, 0x9f, 0x56, 0x84,
+  0xb0, 0x54, 0xaa, 0x71, 0xb1, 0xb6, 0xb8, 0xa9, 0x94, 0xcb, 0xbd, 0xd3,
+  0x5d, 0x25, 0x20, 0x30, 0x59, 0x50, 0x57, 0x96, 0x53, 0x5e, 0x8b, 0x9c,
+  0x96, 0x74, 0x4a, 0xab, 0xb5, 0x54, 0xb4, 0xc0, 0xb4, 0xa9, 0x90, 0x1b,
+  0x3b, 0x9f, 0xa0, 0xc5, 0xab, 0x90, 0xb3, 0x57, 0x76, 0xc5, 0x7a, 0x62,
+  0x74, 0xc6, 0xd4, 0xa8, 0xd6, 0x88, 0x63, 0x72, 0xb4, 0x5b, 0x3c, 0x8c,
+  0x6d, 0xbc, 0x95, 0xa4, 0xce, 0x7f, 0x65, 0x9b, 0xc9, 0x7f, 0x4f, 0xa2,
+  0xcd, 0xda, 0xba, 0x4a, 0x69, 0x8a, 0x95, 0xb8, 0x3b, 0x2b, 0x58, 0xad,
+  0xbe, 0x8e, 0x95, 0xca, 0xc5, 0xe5, 0xa7, 0x93, 0xbf, 0x62, 0x77, 0xc4,
+  0xbe, 0xe9, 0xe2, 0xe0, 0xda, 0xb7, 0xba, 0xad, 0xc2, 0xae, 0xac, 0x94,
+  0xb2, 0xa3, 0xe2, 0x8a, 0x42, 0xa0, 0xbe, 0x7f, 0x89, 0xc5, 0x6a, 0x1e,
+  0xa2, 0xc9, 0xb7, 0x9f, 0x33, 0x8d, 0x9d, 0x88, 0xc0, 0x56, 0x97, 0xd6,
+  0x76, 0x78, 0x7d, 0x72, 0x55, 0x96, 0xa4, 0xa0, 0x97, 0xa4, 0x97, 0xab,
+  0xd2, 0x92, 0x3c, 0xbd, 0x5f, 0xa1, 0x7f, 0x51, 0x74, 0x5c, 0x8d, 0x45,
+  0xdb, 0xd1, 0x4f, 0x2b, 0x36, 0x5e, 0x8e, 0xcf, 0x76, 0x92, 0x14, 0x3a,
+  0xb3, 0x85, 0xa2, 0x8e, 0x4a, 0x72, 0xbe, 0x4d, 0x2e, 0x60, 0x7c, 0x8c,
+  0x7c, 0xa6, 0x8e, 0xb8, 0xe6, 0xcc, 0x46, 0x3a, 0x26, 0x59, 0xcf, 0xd6,
+  0x8a, 0xb9, 0x86, 0x68, 0x7a, 0xb2, 0x64, 0x15, 0xaf, 0x9e, 0xa2, 0x7e,
+  0x32, 0xb3, 0x62, 0x83, 0x7c, 0xb5, 0x6f, 0xbc, 0x89, 0xce, 0xba, 0x87,
+  0x9d, 0xbb, 0xac, 0x90, 0xd3, 0xb4, 0xc0, 0x77, 0x89, 0xa4, 0xc2, 0xc3,
+  0xd2, 0x8c, 0x78, 0x64, 0x9a, 0x87, 0x2a, 0x81, 0x56, 0x9e, 0xb8, 0x8e,
+  0x55, 0x2a, 0xb2, 0xcf, 0x9a, 0x7e, 0xa0, 0x96, 0x8e, 0xd2, 0xe7, 0xd7,
+  0xb3, 0x9d, 0x91, 0x86, 0xa7, 0xb4, 0x75, 0xde, 0xcc, 0x62, 0x2e, 0x59,
+  0x53, 0xd6, 0xd4, 0xd3, 0xa2, 0x76, 0xb2, 0xea, 0xe4, 0xce, 0x88, 0x7c,
+  0x9f, 0xcf, 0x98, 0x69, 0xd8, 0xcd, 0x8a, 0xa5, 0x68, 0xdb, 0xd7, 0x60,
+  0x2b, 0x2c, 0x3d, 0xcf, 0x92, 0x89, 0x87, 0x5b, 0x4c, 0x83, 0x62, 0x65,
+  0x96, 0x67, 0x9c, 0xb5, 0x6d, 0xaf, 0x9a, 0xaf, 0xc4, 0xc6, 0xcc, 0xb7,
+  0xe1, 0xe3, 0xb8, 0x8a, 0x77, 0x2d, 0x68, 0xb8, 0xa3, 0x8a, 0xc8, 0x93,
+  0xa0, 0xb4, 0xcd, 0x98, 0x52, 0x98, 0xb0, 0xab, 0xa2, 0xaa, 0x70, 0x73,
+  0x9a, 0x94, 0x5c, 0x9f, 0xaf, 0x90, 0x9c, 0x86, 0x77, 0xcc, 0xd1, 0x9c,
+  0x7e, 0x95, 0x82, 0x90, 0x9c, 0xbe, 0xae, 0xa8, 0xad, 0x97, 0x4a, 0x1a,
+  0x58, 0xda, 0x96, 0x64, 0x94, 0x90, 0xc8, 0x8b, 0x3f, 0x37, 0x72, 0xbf,
+  0x9a, 0xa0, 0xa4, 0x72, 0xa8, 0xe9, 0xd5, 0xb4, 0xbb, 0xe9, 0xd3, 0xe0,
+  0x97, 0xbf, 0xd3, 0xa6, 0xcd, 0x9b, 0x7f, 0x6c, 0x8d, 0x5e, 0x87, 0xaf,
+  0xad, 0x7b, 0xb6, 0xdf, 0xa0, 0x8b, 0xb0, 0x75, 0xcc, 0xc7, 0xd3, 0xa2,
+  0x7d, 0xdc, 0xe0, 0xd0, 0x9e, 0x7e, 0xd9, 0xe9, 0xaf, 0x8a, 0x78, 0xdc,
+  0xb3, 0x9d, 0x68, 0x87, 0x59, 0x77, 0x3a, 0x8f, 0x7b, 0x61, 0x80, 0xe7,
+  0xab, 0xbd, 0xb8, 0xb4, 0xd5, 0xc2, 0xaf, 0xc4, 0xe0, 0xce, 0xb7, 0x96,
+  0xb0, 0x93, 0x6a, 0x69, 0xd6, 0x86, 0x68, 0x86, 0xa2, 0x70, 0x96, 0xd2,
+  0x9c, 0x58, 0x7c, 0x74, 0xb1, 0xb4, 0x3d, 0x33, 0x7e, 0xb7, 0x97, 0x51,
+  0x88, 0x56, 0xad, 0xa8, 0x64, 0x36, 0xa0, 0xb4, 0x98, 0xa2, 0x62, 0x30,
+  0x8e, 0x74, 0x8d, 0x90, 0x91, 0xc9, 0xb1, 0x82, 0x84, 0xca, 0xc8, 0x88,
+  0xcf, 0x9f, 0x9c, 0x9a, 0x73, 0x8f, 0x95, 0xca, 0xc8, 0xe2, 0xba, 0x9e,
+  0x69, 0x80, 0xc0, 0xa2, 0x65, 0xd5, 0xde, 0xcd, 0xbc, 0x8b, 0x9b, 0xc9,
+  0xdf, 0xae, 0xbf, 0x8f, 0x61, 0x7a, 0xd4, 0xa4, 0xbd, 0xb0, 0x7f, 0x74,
+  0xcc, 0xb6, 0xd6, 0x9b, 0xc5, 0xc3, 0xd6, 0xe7, 0xa3, 0xc6, 0xdc, 0xf0,
+  0x8e, 0x88, 0x84, 0xc4, 0xc5, 0xa0, 0xa6, 0xac, 0xc2, 0xde, 0x98, 0x9b,
+  0x88, 0x7f, 0xbf, 0x85, 0x7a, 0x4e, 0x4e, 0x91, 0xac, 0x74, 0x76, 0x92,
+  0x7e, 0x80, 0xa8, 0xcd, 0xa1, 0xa3, 0xd6, 0x80, 0x8c, 0x9d, 0xb6, 0x32,
+  0xa6, 0xb5, 0x94, 0x75, 0xcf, 0x7f, 0x40, 0x9d, 0x8c, 0x77, 0x6b, 0x9a,
+  0x8d, 0xa6, 0xb3, 0xa0, 0x7e, 0x7c, 0xd0, 0xd5, 0xb7, 0xc6, 0x73, 0x97,
+  0x8b, 0x40, 0xaf, 0xd5, 0xad, 0xae, 0x5b, 0xae, 0x89, 0x34, 0x1c, 0x9f,
+  0x65, 0x89, 0xab, 0xb6, 0x9c, 0xc3, 0xda, 0x7a, 0x90, 0xcc, 0xc1, 0xb0,
+  0xbb, 0xa8, 0xb6, 0x9f, 0xa4, 0xb4, 0xbe, 0x90, 0x5c, 0x27, 0x8b, 0xa5,
+  0x8e, 0x91, 0xc4, 0x8f, 0xd8, 0xc2, 0x2c, 0x78, 0xd2, 0xd6, 0xbf, 0xc8,
+  0x38, 0x1c, 0xa3, 0xc5, 0x87, 0x9c, 0xd9, 0xa8, 0xb2, 0xaa, 0x8c, 0x4a,
+  0x79, 0xa0, 0xbf, 0xfc, 0xf0, 0xe0, 0x8c, 0xcb, 0xe2, 0xa9, 0x66, 0xc2,
+  0xab, 0x69, 0x7b, 0x9d, 0x99, 0xab, 0xaa, 0xb3, 0xa5, 0xb7, 0xd2, 0xa6,
+  0xd7, 0xc3, 0xd1, 0xa2, 0xd1, 0xa7, 0x52, 0xa0, 0x4b, 0x4f, 0x9a, 0x6a,
+  0xbc, 0xbe, 0xbc, 0xab, 0x5a, 0x68, 0xc8, 0x87, 0xb3, 0xd3, 0xbf, 0xcd,
+  0xce, 0xb3, 0x5f, 0xb6, 0x99, 0x5a, 0xd1, 0xcc, 0x93, 0xc8, 0xb3, 0xb9,
+  0xad, 0x46, 0x83, 0xd8, 0xbb, 0xd7, 0x8a, 0xb2, 0x7f, 0x2f, 0xb2, 0x8b,
+  0x63, 0xca, 0xbe, 0x72, 0x75, 0xb2, 0x66, 0x78, 0x73, 0xcb, 0xa8, 0xb4,
+  0xba, 0x78, 0x91, 0xa3, 0x7e, 0x7b, 0xc8, 0xca, 0xda, 0x8a, 0x96, 0x83,
+  0x7d, 0xb1, 0xee, 0xdd, 0xd6, 0x9b, 0x61, 0xe3, 0xc8, 0x6e, 0x96, 0x7a,
+  0x65, 0xcb, 0xa7, 0x6d, 0x67, 0x7c, 0x90, 0xd1, 0x9d, 0x68, 0x8c, 0x96,
+  0x6e, 0x61, 0xa1, 0x94, 0xa4, 0xaf, 0x8b, 0xcc, 0x53, 0x6d, 0x7c, 0xac,
+  0xde, 0xcd, 0xad, 0xc6, 0xe2, 0xc2, 0x4b, 0x54, 0x99, 0x6e, 0x30, 0x60,
+  0x83, 0xd0, 0x9d, 0x8a, 0x81, 0xaa, 0xcc, 0xab, 0xce, 0xb8, 0x5e, 0x70,
+  0x4c, 0xc4, 0xb7, 0xea, 0xb0, 0x2f, 0x68, 0x7b, 0x7c, 0xd3, 0xbb, 0xa6,
+  0xcf, 0x84, 0xa3, 0xd1, 0xc0, 0xbb, 0xa7, 0x87, 0xcb, 0xd3, 0x96, 0x66,
+  0x92, 0xa8, 0xc4, 0xd6, 0xcf, 0xd0, 0xa7, 0x85, 0x8b, 0x8b, 0x2a, 0xca,
+  0x99, 0xb6, 0x9c, 0x5c, 0xb0, 0xb6, 0xa8, 0x7b, 0x78, 0x5a, 0xca, 0xbd,
+  0xa2, 0x74, 0x6b, 0xaa, 0x80, 0x9a, 0xc0, 0x9b, 0xed, 0xa8, 0x8f, 0x5a,
+  0x93, 0x98, 0xc0, 0xbd, 0xbc, 0xab, 0xbc, 0xcb, 0xab, 0x8c, 0xd3, 0xe5,
+  0xdc, 0xcb, 0xa4, 0x7c, 0xd4, 0xda, 0xca, 0x9f, 0x49, 0x91, 0xc2, 0xd8,
+  0xb7, 0x9c, 0xda, 0xc7, 0xb8, 0xc7, 0xc6, 0xe4, 0xce, 0x63, 0x40, 0xbc,
+  0xbe, 0xdf, 0x79, 0xb9, 0x92, 0x40, 0x84, 0x81, 0xb9, 0xb2, 0xa9, 0xdb,
+  0xda, 0xb4, 0x7e, 0x0e, 0x99, 0xb8, 0xbc, 0xad, 0x8d, 0xc3, 0xad, 0x85,
+  0x61, 0x49, 0x8b, 0xb0, 0x84, 0xcd, 0xb8, 0x8d, 0x96, 0x31, 0xbf, 0xab,
+  0x9f, 0x62, 0xbe, 0xae, 0x85, 0xa8, 0x8d, 0x87, 0xab, 0x75, 0xc4, 0xd8,
+  0xa1, 0xdf, 0xc0, 0x6c, 0x67, 0xa3, 0x9e, 0x61, 0x4f, 0x6b, 0x96, 0xa1,
+  0xe4, 0xc3, 0xdc, 0xb0, 0xd0, 0xa7, 0x47, 0xb6, 0xa9, 0x7e, 0xb5, 0x7e,
+  0x99, 0x90, 0x75, 0xae, 0x87, 0x5b, 0x90, 0xd4, 0x5f, 0x74, 0x8c, 0xa3,
+  0x78, 0x2e, 0x5f, 0xa9, 0xae, 0xd7, 0xca, 0x97, 0x44, 0x27, 0xae, 0x95,
+  0x97, 0x5c, 0x7c, 0xa4, 0x92, 0xce, 0x97, 0xb4, 0xc5, 0xe7, 0xd2, 0x4d,
+  0x67, 0xdf, 0xda, 0xc4, 0xa4, 0x7f, 0xb1, 0x80, 0x9f, 0x82, 0xa5, 0xa6,
+  0x59, 0x80, 0xc7, 0x9d, 0xbd, 0xb9, 0x98, 0x25, 0x8e, 0xea, 0xbf, 0x80,
+  0x8e, 0x46, 0x34, 0x6b, 0x5f, 0xdd, 0xa2, 0x72, 0xac, 0xda, 0xc7, 0x97,
+  0x85, 0x91, 0x7f, 0xac, 0xdf, 0xad, 0xd0, 0xd2, 0xa0, 0x52, 0x1f, 0x6d,
+  0x80, 0x4f, 0x41, 0x5a, 0xa9, 0xa7, 0x60, 0xb2, 0x7e, 0x67, 0xc7, 0xb2,
+  0x5c, 0x88, 0x8d, 0x90, 0x5d, 0x5f, 0x6c, 0xae, 0xd1, 0x94, 0xb9, 0x8f,
+  0x66, 0xb5, 0x70, 0x60, 0xc0, 0x99, 0xac, 0xa2, 0xbc, 0xa1, 0xd5, 0xd4,
+  0xe5, 0xbc, 0x62, 0xb1, 0xbf, 0xd7, 0xac, 0x88, 0x73, 0xe3, 0xcc, 0x8c,
+  0x84, 0xcc, 0xd6, 0xae, 0x62, 0x85, 0x77, 0x3a, 0x8a, 0x66, 0x66, 0x7a,
+  0x6c, 0xdd, 0xcd, 0x90, 0xd0, 0xc1, 0x8b, 0x85, 0xbf, 0xb0, 0x51, 0x49,
+  0x5d, 0x68, 0x8c, 0xb7, 0xb2, 0xa7, 0xd0, 0xc6, 0x41, 0x9a, 0xc6, 0x98,
+  0x9a, 0xbe, 0xa2, 0xbb, 0x4a, 0x30, 0x7e, 0x9a, 0x9c, 0x3d, 0x83, 0xef,
+  0xa0, 0xb0, 0xb5, 0xb9, 0x3f, 0x76, 0xb1, 0xbb, 0x6c, 0xbe, 0xb3, 0xa4,
+  0xb9, 0xcb, 0xb4, 0x90, 0xcb, 0xc1, 0xd7, 0xb5, 0xa2, 0xb0, 0xac, 0x92,
+  0x8a, 0xd1, 0x75, 0x7e, 0xcd, 0x97, 0x82, 0x97, 0x81, 0x7b, 0x5b, 0x5c,
+  0x5b, 0xe1, 0x89, 0x92, 0x6b, 0x8a, 0x7c, 0x78, 0x6f, 0x43, 0xb0, 0x6d,
+  0x78, 0xa6, 0x85, 0x52, 0xc1, 0xa8, 0xa4, 0x91, 0x6a, 0x78, 0xb0, 0x58,
+  0x89, 0x81, 0x7b, 0xd6, 0xf0, 0xcd, 0xb9, 0x9e, 0xc0, 0xc9, 0x74, 0x81,
+  0xab, 0xb4, 0xe2, 0xc5, 0xa9, 0x3c, 0x70, 0xbe, 0x50, 0x38, 0x9a, 0xad,
+  0xba, 0xa2, 0xcc, 0xa3, 0x62, 0x70, 0xa7, 0xa6, 0x3a, 0x8d, 0xcc, 0xb4,
+  0x92, 0xa7, 0x99, 0x7b, 0x91, 0xdb, 0xaf, 0x67, 0x5e, 0x47, 0x6d, 0xc3,
+  0xb8, 0x89, 0x78, 0xdc, 0x77, 0x3a, 0xa2, 0xe3, 0xc4, 0xdb, 0xde, 0x9e,
+  0x95, 0x68, 0x4d, 0x35, 0x6c, 0x83, 0x6a, 0xc2, 0xd6, 0x3c, 0x2b, 0x68,
+  0x94, 0x84, 0x92, 0x7c, 0x65, 0xcb, 0xe6, 0xb2, 0x7a, 0x48, 0xb6, 0x9f,
+  0xe3, 0x9f, 0xc9, 0xca, 0xed, 0xd7, 0x94, 0x75, 0xb2, 0xa4, 0xb4, 0xc0,
+  0xc6, 0xbe, 0x99, 0x6b, 0x93, 0x7a, 0x8b, 0xa6, 0xc1, 0xb6, 0xe6, 0xf2,
+  0xa4, 0x8e, 0xbf, 0x41, 0x48, 0x44, 0x71, 0xb3, 0x29, 0x26, 0x56, 0x40,
+  0x8c, 0x63, 0x45, 0x51, 0x7e, 0x6c, 0x63, 0x16, 0x7c, 0x8d, 0x86, 0x8e,
+  0xc8, 0xa0, 0xe8, 0x9d, 0x5a, 0xc6, 0x85, 0xa6, 0x9e, 0x8d, 0xa4, 0xda,
+  0x71, 0x3c, 0x21, 0x3f, 0x65, 0x32, 0x64, 0xa9, 0xb5, 0x44, 0x2a, 0x88,
+  0xc7, 0xde, 0x9e, 0x7e, 0x89, 0xaf, 0xda, 0xb1, 0xaf, 0xd4, 0xbc, 0x95,
+  0x8d, 0xe0, 0xb6, 0xb1, 0xa2, 0xae, 0xac, 0xa6, 0xae, 0xa6, 0x5b, 0x86,
+  0xb9, 0x82, 0x7e, 0xd6, 0xb3, 0xba, 0xd0, 0xca, 0xc9, 0x95, 0xac, 0x8a,
+  0x73, 0x7c, 0x7f, 0xd5, 0xd0, 0xcf, 0x73, 0x74, 0x98, 0x75, 0xb5, 0x8b,
+  0x4f, 0xb9, 0xab, 0xc5, 0x81, 0x30, 0x7b, 0x85, 0x94, 0xc1, 0x45, 0x64,
+  0xbd, 0xcf, 0xc2, 0x60, 0x49, 0xa8, 0x8c, 0x97, 0xcb, 0xd3, 0xbf, 0x8a,
+  0xc0, 0xd9, 0xaa, 0x74, 0x9b, 0x8d, 0xc5, 0xd7, 0x9b, 0x6d, 0x5d, 0xa3,
+  0x5f, 0x8f, 0x87, 0xb1, 0xb3, 0x66, 0x6b, 0xa8, 0xa0, 0x99, 0x53, 0x38,
+  0x69, 0x57, 0x50, 0x54, 0x62, 0xcf, 0xa3, 0x20, 0xad, 0x8d, 0x97, 0xef,
+  0x85, 0xb8, 0xd9, 0xc2, 0xb4, 0xbe, 0x9b, 0xd6, 0xc6, 0x75, 0x5e, 0xce,
+  0x80, 0xb0, 0x72, 0x85, 0xd2, 0xc1, 0xbe, 0xc5, 0xdd, 0xdc, 0xb3, 0xa7,
+  0x8e, 0x7c, 0x65, 0x9e, 0xe2, 0xaf, 0x9d, 0xcf, 0x62, 0xb4, 0xc2, 0xac,
+  0xb9, 0xbe, 0x5c, 0x54, 0x3d, 0x8c, 0x58, 0x3e, 0x45, 0x64, 0xae, 0xaa,
+  0xc5, 0xb6, 0x89, 0xb2, 0x9b, 0xc5, 0xd4, 0x9b, 0x63, 0x46, 0x46, 0xc8,
+  0xb3, 0xb7, 0xb8, 0x9f, 0x84, 0x4f, 0xb5, 0x98, 0xa0, 0x9e, 0xd3, 0xb3,
+  0x6e, 0x34, 0x9b, 0xbb, 0x96, 0xbf, 0x54, 0x17, 0x8c, 0x94, 0xa9, 0xe2,
+  0x93, 0x87, 0x86, 0x73, 0xc1, 0xb8, 0xa2, 0x86, 0x9f, 0xd1, 0xbb, 0x97,
+  0xb8, 0x5a, 0x7c, 0xd0, 0xb3, 0x7c, 0x54, 0xc9, 0x7f, 0x50, 0x20, 0x78,
+  0xe0, 0xcb, 0xa2, 0xbc, 0xb0, 0x91, 0x52, 0x10, 0x2d, 0x78, 0x12, 0x65,
+  0x8a, 0x96, 0x95, 0x3f, 0x83, 0xaa, 0x38, 0x89, 0x94, 0x8f, 0x84, 0xb3,
+  0xbd, 0xba, 0xa6, 0x80, 0xdd, 0xc2, 0x82, 0x88, 0xb3, 0xce, 0xb3, 0x57,
+  0xd2, 0xa4, 0x92, 0x81, 0x8f, 0xbf, 0xcf, 0xa3, 0x6e, 0xaa, 0x67, 0x41,
+  0xa3, 0x74, 0xd3, 0xc8, 0xc9, 0x7a, 0xde, 0xa2, 0x3c, 0x6c, 0x8a, 0xbc,
+  0x9f, 0x51, 0x8b, 0xd0, 0xb0, 0x7f, 0x9b, 0x8e, 0x6d, 0x88, 0xcf, 0x80,
+  0x94, 0xb2, 0xa6, 0xa5, 0x9c, 0xd0, 0xab, 0x98, 0xb0, 0xad, 0xc0, 0xbe,
+  0xc7, 0xe5, 0xe3, 0xba, 0x8b, 0xd3, 0xb4, 0xbf, 0xea, 0x92, 0xb2, 0xc0,
+  0x9f, 0xac, 0xaa, 0xa0, 0xb5, 0x8c, 0x5e, 0xd6, 0xca, 0xac, 0x78, 0x79,
+  0x6a, 0xa5, 0x80, 0x6a, 0x6f, 0x8a, 0xb0, 0xb8, 0x67, 0xb9, 0xd1, 0xc6,
+  0xb5, 0xdb, 0xe2, 0xcb, 0xb2, 0x8e, 0x8c, 0x3b, 0x5d, 0xa0, 0xde, 0x3c,
+  0x64, 0x84, 0x78, 0x18, 0x73, 0xa6, 0x3f, 0x44, 0x79, 0x4c, 0x7e, 0x87,
+  0xb7, 0xc0, 0xa4, 0x62, 0x6f, 0x6e, 0x7d, 0x84, 0xe6, 0xb7, 0xa6, 0x84,
+  0xa6, 0xbc, 0x97, 0x70, 0x40, 0x4e, 0xb6, 0x9c, 0xb3, 0xa7, 0x5f, 0x79,
+  0x5e, 0x53, 0xbe, 0x76, 0xab, 0xac, 0x6b, 0xcc, 0xd3, 0xae, 0xc2, 0xad,
+  0xce, 0xa7, 0x85, 0xba, 0x82, 0x4c, 0xa4, 0x9d, 0xcd, 0xaa, 0xc9, 0xc8,
+  0xd2, 0xcc, 0x9a, 0x98, 0x47, 0x7a, 0xf5, 0xc1, 0x92, 0x9d, 0xa4, 0xc9,
+  0x99, 0x7c, 0x9c, 0x8c, 0xa4, 0x58, 0xc0, 0xe6, 0xa6, 0x9c, 0xc4, 0x9d,
+  0x7a, 0xca, 0x8c, 0x71, 0xab, 0xc1, 0x84, 0x9d, 0xc6, 0x9e, 0x6e, 0x8b,
+  0xa9, 0xb7, 0x12, 0x90, 0xa9, 0xd1, 0xaa, 0xbc, 0xa9, 0x9f, 0x96, 0xa4,
+  0x9b, 0xa4, 0x94, 0x88, 0xab, 0x5c, 0x96, 0xe0, 0x9e, 0x97, 0xd3, 0xae,
+  0xb6, 0xb6, 0xa1, 0xc2, 0x57, 0x78, 0xb6, 0xb2, 0x73, 0xa5, 0x5b, 0x4e,
+  0xba, 0xe1, 0x7f, 0x4a, 0xa6, 0xb2, 0xb1, 0x19, 0x6e, 0x55, 0xc3, 0xdc,
+  0xad, 0xc2, 0x99, 0xa5, 0xbe, 0xe4, 0xe2, 0xe1, 0x72, 0x45, 0xb6, 0xca,
+  0xbe, 0x90, 0x60, 0xa9, 0xef, 0xc1, 0xaf, 0x54, 0x9e, 0x92, 0x93, 0xbf,
+  0x8e, 0xbf, 0x80, 0x83, 0xbb, 0x8a, 0x31, 0x1d, 0x32, 0x92, 0xc1, 0x92,
+  0xc4, 0x9c, 0xd3, 0xae, 0xaa, 0x8b, 0x4c, 0x32, 0x66, 0x90, 0xef, 0xe6,
+  0x8e, 0x65, 0xcc, 0xbf, 0x79, 0x5f, 0x76, 0x97, 0xb6, 0x82, 0x2c, 0x48,
+  0x2d, 0xaa, 0x94, 0x9c, 0xe5, 0xc7, 0xa7, 0x90, 0x66, 0x62, 0x89, 0x71,
+  0xa5, 0xb4, 0xbb, 0x74, 0xa9, 0xaf, 0x51, 0x30, 0x74, 0x8e, 0x56, 0x5c,
+  0x96, 0xaf, 0xa9, 0xcd, 0xbb, 0xd7, 0xb8, 0xac, 0xa4, 0xc7, 0xb5, 0x5b,
+  0xa6, 0x6c, 0x5e, 0x84, 0x9f, 0x5b, 0xc1, 0x70, 0x8b, 0xc0, 0xd3, 0xd9,
+  0xb9, 0x9d, 0xda, 0xe9, 0xa2, 0xa2, 0x78, 0x5c, 0x75, 0xe0, 0xad, 0x88,
+  0x8a, 0x51, 0x8a, 0x70, 0x4d, 0x7b, 0x26, 0x81, 0xca, 0x91, 0xb4, 0x90,
+  0x7e, 0x83, 0x9b, 0xe3, 0xe5, 0xb4, 0xca, 0xc6, 0x70, 0x27, 0x48, 0xc6,
+  0xcd, 0xc0, 0xb4, 0x64, 0x63, 0x93, 0x7e, 0x82, 0x73, 0xb2, 0xb5, 0x84,
+  0x93, 0x70, 0x9c, 0x81, 0x60, 0x7d, 0xb5, 0x6a, 0x82, 0xc0, 0xed, 0xcc,
+  0xb9, 0x99, 0x9f, 0x6e, 0x54, 0x23, 0x85, 0xcf, 0xba, 0x96, 0xce, 0xc7,
+  0x71, 0xcb, 0xe3, 0xba, 0x9b, 0xc1, 0x95, 0xcc, 0x66, 0x87, 0x5e, 0xc5,
+  0xb0, 0x9e, 0x64, 0x96, 0xa1, 0x70, 0x68, 0x63, 0x50, 0x7a, 0xb6, 0xd6,
+  0xbc, 0xc5, 0xb7, 0x6b, 0x81, 0x68, 0xb8, 0x93, 0x9a, 0xaf, 0xa8, 0xab,
+  0x84, 0x71, 0xb4, 0x89, 0xaf, 0xd3, 0xe1, 0x98, 0x98, 0x59, 0x51, 0x96,
+  0xab, 0xa8, 0xac, 0xac, 0x5a, 0x90, 0xb1, 0xa6, 0x9c, 0x62, 0x4c, 0xcc,
+  0xb3, 0x9e, 0xc9, 0xdb, 0x77, 0x85, 0xbc, 0xae, 0xcd, 0xc2, 0x62, 0xc0,
+  0xb0, 0xc3, 0x48, 0x56, 0xd1, 0xa8, 0x7c, 0xb4, 0x9b, 0x74, 0xb2, 0xc6,
+  0xdd, 0x9f, 0x85, 0xc7, 0x93, 0x94, 0x64, 0x9a, 0xba, 0xb0, 0xa2, 0x8c,
+  0x9d, 0xca, 0xc1, 0xcb, 0x6a, 0x3f, 0xa8, 0x52, 0x40, 0x0d, 0x50, 0xed,
+  0xf1, 0xe9, 0xdd, 0xac, 0x51, 0x6e, 0xba, 0xd2, 0xd7, 0xcf, 0xca, 0xd6,
+  0xd1, 0xa4, 0x9e, 0x91, 0x8a, 0x60, 0x78, 0x81, 0x8a, 0x29, 0x51, 0xbc,
+  0xb8, 0x74, 0x8b, 0x7d, 0xb9, 0x7a, 0x77, 0xd3, 0xb3, 0xe3, 0xac, 0x3c,
+  0xa3, 0xc1, 0x96, 0x3d, 0x1c, 0x88, 0xb7, 0xa2, 0xcf, 0xc0, 0xdc, 0xb3,
+  0xd6, 0xe8, 0xc6, 0xba, 0x88, 0xa9, 0x79, 0x76, 0x69, 0x97, 0x72, 0x81,
+  0x99, 0x6a, 0x92, 0xc7, 0xc9, 0xd9, 0xb5, 0xde, 0xda, 0xc3, 0x86, 0xa7,
+  0x42, 0x2c, 0x44, 0x5d, 0x8c, 0x78, 0x93, 0x92, 0xe3, 0xdd, 0x9d, 0xb4,
+  0x73, 0x6f, 0xbc, 0x8a, 0xad, 0xc5, 0x91, 0x4a, 0x45, 0x77, 0x7e, 0x73,
+  0x96, 0xbb, 0x51, 0xd1, 0xe4, 0xc2, 0x9b, 0x9d, 0xd5, 0xe0, 0xd6, 0xdc,
+  0xd6, 0xd8, 0xda, 0x9c, 0xb1, 0x82, 0x52, 0x6e, 0x1c, 0xb7, 0xa7, 0x8e,
+  0xaf, 0x32, 0xa1, 0xdd, 0xd6, 0xc8, 0x99, 0x6a, 0x56, 0xcc, 0xc7, 0xce,
+  0xcb, 0xa2, 0x9a, 0x91, 0x65, 0x5b, 0xb1, 0xbc, 0xaf, 0x8f, 0xa8, 0x86,
+  0x88, 0x97, 0x5d, 0x83, 0xca, 0x9c, 0xa8, 0x7f, 0xa1, 0x80, 0x9d, 0x57,
+  0x95, 0xcd, 0x3e, 0x37, 0x7a, 0x66, 0xb6, 0xb8, 0xd9, 0xd7, 0xa8, 0xaa,
+  0x80, 0x80, 0x8a, 0xbc, 0x9c, 0xc6, 0x97, 0x50, 0xc9, 0xd4, 0xde, 0xdb,
+  0xb0, 0x88, 0x98, 0x8b, 0x90, 0x69, 0xd3, 0x74, 0x7b, 0xd6, 0xd4, 0xb8,
+  0xd5, 0x9a, 0x8b, 0x8f, 0xb7, 0xc0, 0xd8, 0x89, 0x7d, 0x80, 0x7f, 0x6b,
+  0xb4, 0xa4, 0xc2, 0xe0, 0xed, 0xda, 0x92, 0x63, 0x8f, 0x63, 0x83, 0xb2,
+  0xc0, 0x99, 0x92, 0xab, 0xab, 0xd0, 0x8a, 0xa2, 0x9c, 0xac, 0xb6, 0x6a,
+  0x89, 0xcd, 0xb3, 0x7d, 0x45, 0x99, 0x5b, 0x7e, 0xbc, 0xc8, 0xb4, 0xb0,
+  0x97, 0x94, 0x4d, 0x10, 0x1f, 0x44, 0xb2, 0x77, 0xd5, 0x81, 0x84, 0x7d,
+  0x75, 0xd1, 0x99, 0x86, 0x42, 0x96, 0x97, 0x8a, 0xd2, 0xdb, 0xab, 0xd5,
+  0x80, 0x49, 0x75, 0xcd, 0xb8, 0x9c, 0x68, 0x7d, 0x94, 0x95, 0xa5, 0x7a,
+  0xc4, 0xb2, 0xbd, 0x97, 0xc8, 0xc4, 0xb4, 0xcb, 0x60, 0xbb, 0xa0, 0x67,
+  0x45, 0x87, 0xa6, 0xb1, 0xd2, 0xdc, 0x82, 0x33, 0x38, 0x77, 0x6e, 0x4c,
+  0xb7, 0x92, 0xad, 0xb3, 0xa3, 0x9e, 0xd5, 0xb8, 0xb2, 0x8f, 0x61, 0x79,
+  0xc0, 0x98, 0xc5, 0xab, 0xa7, 0x8d, 0xb8, 0xd4, 0xa9, 0x97, 0xaa, 0x6e,
+  0xb5, 0xc4, 0xb9, 0xa7, 0xac, 0x7b, 0xb6, 0xa0, 0x79, 0x9b, 0x6e, 0x6b,
+  0xc8, 0xd1, 0x91, 0x14, 0x63, 0xc7, 0x99, 0x96, 0xba, 0x91, 0x78, 0x61,
+  0x3a, 0x75, 0xae, 0xa2, 0xa6, 0x92, 0xbe, 0x3e, 0x52, 0xa7, 0xc1, 0x95,
+  0xbc, 0xc3, 0xae, 0xa6, 0x8c, 0xb2, 0xa8, 0xbf, 0xca, 0x8c, 0x78, 0x59,
+  0x46, 0x98, 0x94, 0xa2, 0xaa, 0x92, 0x51, 0x68, 0x2b, 0x96, 0xda, 0x9c,
+  0x96, 0x8f, 0xc3, 0xaf, 0xdb, 0xcd, 0x8a, 0x8f, 0xde, 0xb4, 0x75, 0xb0,
+  0xc0, 0xce, 0xb6, 0x8f, 0xbb, 0xbf, 0x4b, 0x6b, 0x25, 0x87, 0x55, 0x84,
+  0xbd, 0xe7, 0xb6, 0xa2, 0xdb, 0x78, 0x75, 0xa1, 0xdf, 0xe0, 0xc9, 0xa3,
+  0xad, 0x9a, 0x9f, 0x92, 0x6d, 0x36, 0x59, 0x5a, 0x50, 0x64, 0x50, 0x58,
+  0xbd, 0xb8, 0x68, 0x9d, 0x94, 0x36, 0x7f, 0x24, 0x5d, 0xb0, 0xd6, 0x8b,
+  0xad, 0xeb, 0xd6, 0xc8, 0x9c, 0xdc, 0x89, 0x9d, 0xa2, 0x96, 0xa4, 0xa5,
+  0x8b, 0x9f, 0xd9, 0xc0, 0xa2, 0x96, 0xcc, 0x8e, 0x93, 0xc3, 0xb0, 0x8a,
+  0xb0, 0x60, 0x4e, 0x4e, 0x42, 0x50, 0xc2, 0xb4, 0x81, 0x5e, 0xc7, 0x99,
+  0x7d, 0x90, 0xde, 0x9d, 0xac, 0x9b, 0x9a, 0x8e, 0x77, 0x85, 0x65, 0xa4,
+  0x66, 0x62, 0x58, 0xad, 0xc6, 0x9c, 0x9a, 0x58, 0x27, 0x9f, 0x5d, 0xbf,
+  0xa1, 0xc7, 0x86, 0xac, 0x8a, 0x73, 0xa0, 0x91, 0x35, 0x1b, 0x8b, 0x92,
+  0xac, 0xc5, 0x8f, 0x4f, 0x57, 0xc3, 0x71, 0xc9, 0xb7, 0x5f, 0x77, 0xce,
+  0x8c, 0x9b, 0x4f, 0x6a, 0x52, 0x65, 0xa7, 0x66, 0x9c, 0x9d, 0xbe, 0x82,
+  0xe0, 0xd9, 0x7f, 0x6b, 0x92, 0xce, 0xdc, 0xb3, 0xbe, 0xac, 0x95, 0x99,
+  0x90, 0x62, 0x46, 0x86, 0xd0, 0x89, 0x5e, 0x5b, 0x65, 0xb2, 0xbd, 0x9a,
+  0xb1, 0x4e, 0x50, 0x37, 0x8e, 0x9c, 0xac, 0xb1, 0x98, 0xa9, 0xe6, 0xbf,
+  0xd0, 0xad, 0xb4, 0xdf, 0xcc, 0xac, 0x9b, 0xa5, 0x67, 0x78, 0xa6, 0xb2,
+  0xde, 0xc7, 0x9a, 0xac, 0xcf, 0xb4, 0xc9, 0x7e, 0x6d, 0x7d, 0x30, 0x5f,
+  0x5c, 0x03, 0x85, 0xcc, 0x63, 0x33, 0xa2, 0xb6, 0xd3, 0xcd, 0xd1, 0xbb,
+  0xac, 0x8a, 0x8b, 0xe6, 0xe3, 0xd2, 0xb0, 0xd8, 0x74, 0x77, 0x59, 0x6d,
+  0x7b, 0x95, 0x92, 0x71, 0x1f, 0x54, 0x99, 0xc2, 0x82, 0xd2, 0xc1, 0x79,
+  0x43, 0xc4, 0xa2, 0x77, 0xb8, 0x95, 0x98, 0x82, 0xa9, 0xcc, 0xe0, 0xc3,
+  0x85, 0xa7, 0x8f, 0xcd, 0xce, 0x6e, 0x29, 0x8f, 0xb6, 0x56, 0x4c, 0x2c,
+  0xaf, 0x90, 0xc8, 0xac, 0x5e, 0x33, 0xa9, 0xaf, 0xac, 0xde, 0xcd, 0xa4,
+  0x4c, 0x4e, 0x7b, 0xdc, 0xe6, 0xbe, 0xab, 0xac, 0xce, 0x6f, 0xa2, 0xc7,
+  0xae, 0x9e, 0x7d, 0x75, 0x3a, 0xba, 0xb7, 0xa2, 0xcc, 0xd5, 0xda, 0x9e,
+  0x7a, 0xac, 0xb9, 0x89, 0xbf, 0x66, 0x6e, 0x86, 0x8a, 0xb0, 0xbc, 0xd1,
+  0xe5, 0xb5, 0xe2, 0x87, 0x8c, 0x64, 0x98, 0xb3, 0xa1, 0xa1, 0x60, 0x83,
+  0x9c, 0xc9, 0xb3, 0xce, 0xa0, 0x85, 0x43, 0xb4, 0xa8, 0x27, 0x0a, 0x51,
+  0x3b, 0x32, 0xa0, 0x66, 0x52, 0x78, 0xbe, 0xd9, 0x52, 0x4a, 0x55, 0x5e,
+  0xb1, 0xcd, 0xc2, 0xb7, 0xdf, 0xca, 0xd7, 0xc5, 0x93, 0x99, 0x8b, 0x84,
+  0x6a, 0x31, 0xab, 0xd8, 0x91, 0x2c, 0x7d, 0xb4, 0x6d, 0xd1, 0xc7, 0x8d,
+  0xbc, 0x7d, 0xae, 0xd2, 0x7a, 0xb9, 0xbd, 0xd6, 0xa9, 0x7b, 0xe9, 0xed,
+  0xe3, 0xca, 0x64, 0x51, 0x9e, 0xc4, 0x9b, 0x0c, 0x6f, 0xa4, 0xc9, 0xc5,
+  0xbc, 0x55, 0x45, 0xbd, 0xa5, 0x70, 0xbf, 0xd2, 0xc5, 0x50, 0x22, 0x22,
+  0xc3, 0xad, 0x60, 0x54, 0x8d, 0x5d, 0x2c, 0x71, 0xc3, 0x9c, 0x95, 0xa5,
+  0x71, 0xb0, 0xc7, 0xa9, 0xa1, 0x69, 0xb2, 0xd1, 0x46, 0x4c, 0xd2, 0xc3,
+  0xbd, 0xae, 0xa7, 0x76, 0x8f, 0x3e, 0x89, 0x7a, 0xc7, 0xcd, 0x9c, 0xb1,
+  0xce, 0xcb, 0xc9, 0xd0, 0xa6, 0x76, 0x97, 0x8c, 0xad, 0x44, 0x77, 0xa5,
+  0x82, 0x84, 0x59, 0x7c, 0x9f, 0x8e, 0x79, 0x9e, 0x94, 0x72, 0xbb, 0xa2,
+  0x51, 0x8e, 0xb7, 0xa5, 0xb2, 0x71, 0xb8, 0x9d, 0x67, 0x8e, 0x87, 0x91,
+  0xe4, 0xc2, 0xb6, 0x93, 0x9b, 0x46, 0x92, 0x88, 0x23, 0x17, 0x7b, 0xc2,
+  0xd5, 0xa4, 0x48, 0x51, 0x87, 0x64, 0x75, 0x65, 0xa3, 0x5f, 0x97, 0xe2,
+  0x9e, 0x85, 0xac, 0xd8, 0xe2, 0xaf, 0xc7, 0xd6, 0xd3, 0xe3, 0xc4, 0x91,
+  0x27, 0x58, 0xb7, 0x5b, 0x29, 0x56, 0x6b, 0x4e, 0xbf, 0x89, 0x2f, 0xde,
+  0xbf, 0x62, 0x56, 0x47, 0x91, 0xdc, 0xa6, 0x34, 0x60, 0xf7, 0xad, 0x8e,
+  0x52, 0xaa, 0x27, 0x0e, 0x3b, 0x34, 0x80, 0xd9, 0xe2, 0xde, 0xb6, 0xd4,
+  0x86, 0x66, 0x8b, 0xb6, 0xb9, 0xaf, 0xc2, 0xae, 0x9f, 0xd8, 0xdd, 0x8b,
+  0x6b, 0x75, 0xa1, 0x8b, 0x95, 0xb0, 0xd6, 0xa0, 0xcc, 0xaa, 0x78, 0x5e,
+  0x9d, 0x76, 0x3e, 0xa2, 0xb6, 0x6d, 0x4a, 0x44, 0x7a, 0x47, 0x55, 0xd2,
+  0x53, 0x95, 0x87, 0x85, 0xd5, 0xb5, 0x92, 0x93, 0x78, 0x8e, 0xcb, 0x88,
+  0x6c, 0x36, 0x73, 0xaf, 0xa7, 0xb0, 0x9f, 0x66, 0xa3, 0x9e, 0xbf, 0xa2,
+  0xa5, 0x9f, 0x46, 0xb4, 0xae, 0x83, 0x77, 0x95, 0xa8, 0xb3, 0x43, 0x48,
+  0x91, 0xd3, 0xd4, 0x8c, 0xa1, 0x7e, 0x7e, 0x9a, 0xb4, 0x78, 0x6c, 0x56,
+  0x98, 0x9b, 0x73, 0x84, 0x7f, 0xaa, 0x93, 0xab, 0xba, 0x5e, 0x7b, 0xc4,
+  0xb5, 0xc7, 0xb2, 0x6e, 0x77, 0x7b, 0x30, 0x9b, 0xed, 0xce, 0x92, 0x70,
+  0x8d, 0xac, 0xed, 0xbb, 0x92, 0xca, 0xd9, 0xa5, 0xa4, 0x7d, 0x93, 0x61,
+  0x64, 0x7e, 0x45, 0x2a, 0x74, 0xd5, 0xc3, 0xc9, 0xba, 0x73, 0x48, 0x62,
+  0xa2, 0x61, 0x9a, 0xa3, 0x82, 0x4d, 0x80, 0x76, 0x90, 0x15, 0x37, 0x72,
+  0xad, 0xac, 0xa9, 0x8c, 0x92, 0xd9, 0xca, 0x8e, 0x94, 0xab, 0xd7, 0x8e,
+  0x74, 0x71, 0x54, 0x88, 0xb3, 0x6f, 0x2a, 0x93, 0xc2, 0x4a, 0x67, 0x36,
+  0x82, 0xcf, 0x9a, 0xd0, 0x98, 0x75, 0xa9, 0xbc, 0x84, 0x5c, 0x3d, 0x64,
+  0xb3, 0xa3, 0xdd, 0xbc, 0x80, 0x9f, 0x6a, 0x69, 0x64, 0x6d, 0x61, 0x5d,
+  0xb0, 0xb7, 0x88, 0x82, 0x7f, 0x7a, 0x5e, 0x25, 0x70, 0x22, 0x88, 0x44,
+  0x73, 0xcd, 0xcd, 0xc8, 0xa8, 0x79, 0x33, 0x8b, 0xaf, 0x84, 0x52, 0x7a,
+  0x82, 0x9f, 0xd4, 0xb7, 0x98, 0x9a, 0xb6, 0xac, 0xd0, 0xaf, 0x97, 0x7c,
+  0x71, 0x91, 0xb4, 0x6e, 0xa8, 0xe6, 0x70, 0x52, 0xc0, 0x81, 0x7c, 0xa8,
+  0xaa, 0x96, 0xba, 0x98, 0xe1, 0xbd, 0x8a, 0x42, 0x45, 0x40, 0x51, 0x59,
+  0x56, 0x60, 0x94, 0xb8, 0xc9, 0xab, 0xa3, 0x68, 0xa7, 0x81, 0x32, 0xa8,
+  0x83, 0x68, 0x5b, 0x48, 0xa4, 0xa6, 0x8e, 0xbc, 0xb9, 0xc4, 0x9b, 0x9b,
+  0xb3, 0xa3, 0xb5, 0x81, 0x97, 0x38, 0x95, 0x90, 0x5f, 0x21, 0x61, 0x7c,
+  0x89, 0x6b, 0x81, 0x72, 0x98, 0xb2, 0x5d, 0x3e, 0x52, 0xc9, 0xa4, 0xb1,
+  0xd8, 0xd0, 0xb8, 0xb2, 0x69, 0x52, 0x9c, 0xa8, 0x63, 0x6c, 0xbd, 0xd3,
+  0xbd, 0x8a, 0xb0, 0x67
+};
+
+static const char *XPM_PENCIL_XPM[] = {
+  "24 24 5 1",
+  ".\tc None",
+  "+\tc #000000",
+  "@\tc #DBDBDB",
+  "#\tc #929292",
+  "$\tc #FFFFFF",
+  "........................",
+  "........................",
+  "........................",
+  "........................",
+  "...........++++.........",
+  "...........+@@@+........",
+  "..........+@@@@+#.......",
+  "..........++@@+##.......",
+  ".........+$$+++#........",
+  ".........+$@@+##........",
+  "........+$$@@+#.........",
+  "........+$@@+##.........",
+  ".......+$$@@+#..........",
+  ".......+$@@+##..........",
+  ".......++@@+#...........",
+  ".......++++##...........",
+  ".......+++##............",
+  ".......++##.............",
+  ".......+##..............",
+  "........#...............",
+  "........................",
+  "........................",
+  "........................",
+  "........................"
+};
+
+static const char *XPM_QUILL_XPM[] = {
+  "24 24 5 1",
+  ".\tc None",
+  "+\tc #000000",
+  "@\tc #929292",
+  "#\tc #DBDBDB",
+  "$\tc #FFFFFF",
+  "........................",
+  "........................",
+  "........................",
+  "................++......",
+  "...............++@+.....",
+  "..............++@+++....",
+  ".............++@++++....",
+  "............++@++++@....",
+  "...........++@++++@.....",
+  "..........++@++++@......",
+  "........+++@++++@.......",
+  "......+++++++++@........",
+  ".....++#$$++++@.........",
+  ".....+$+@+#++@..........",
+  "....++$#+@#++@..........",
+  "....+$$+@+@+@...........",
+  "....+$+@##++@...........",
+  "...+$+@#+++@............",
+  "...++@+++@@.............",
+  "..++++@@@...............",
+  "..++@@..................",
+  "...@@...................",
+  "........................",
+  "........................"
+};
+
+static const char *XPM_BRUSH_XPM[] = {
+  "24 24 5 1",
+  ".\tc None",
+  "+\tc #000000",
+  "@\tc #DBDBDB",
+  "#\tc #929292",
+  "$\tc #FFFFFF",
+  "........................",
+  "........................",
+  "........................",
+  "........................",
+  "..............+@@+#.....",
+  "..............+@@+#.....",
+  ".............+@@+##.....",
+  ".............+@@+#......",
+  "............+@@+##......",
+  "............+@@+#.......",
+  "...........+@@+##.......",
+  "...........+@@+#........",
+  "..........++++##........",
+  ".........+@@++#.........",
+  "........+$$@++#.........",
+  "........+$@#++#.........",
+  ".......+$@#++##.........",
+  ".......+@#++##..........",
+  "......+$#++##...........",
+  ".....++++###............",
+  "......####..............",
+  "........................",
+  "........................",
+  "........................"
+};
+
+static const char *XPM_SMUDGE_XPM[] = {
+  "24 24 5 1",
+  ".\tc None",
+  "+\tc #000000",
+  "@\tc #FFFFFF",
+  "#\tc #929292",
+  "$\tc #DBDBDB",
+  "........................",
+  "........................",
+  "........................",
+  "........................",
+  "...........+@@@.........",
+  "..........+@@@@@@+......",
+  ".........+@@@@@@@+#.....",
+  "........+@@@@@@@@+#.....",
+  ".......+@+@@@@@@@$+.....",
+  "......+@+@+@@@@@$$+#....",
+  "......++@+@+@@@$$$+#....",
+  "......+@+@+@@$+$$#+#....",
+  "......++@+@@$++$##+#....",
+  ".......+$+@$+#+###+#....",
+  ".......++@@+++###+##....",
+  "........+@$+####+##.....",
+  ".......+@@++++++##......",
+  ".......+@$+######.......",
+  "......+@$+##............",
+  ".....+@$+##.............",
+  ".....+++##..............",
+  "......###...............",
+  "........................",
+  "........................"
+};
+
+static const char *XPM_ERASER_XPM[] = {
+  "24 24 5 1",
+  ".\tc None",
+  "+\tc #000000",
+  "@\tc #FFFFFF",
+  "#\tc #929292",
+  "$\tc #DBDBDB",
+  "........................",
+  "........................",
+  "........................",
+  "........................",
+  "........................",
+  "........................",
+  "........................",
+  "...........++++++++.....",
+  "..........+@@@@@@++#....",
+  ".........+@@@@@@+$+#....",
+  "........+@@@@@@+$$+#....",
+  ".......+@@@@@@+$$+##....",
+  "......+@@@@@@+$$+##.....",
+  ".....+@@@@@@+$$+##......",
+  "....++++++++$$+##.......",
+  "....+$$$$$$+$+##........",
+  "....+$$$$$$++##.........",
+  "....++++++++##..........",
+  ".....########...........",
+  "........................",
+  "........................",
+  "........................",
+  "........................",
+  "........................"
+};
+
+static const char *XPM_FRISKET_XPM[] = {
+  "24 24 5 1",
+  ". \tc None",
+  "+\tc #929292",
+  "@\tc #DBDBDB",
+  "#\tc #000000",
+  "$\tc #FFFFFF",
+  "........................",
+  "........................",
+  "........................",
+  "..........++............",
+  ".........++++...........",
+  "........++@@++..........",
+  "........++@#++..........",
+  "........++#$++..........",
+  "........##$$++##........",
+  "........#$$@++@###......",
+  ".......#$$@$#+@@###.....",
+  "......#$$@$#@#@@+###....",
+  ".....#$$@$@@#@@++###+...",
+  "....#$$@$@@@@@++####+...",
+  "....#$@$@@@@@++#+###+...",
+  ".....#$@@@@@++#++###+...",
+  "......#$@@@++#++.###+...",
+  ".......#@@++#++..##++...",
+  "........#++#++...#++....",
+  ".........##++.....+.....",
+  "..........++............",
+  "........................",
+  "........................",
+  "........................"
+};
+
+static const char *XPM_BURNISHER_XPM[] = {
+  "24 24 3 1",
+  ". \tc None",
+  "+\tc #000000",
+  "@\tc #929292",
+  "........................",
+  "........................",
+  "........................",
+  "........................",
+  "........................",
+  "........................",
+  ".........+++............",
+  ".......+++++++..........",
+  ".......+++++++..........",
+  "......+++++++++.........",
+  "......+++++++++@........",
+  "......+++++++++@........",
+  ".......+++++++@@........",
+  ".......+++++++@.........",
+  ".........+++@@+.........",
+  "..........@@@.@+........",
+  "...............@+.......",
+  "................@+......",
+  ".................@+.....",
+  "..................@.....",
+  "........................",
+  "........................",
+  "........................",
+  "........................"
+};
+
+static const char *XPM_SCRAPER_XPM[] = {
+  "24 24 4 1",
+  ". \tc None",
+  "+\tc #929292",
+  "@\tc #000000",
+  "#\tc #FFFFFF",
+  "........................",
+  "........................",
+  "........................",
+  "........................",
+  ".................+@+....",
+  "................+@@@....",
+  "...............+@@@+....",
+  "..............+@@@++....",
+  ".............+@@@++.....",
+  "............+@@@++......",
+  "...........+@@@++.......",
+  "..........+@@@++........",
+  ".........+@@@++.........",
+  "........+@@@++..........",
+  ".......+@@@++...........",
+  "......+@##@+............",
+  ".....+@##@+.............",
+  "....++##@+..............",
+  "....@@@@+...............",
+  "........................",
+  "........................",
+  "........................",
+  "........................",
+  "........................"
+};
+
+const Embedded_resource EMBEDDED_RESOURCES[] = {
+  {"rgb/gooch.bw", 128, 128, 1, RGB_GOOCH_BW, NULL},
+  {"rgb/overlay.bw", 128, 128, 1, RGB_OVERLAY_BW, NULL},
+  {"xpm/pencil.xpm", 0, 0, 0, NULL, XPM_PENCIL_XPM},
+  {"xpm/quill.xpm", 0, 0, 0, NULL, XPM_QUILL_XPM},
+  {"xpm/brush.xpm", 0, 0, 0, NULL, XPM_BRUSH_XPM},
+  {"xpm/smudge.xpm", 0, 0, 0, NULL, XPM_SMUDGE_XPM},
+  {"xpm/eraser.xpm", 0, 0, 0, NULL, XPM_ERASER_XPM},
+  {"xpm/frisket.xpm", 0, 0, 0, NULL, XPM_FRISKET_XPM},
+  {"xpm/burnisher.xpm", 0, 0, 0, NULL, XPM_BURNISHER_XPM},
+  {"xpm/scraper.xpm", 0, 0, 0, NULL, XPM_SCRAPER_XPM}
+};
+
+const unsigned int EMBEDDED_RESOURCES_NUMBER = 10;
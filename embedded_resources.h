@@ -0,0 +1,28 @@
+#ifndef __EMBEDDED_RESOURCES_H__
+#define __EMBEDDED_RESOURCES_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Images linked into relief, written by embed_resources from the rgb and
+ * xpm directories (see makefile)
+ */
+typedef struct {
+  const char *name; /* path in the source tree, such as "rgb/gooch.bw" */
+  /* decoded SGI image, bottom row first */
+  unsigned int width, height, components;
+  const unsigned char *pixels;
+  /* or XPM image */
+  const char **xpm;
+} Embedded_resource;
+
+extern const Embedded_resource EMBEDDED_RESOURCES[];
+extern const unsigned int EMBEDDED_RESOURCES_NUMBER;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EMBEDDED_RESOURCES_H__ */
@@ -0,0 +1,60 @@
+#ifndef __EPOCH_FLAGS_HH__
+#define __EPOCH_FLAGS_HH__
+
+#include <cassert>
+
+/*
+ * N flags packed in a word along with the epoch they were last written in.
+ * Flags written in an earlier epoch read as false, so that the flags of all
+ * the faces or cells sharing an epoch are reset at once by starting the
+ * next one. References stand for the flags as bool& would.
+ */
+template <unsigned int N>
+class Epoch_flags {
+public:
+  static const unsigned int EPOCH_MAX = (1u << (32 - N)) - 1;
+  
+  class Reference {
+  public:
+    Reference(Epoch_flags& flags, unsigned int i, unsigned int epoch)
+      : _flags(flags), _i(i), _epoch(epoch) {}
+    operator bool(void) const { return _flags.test(_i, _epoch); }
+    Reference& operator=(bool value) {
+      _flags.set(_i, value, _epoch);
+      return *this;
+    }
+    Reference& operator=(const Reference& reference) {
+      return operator=((bool) reference);
+    }
+  
+  private:
+    Epoch_flags& _flags;
+    unsigned int _i, _epoch;
+  };
+  
+  Epoch_flags(void) : _word(0) {}
+  bool test(unsigned int i, unsigned int epoch) const {
+    assert(i < N);
+    return ((_word >> N) == epoch && (_word & (1u << i)) != 0);
+  }
+  void set(unsigned int i, bool value, unsigned int epoch) {
+    assert(i < N && epoch <= EPOCH_MAX);
+    if ((_word >> N) != epoch) {
+      _word = epoch << N;
+    }
+    if (value) {
+      _word |= (1u << i);
+    } else {
+      _word &= ~(1u << i);
+    }
+  }
+  void clear(unsigned int epoch) {
+    assert(epoch <= EPOCH_MAX);
+    _word = epoch << N;
+  }
+  
+private:
+  unsigned int _word;
+};
+
+#endif // __EPOCH_FLAGS_HH__
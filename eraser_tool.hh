@@ -7,6 +7,7 @@ class Eraser_tool : public Brush_tool {
 public:
   Eraser_tool(Toolbox *toolbox);
   virtual ~Eraser_tool(void);
+  virtual const char *name(void) const;
   virtual void start_recording_path(GdkInputSource source,
                                     gdouble x, gdouble y, gdouble pressure,
                                     gdouble xtilt, gdouble ytilt);
@@ -21,8 +22,6 @@ public:
 private:
   typedef Brush_tool Base;
   
-  static GLboolean _display_list_cb(void *data, GLboolean test_proxy);
-  
   GLfloat _softness;
 };
 
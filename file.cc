@@ -1,32 +1,57 @@
 #include <gtk/gtk.h>
+#include <glib/gstdio.h>
 #include <fstream>
 
 #include "application.hh"
+#include "binary_file.hh"
+#include "journal.hh"
 #include "drawing.hh"
+#include "triangulation.hh"
 #include "meshing.hh"
+#include "tetrahedrization.hh"
+#include "toolbox.hh"
 #include "viewer.hh"
 #include "file.hh"
 
 using namespace std;
 
+static const guint AUTOSAVE_INTERVAL = 2000;
+// Rationale:
+// in milliseconds, batches being small enough to be written at this pace
+static const guint SAVE_POLL_INTERVAL = 100;
+// Rationale:
+// in milliseconds, short enough for the end of a save to be seen at once
+static const guint64 COMPACTION_SIZE = 1 << 22;
+// Rationale:
+// 256K records, whose replay takes longer than reading a snapshot of most
+// models
+
 const char *File::_NULL_NAME = "";
 const char *File::_DEFAULT_NAME = "untitled.rlf";
 const string File::_RLF_EXTENSION = string(".rlf", 4);
-const string File::_TR2_EXTENSION = string(".tr2", 4);
-const string File::_TR3_EXTENSION = string(".tr3", 4);
 const string File::_OFF_EXTENSION = string(".off", 4);
+const string File::_RLM_EXTENSION = string(".rlm", 4);
+const string File::_PLY_EXTENSION = string(".ply", 4);
+const string File::_XYZ_EXTENSION = string(".xyz", 4);
+const string File::_JOURNAL_EXTENSION = string(".journal", 8);
+const string File::_SNAPSHOT_EXTENSION = string(".autosave", 9);
 
 File::File(Application *application) {
   _application = application;
   _drawing_proxy = NULL;
   _meshing_proxy = NULL;
   _viewer_proxy = NULL;
+  _journal = NULL;
+  _autosave_source_id = 0;
+  _save_source_id = 0;
+  _failed_compactions = 0;
   _file_selection = NULL;
   _name = _NULL_NAME;
   _name_selected = _NULL_NAME;
 }
 
 File::~File(void) {
+  _stop_journal();
   _application->remove(_drawing_proxy);
   _application->remove(_meshing_proxy);
   _application->remove(_viewer_proxy);
@@ -37,6 +62,10 @@ File::create(void) {
   _name = _DEFAULT_NAME;
   if ((_drawing_proxy = _application->drawing())->init() &&
       (_meshing_proxy = _application->meshing())->init()) {
+    bool has_recovered = false;
+    if (_recover(has_recovered)) {
+      _start_journal(true);
+    }
     _viewer_proxy = _application->viewer();
   } else {
     _application->remove(this);
@@ -76,6 +105,15 @@ File::open(Type type, const char *name) {
     case OFF:
       response = _create_file_selection("Import OFF", "*.off");
       break;
+    case RLM:
+      response = _create_file_selection("Import compressed mesh", "*.rlm");
+      break;
+    case PLY:
+      response = _create_file_selection("Import PLY point cloud", "*.ply");
+      break;
+    case XYZ:
+      response = _create_file_selection("Import XYZ point cloud", "*.xyz");
+      break;
     default:
       assert(false);
       break;
@@ -92,31 +130,65 @@ File::open(Type type, const char *name) {
     } else {
       cout << "Reading file " << _name_selected << endl;
       switch (type) {
-      case RLF: {
-        string name_read;
-        fin >> name_read;
-        string name_read_d, name_read_m;
-        fin >> name_read_d;
-        fin >> name_read_m;
-        ifstream fin_d, fin_m;
-        fin_d.open(name_read_d.c_str());
-        fin_m.open(name_read_m.c_str());
-        if (fin_d.is_open() &&
-            fin_m.is_open() &&
-            (_drawing_proxy = _application->drawing())->read(fin_d, type) &&
-            (_meshing_proxy = _application->meshing())->read(fin_m, type)) {
-          _name = _name_selected;
-          _viewer_proxy = _application->viewer();
+      case RLF:
+        if (Binary_file::is_binary_file(fin)) {
+          Binary_file binary_file;
+          if (binary_file.read(_name_selected.c_str()) &&
+              (_drawing_proxy = _application->drawing())->read(binary_file) &&
+              (_meshing_proxy = _application->meshing())->read(binary_file)) {
+            _name = _name_selected;
+            bool has_recovered = false;
+            if (_recover(has_recovered)) {
+              _start_journal(has_recovered);
+            }
+            _viewer_proxy = _application->viewer();
+          } else {
+            is_reading_failure = true;
+          }
         } else {
-          is_reading_failure = true;
+          // text file naming CGAL dumps, as written by earlier versions
+          string name_read;
+          fin >> name_read;
+          string name_read_d, name_read_m;
+          fin >> name_read_d;
+          fin >> name_read_m;
+          ifstream fin_d, fin_m;
+          fin_d.open(name_read_d.c_str());
+          fin_m.open(name_read_m.c_str());
+          if (fin_d.is_open() &&
+              fin_m.is_open() &&
+              (_drawing_proxy = _application->drawing())->read(fin_d, type) &&
+              (_meshing_proxy = _application->meshing())->read(fin_m, type)) {
+            _name = _name_selected;
+            bool has_recovered = false;
+            if (_recover(has_recovered)) {
+              _start_journal(has_recovered);
+            }
+            _viewer_proxy = _application->viewer();
+          } else {
+            is_reading_failure = true;
+          }
         }
-      } break;
+        break;
       case OFF:
+      case RLM:
+      case PLY:
+      case XYZ:
         if ((_drawing_proxy = _application->drawing())->init() &&
-            (_meshing_proxy = _application->meshing())->read(fin, type)) {
+            (_meshing_proxy = _application->meshing())->read(
+              _name_selected.c_str(), type)) {
+          const string& extension
+            = (type == OFF) ? _OFF_EXTENSION :
+              (type == RLM) ? _RLM_EXTENSION :
+              (type == PLY) ? _PLY_EXTENSION : _XYZ_EXTENSION;
           _name = _name_selected;
-          string::size_type begin_pos = _name.find(_OFF_EXTENSION);
-          _name.replace(begin_pos, _OFF_EXTENSION.size(), _RLF_EXTENSION);
+          string::size_type begin_pos = _name.find(extension);
+          if (begin_pos == string::npos) {
+            _name += _RLF_EXTENSION;
+          } else {
+            _name.replace(begin_pos, extension.size(), _RLF_EXTENSION);
+          }
+          _start_journal(true);
           _viewer_proxy = _application->viewer();
         } else {
           is_reading_failure = true;
@@ -165,15 +237,31 @@ File::save_as(Type type, const char *name) {
     case OFF:
       response = _create_file_selection("Export OFF", "*.off");
       break;
+    case RLM:
+      response = _create_file_selection("Export compressed mesh", "*.rlm");
+      break;
+    case PLY:
+      response = _create_file_selection("Export PLY", "*.ply");
+      break;
+    case STL:
+      response = _create_file_selection("Export STL", "*.stl");
+      break;
+    case OBJ:
+      response = _create_file_selection("Export OBJ", "*.obj");
+      break;
     default:
       assert(false);
       break;
     }
   }
-  if (response == GTK_RESPONSE_OK) {
+  if (response == GTK_RESPONSE_OK && type == RLF && _journal != NULL) {
+    _save_in_background();
+  } else if (response == GTK_RESPONSE_OK) {
     bool is_writing_failure = false;
     ofstream fout;
-    fout.open(_name_selected.c_str());
+    fout.open(_name_selected.c_str(),
+              (type == OFF || type == OBJ) ? ios::out
+                                           : ios::out | ios::binary);
     if (!fout.is_open()) {
       _display_close_message(GTK_MESSAGE_ERROR,
                              "Error: unable to open file %s for writing!\n",
@@ -182,37 +270,24 @@ File::save_as(Type type, const char *name) {
       cout << "Writing file " << _name_selected << endl;
       switch (type) {
       case RLF: {
-        string name_written = _name_selected;
-        string::size_type begin_pos = name_written.find(_RLF_EXTENSION);
-        if (begin_pos == string::npos) {
-          _display_close_message(GTK_MESSAGE_ERROR,
-                                 "Error: file %s is not a RLF file!\n",
-                                 name_written.c_str());
-          break;
-        }
-        string name_written_d = name_written;
-        name_written_d.replace(begin_pos, _RLF_EXTENSION.size(),
-                               _TR2_EXTENSION);
-        string name_written_m = name_written;
-        name_written_m.replace(begin_pos, _RLF_EXTENSION.size(),
-                               _TR3_EXTENSION);
-        fout << name_written   << endl;
-        fout << name_written_d << endl;
-        fout << name_written_m << endl;
-        ofstream fout_d, fout_m;
-        fout_d.open(name_written_d.c_str());
-        fout_m.open(name_written_m.c_str());
-        if (fout_d.is_open() &&
-            fout_m.is_open() &&
-            _drawing_proxy->write(fout_d, type) &&
-            _meshing_proxy->write(fout_m, type)) {
+        Binary_file binary_file;
+        _drawing_proxy->write(binary_file);
+        _meshing_proxy->write(binary_file);
+        if (binary_file.write(fout)) {
+          // edits saved are dropped from the journal
+          _stop_journal();
           _name = _name_selected;
+          _start_journal(false);
           _viewer_proxy->sync();
         } else {
           is_writing_failure = true;
         }
       } break;
       case OFF:
+      case RLM:
+      case PLY:
+      case STL:
+      case OBJ:
         if (!_meshing_proxy->write(fout, type)) {
           is_writing_failure = true;
         }
@@ -251,6 +326,9 @@ File::close(void) {
     is_closing = true;
   }
   if (is_closing) {
+    if (_save_source_id != 0) {
+      _application->toolbox()->set_status(NULL);
+    }
     _application->remove(this);
   }
   return is_closing;
@@ -270,6 +348,37 @@ File::_file_selection_cb(GtkWidget *widget, File *file) {
   return TRUE;
 }
 
+gboolean
+File::_autosave_cb(gpointer data) {
+  File *file = (File *) data;
+  file->_journal->commit();
+  if (file->_journal->size() > COMPACTION_SIZE) {
+    file->_compact_journal();
+  }
+  return TRUE;
+}
+
+gboolean
+File::_save_cb(gpointer data) {
+  File *file = (File *) data;
+  if (file->_journal->number_of_pending_compactions() > 0) {
+    return TRUE;
+  }
+  file->_save_source_id = 0;
+  file->_application->toolbox()->set_status(NULL);
+  if (file->_journal->number_of_failed_compactions()
+      > file->_failed_compactions) {
+    file->_display_close_message(GTK_MESSAGE_ERROR,
+                                 "Error: while writing file %s!\n",
+                                 file->_name.c_str());
+    // the journal then applies to a snapshot again
+    file->_compact_journal();
+  } else {
+    cout << "File " << file->_name << " written." << endl;
+  }
+  return FALSE;
+}
+
 gint
 File::_create_file_selection(const gchar *action, const gchar *extension) {
   GtkWidget *file_selection = gtk_file_selection_new(action);
@@ -335,3 +444,130 @@ File::_set_file_selection(GtkWidget* file_selection) {
   _file_selection = file_selection;
   assert(_file_selection != NULL);
 }
+
+void
+File::_start_journal(bool is_compacting) {
+  assert(_journal == NULL);
+  _journal = new Journal;
+  if (!_journal->open((_name + _JOURNAL_EXTENSION).c_str())) {
+    cerr << "Warning: autosave disabled!" << endl;
+    delete _journal;
+    _journal = NULL;
+    return;
+  }
+  _application->triangulation()->set_journal(_journal);
+  _application->tetrahedrization()->set_journal(_journal);
+  if (is_compacting) {
+    _compact_journal();
+  } else {
+    // a snapshot left by an earlier session would shadow the file saved
+    g_remove((_name + _SNAPSHOT_EXTENSION).c_str());
+  }
+  _autosave_source_id = g_timeout_add(AUTOSAVE_INTERVAL, _autosave_cb, this);
+}
+
+void
+File::_stop_journal(bool is_removing_files) {
+  if (_journal == NULL) return;
+  g_source_remove(_autosave_source_id);
+  _autosave_source_id = 0;
+  if (_save_source_id != 0) {
+    // closing the journal waits for the save to end
+    g_source_remove(_save_source_id);
+    _save_source_id = 0;
+  }
+  _application->triangulation()->set_journal(NULL);
+  _application->tetrahedrization()->set_journal(NULL);
+  _journal->close();
+  delete _journal;
+  _journal = NULL;
+  if (is_removing_files) {
+    g_remove((_name + _JOURNAL_EXTENSION).c_str());
+    g_remove((_name + _SNAPSHOT_EXTENSION).c_str());
+  }
+}
+
+void
+File::_compact_journal(void) {
+  Binary_file *snapshot = new Binary_file;
+  _drawing_proxy->write(*snapshot);
+  _meshing_proxy->write(*snapshot);
+  _journal->compact(snapshot, (_name + _SNAPSHOT_EXTENSION).c_str());
+}
+
+void
+File::_save_in_background(void) {
+  cout << "Writing file " << _name_selected << " in background" << endl;
+  Binary_file *snapshot = new Binary_file;
+  _drawing_proxy->write(*snapshot);
+  _meshing_proxy->write(*snapshot);
+  
+  vector<string> obsolete_names;
+  if (_name_selected != _name) {
+    // files of the former name are kept until the new file is written
+    obsolete_names.push_back(_name + _JOURNAL_EXTENSION);
+    obsolete_names.push_back(_name + _SNAPSHOT_EXTENSION);
+    _stop_journal(false);
+    _name = _name_selected;
+    _start_journal(false);
+    if (_journal == NULL) {
+      delete snapshot;
+      _display_close_message(GTK_MESSAGE_ERROR,
+                             "Error: unable to open file %s for writing!\n",
+                             _name.c_str());
+      return;
+    }
+  }
+  obsolete_names.push_back(_name + _SNAPSHOT_EXTENSION);
+  _failed_compactions = _journal->number_of_failed_compactions();
+  _journal->compact(snapshot, _name.c_str(), obsolete_names);
+  
+  _viewer_proxy->sync();
+  _application->toolbox()->set_status("Saving...");
+  if (_save_source_id == 0) {
+    _save_source_id = g_timeout_add(SAVE_POLL_INTERVAL, _save_cb, this);
+  }
+}
+
+bool
+File::_recover(bool& has_recovered) {
+  has_recovered = false;
+  string journal_name = _name + _JOURNAL_EXTENSION;
+  string snapshot_name = _name + _SNAPSHOT_EXTENSION;
+  if (!g_file_test(journal_name.c_str(), G_FILE_TEST_EXISTS)) {
+    return true;
+  }
+  gint response
+    = _display_ok_cancel_message(GTK_MESSAGE_QUESTION,
+                                 "Unsaved changes to %s were found.\n"
+                                 "Recover them?\n",
+                                 _name.c_str());
+  if (response != GTK_RESPONSE_OK) {
+    return true;
+  }
+  
+  cout << "Recovering file " << _name << endl;
+  bool is_recovering_failure = false;
+  if (g_file_test(snapshot_name.c_str(), G_FILE_TEST_EXISTS)) {
+    Binary_file snapshot;
+    if (!snapshot.read(snapshot_name.c_str()) ||
+        !_drawing_proxy->read(snapshot) ||
+        !_meshing_proxy->read(snapshot)) {
+      is_recovering_failure = true;
+    }
+  }
+  vector<Journal::Record> records;
+  if (is_recovering_failure ||
+      !Journal::read(journal_name.c_str(), records) ||
+      !_drawing_proxy->replay(records) ||
+      !_meshing_proxy->replay(records)) {
+    // the journal is kept for another attempt, and autosave disabled
+    _display_close_message(GTK_MESSAGE_ERROR,
+                           "Error: unable to recover changes to %s!\n",
+                           _name.c_str());
+    return false;
+  }
+  cout << "done." << endl;
+  has_recovered = true;
+  return true;
+}
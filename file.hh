@@ -6,6 +6,7 @@
 
 class Application;
 class Drawing;
+class Journal;
 class Meshing;
 class Viewer;
 
@@ -13,7 +14,12 @@ class File {
 public:
   typedef enum {
     RLF,
-    OFF
+    OFF,
+    RLM, // compressed mesh
+    PLY, // exported as a mesh, imported as a point cloud
+    STL, // export only
+    OBJ, // export only
+    XYZ  // point cloud, import only
   } Type;
   
   File(Application *application);
@@ -27,6 +33,8 @@ public:
   
 private:
   static gint _file_selection_cb(GtkWidget *widget, File *file);
+  static gboolean _autosave_cb(gpointer data);
+  static gboolean _save_cb(gpointer data);
   
   gint _create_file_selection(const gchar *action, const gchar *extension);
   gint _display_close_message(GtkMessageType type,
@@ -36,18 +44,32 @@ private:
                                   const gchar *message,
                                   const gchar *name) const;
   void _set_file_selection(GtkWidget *file_selection);
+  // the journal applies to the file saved, unless a snapshot is compacted
+  void _start_journal(bool is_compacting);
+  void _stop_journal(bool is_removing_files = true);
+  void _compact_journal(void);
+  // the file is written by the journal writer thread
+  void _save_in_background(void);
+  // false when a journal was found but could not be replayed
+  bool _recover(bool& has_recovered);
   
   static const char *_NULL_NAME;
   static const char *_DEFAULT_NAME;
   static const std::string _RLF_EXTENSION; // .rlf file
-  static const std::string _TR2_EXTENSION; // .tr2 CGAL::Triangulation_2 file
-  static const std::string _TR3_EXTENSION; // .tr3 CGAL::Triangulation_3 file
   static const std::string _OFF_EXTENSION; // .off file
+  static const std::string _RLM_EXTENSION; // .rlm compressed mesh file
+  static const std::string _PLY_EXTENSION; // .ply file
+  static const std::string _XYZ_EXTENSION; // .xyz point cloud file
+  static const std::string _JOURNAL_EXTENSION; // .journal edit journal
+  static const std::string _SNAPSHOT_EXTENSION; // .autosave binary file
   
   Application *_application;
   Drawing *_drawing_proxy;
   Meshing *_meshing_proxy;
   Viewer *_viewer_proxy;
+  Journal *_journal;
+  guint _autosave_source_id, _save_source_id;
+  gint _failed_compactions;
   GtkWidget *_file_selection;
   std::string _name, _name_selected;
 };
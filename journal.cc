@@ -0,0 +1,278 @@
+#include <glib/gstdio.h>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+
+#include "binary_file.hh"
+#include "journal.hh"
+
+using namespace std;
+
+static const char MAGIC[4] = { '\211', 'R', 'L', 'J' };
+static const guint32 BYTE_ORDER_MARK = 0x01020304;
+static const guint32 VERSION = 1;
+static const char *TEMPORARY_EXTENSION = ".tmp";
+// Rationale:
+// snapshots are renamed once complete, so that a crash while writing one
+// leaves the previous snapshot and its journal untouched
+
+typedef struct {
+  char magic[4];
+  guint32 byte_order, version;
+} Header;
+
+Journal::Journal(void)
+  : _name(),
+    _file(NULL),
+    _thread(NULL),
+    _queue(NULL),
+    _records(),
+    _size(0),
+    _pending_compactions(0),
+    _failed_compactions(0) {}
+
+Journal::~Journal(void) {
+  close();
+}
+
+bool
+Journal::open(const char *name) {
+  close();
+  _name = name;
+  if (!_truncate()) {
+    return false;
+  }
+  _queue = g_async_queue_new();
+  GError *error = NULL;
+  _thread = g_thread_create(_writer_thread, this, TRUE, &error);
+  if (_thread == NULL) {
+    cerr << "Error: " << error->message << "!" << endl;
+    g_error_free(error);
+    g_async_queue_unref(_queue);
+    _queue = NULL;
+    fclose(_file);
+    _file = NULL;
+    return false;
+  }
+  return true;
+}
+
+void
+Journal::close(void) {
+  if (_thread != NULL) {
+    commit();
+    _Message *message = new _Message;
+    message->type = _QUIT;
+    message->snapshot = NULL;
+    g_async_queue_push(_queue, message);
+    g_thread_join(_thread);
+    _thread = NULL;
+    g_async_queue_unref(_queue);
+    _queue = NULL;
+  }
+  if (_file != NULL) {
+    fclose(_file);
+    _file = NULL;
+  }
+  _records.clear();
+  _size = 0;
+}
+
+bool
+Journal::is_open(void) const {
+  return (_thread != NULL);
+}
+
+void
+Journal::append(Kind kind, gfloat x, gfloat y, gfloat z) {
+  if (_thread == NULL) return;
+  Record record;
+  record.kind = kind;
+  record.coordinates[0] = x;
+  record.coordinates[1] = y;
+  record.coordinates[2] = z;
+  _records.push_back(record);
+}
+
+void
+Journal::commit(void) {
+  if (_thread == NULL || _records.empty()) return;
+  _Message *message = new _Message;
+  message->type = _BATCH;
+  message->records.swap(_records);
+  message->snapshot = NULL;
+  _size += (message->records.size() + 1) * sizeof(Record);
+  g_async_queue_push(_queue, message);
+}
+
+guint64
+Journal::size(void) const {
+  return _size;
+}
+
+void
+Journal::compact(Binary_file *snapshot, const char *name,
+                 const vector<string>& obsolete_names) {
+  assert(snapshot != NULL);
+  if (_thread == NULL) {
+    delete snapshot;
+    return;
+  }
+  // the snapshot includes the edits not committed yet
+  commit();
+  _Message *message = new _Message;
+  message->type = _COMPACTION;
+  message->snapshot = snapshot;
+  message->name = name;
+  message->obsolete_names = obsolete_names;
+  _size = 0;
+  g_atomic_int_inc(&_pending_compactions);
+  g_async_queue_push(_queue, message);
+}
+
+gint
+Journal::number_of_pending_compactions(void) const {
+  return g_atomic_int_get(&_pending_compactions);
+}
+
+gint
+Journal::number_of_failed_compactions(void) const {
+  return g_atomic_int_get(&_failed_compactions);
+}
+
+bool
+Journal::read(const char *name, vector<Record>& records) {
+  records.clear();
+  ifstream fin(name, ios::in | ios::binary);
+  if (!fin.is_open()) {
+    cerr << "Error: unable to open journal " << name << "!" << endl;
+    return false;
+  }
+  Header header;
+  fin.read((char *) &header, sizeof(Header));
+  if (fin.gcount() != sizeof(Header) ||
+      memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+      header.byte_order != BYTE_ORDER_MARK ||
+      header.version != VERSION) {
+    cerr << "Error: " << name << " is not a valid journal!" << endl;
+    return false;
+  }
+  
+  // a crash may have cut the last batch, which is dropped
+  vector<Record> batch;
+  Record record;
+  while (fin.read((char *) &record, sizeof(Record)) &&
+         fin.gcount() == sizeof(Record)) {
+    if (record.kind == COMMIT) {
+      records.insert(records.end(), batch.begin(), batch.end());
+      batch.clear();
+    } else if (record.kind < COMMIT) {
+      batch.push_back(record);
+    } else {
+      cerr << "Warning: unknown record in journal " << name << "!" << endl;
+      break;
+    }
+  }
+  return true;
+}
+
+gpointer
+Journal::_writer_thread(gpointer data) {
+  Journal *journal = (Journal *) data;
+  bool is_writing = true;
+  while (is_writing) {
+    _Message *message = (_Message *) g_async_queue_pop(journal->_queue);
+    switch (message->type) {
+    case _BATCH:
+      journal->_write_batch(message->records);
+      break;
+    case _COMPACTION:
+      // the journal is kept whole if the snapshot failed
+      if (journal->_write_snapshot(*message->snapshot, message->name)) {
+        // a stale snapshot left would shadow the one written
+        for (vector<string>::const_iterator ni
+               = message->obsolete_names.begin();
+             ni != message->obsolete_names.end(); ni++) {
+          g_remove(ni->c_str());
+        }
+        journal->_truncate();
+      } else {
+        g_atomic_int_inc(&journal->_failed_compactions);
+      }
+      delete message->snapshot;
+      g_atomic_int_add(&journal->_pending_compactions, -1);
+      break;
+    case _QUIT:
+      is_writing = false;
+      break;
+    default:
+      assert(false);
+      break;
+    }
+    delete message;
+  }
+  return NULL;
+}
+
+bool
+Journal::_truncate(void) {
+  if (_file != NULL) {
+    fclose(_file);
+  }
+  _file = g_fopen(_name.c_str(), "wb");
+  if (_file == NULL) {
+    cerr << "Error: unable to open journal " << _name
+         << " for writing!" << endl;
+    return false;
+  }
+  Header header;
+  memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.byte_order = BYTE_ORDER_MARK;
+  header.version = VERSION;
+  fwrite(&header, sizeof(Header), 1, _file);
+  return (fflush(_file) == 0);
+}
+
+bool
+Journal::_write_batch(const vector<Record>& records) {
+  if (_file == NULL) return false;
+  Record commit;
+  commit.kind = COMMIT;
+  commit.coordinates[0] = commit.coordinates[1] = commit.coordinates[2]
+    = 0.0f;
+  fwrite(&records[0], sizeof(Record), records.size(), _file);
+  fwrite(&commit, sizeof(Record), 1, _file);
+  if (fflush(_file) != 0) {
+    cerr << "Error: while writing journal " << _name << "!" << endl;
+    return false;
+  }
+  return true;
+}
+
+bool
+Journal::_write_snapshot(const Binary_file& snapshot, const string& name) {
+  string temporary_name = name + TEMPORARY_EXTENSION;
+  ofstream fout(temporary_name.c_str(), ios::out | ios::binary);
+  if (!fout.is_open() || !snapshot.write(fout)) {
+    cerr << "Error: while writing snapshot " << temporary_name << "!"
+         << endl;
+    return false;
+  }
+  // buffered bytes are flushed on close, which fails when the disk is full
+  fout.close();
+  if (fout.fail()) {
+    cerr << "Error: while writing snapshot " << temporary_name << "!"
+         << endl;
+    g_remove(temporary_name.c_str());
+    return false;
+  }
+  // renaming onto an existing file fails on Windows
+  if (g_rename(temporary_name.c_str(), name.c_str()) != 0 &&
+      (g_remove(name.c_str()) != 0 ||
+       g_rename(temporary_name.c_str(), name.c_str()) != 0)) {
+    cerr << "Error: unable to rename snapshot " << temporary_name << "!"
+         << endl;
+    return false;
+  }
+  return true;
+}
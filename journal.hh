@@ -0,0 +1,92 @@
+#ifndef __JOURNAL_HH__
+#define __JOURNAL_HH__
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <glib.h>
+
+class Binary_file;
+
+/*
+ * Append-only journal of the edits made to the triangulation and the
+ * tetrahedrization since the last snapshot. Records are gathered in memory
+ * and handed over in batches to a writer thread, so that the GTK thread
+ * never waits for the disk. Points are journaled by position, vertex IDs
+ * being recycled.
+ */
+class Journal {
+public:
+  typedef enum {
+    TRIANGULATION_INSERT,
+    TRIANGULATION_REMOVE,
+    TRIANGULATION_CLEAR,
+    MARKING_POINT,
+    MARKING_END,
+    TETRAHEDRIZATION_INSERT,
+    TETRAHEDRIZATION_REMOVE,
+    TETRAHEDRIZATION_CLEAR,
+    COMMIT
+  } Kind;
+  
+  typedef struct {
+    guint32 kind;
+    gfloat coordinates[3];
+  } Record;
+  
+  Journal(void);
+  ~Journal(void);
+  // the journal file is created or truncated
+  bool open(const char *name);
+  void close(void);
+  bool is_open(void) const;
+  void append(Kind kind, gfloat x = 0.0f, gfloat y = 0.0f, gfloat z = 0.0f);
+  // ends the current batch, which is written on the writer thread
+  void commit(void);
+  // size of the batches committed since the last compaction, in bytes
+  guint64 size(void) const;
+  // the snapshot is written to a file of the given name, the obsolete
+  // files are removed and the journal is truncated, all on the writer
+  // thread, which deletes the snapshot
+  // after a crash in between, edits are replayed twice, which leaves the
+  // point sets unchanged
+  void compact(Binary_file *snapshot, const char *name,
+               const std::vector<std::string>& obsolete_names
+                 = std::vector<std::string>());
+  // compactions queued and not written yet, and compactions that failed
+  gint number_of_pending_compactions(void) const;
+  gint number_of_failed_compactions(void) const;
+  // records of the batches completely written, commits aside
+  static bool read(const char *name, std::vector<Record>& records);
+  
+private:
+  typedef enum {
+    _BATCH,
+    _COMPACTION,
+    _QUIT
+  } _Message_type;
+  
+  typedef struct {
+    _Message_type type;
+    std::vector<Record> records;
+    Binary_file *snapshot;
+    std::string name;
+    std::vector<std::string> obsolete_names;
+  } _Message;
+  
+  static gpointer _writer_thread(gpointer data);
+  bool _truncate(void);
+  bool _write_batch(const std::vector<Record>& records);
+  bool _write_snapshot(const Binary_file& snapshot, const std::string& name);
+  
+  std::string _name;
+  FILE *_file;
+  GThread *_thread;
+  GAsyncQueue *_queue;
+  std::vector<Record> _records;
+  guint64 _size;
+  // shared with the writer thread, accessed atomically
+  mutable gint _pending_compactions, _failed_compactions;
+};
+
+#endif // __JOURNAL_HH__
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+#include "latency_meter.hh"
+
+using namespace std;
+
+static const char *CSV_VARIABLE = "RELIEF_LATENCY_CSV";
+
+Latency_meter::Latency_meter(void)
+  : _timer(g_timer_new()),
+    _clock_offset(0.0),
+    _has_clock_offset(false),
+    _received(),
+    _rasterized(),
+    _latencies() {
+  g_timer_start(_timer);
+}
+
+Latency_meter::~Latency_meter(void) {
+  g_timer_destroy(_timer);
+}
+
+void
+Latency_meter::receive(guint32 event_time) {
+  gdouble clock_offset = _now() - (gdouble) event_time;
+  if (!_has_clock_offset || clock_offset < _clock_offset) {
+    _clock_offset = clock_offset;
+    _has_clock_offset = true;
+  }
+  _received.push_back(event_time);
+}
+
+void
+Latency_meter::rasterize(const char *tool_name) {
+  _Sample sample;
+  sample.tool_name = tool_name;
+  sample.rasterize_time = _now();
+  for (vector<guint32>::const_iterator ri = _received.begin();
+       ri != _received.end(); ri++) {
+    sample.event_time = (gdouble) *ri + _clock_offset;
+    _rasterized.push_back(sample);
+  }
+  _received.clear();
+}
+
+void
+Latency_meter::display(void) {
+  gdouble display_time = _now();
+  for (vector<_Sample>::const_iterator si = _rasterized.begin();
+       si != _rasterized.end(); si++) {
+    _Latencies& latencies = _latencies[si->tool_name];
+    latencies.rasterized.push_back(si->rasterize_time - si->event_time);
+    latencies.displayed.push_back(display_time - si->event_time);
+  }
+  _rasterized.clear();
+}
+
+void
+Latency_meter::report(void) {
+  const gchar *csv_name = g_getenv(CSV_VARIABLE);
+  ofstream fout;
+  if (csv_name != NULL && !_latencies.empty()) {
+    bool is_new = !g_file_test(csv_name, G_FILE_TEST_EXISTS);
+    fout.open(csv_name, ios::out | ios::app);
+    if (!fout.is_open()) {
+      cerr << "Error: unable to open file " << csv_name << "!" << endl;
+    } else if (is_new) {
+      fout << "tool,stage,samples,p50_ms,p95_ms,p99_ms" << endl;
+    }
+    fout.setf(ios::fixed);
+    fout.precision(3);
+  }
+  
+  for (map<string, _Latencies>::iterator li = _latencies.begin();
+       li != _latencies.end(); li++) {
+    vector<gdouble> *stages[2] = {
+      &li->second.rasterized, &li->second.displayed
+    };
+    const char *stage_names[2] = {"rasterized", "displayed"};
+    for (int k = 0; k < 2; k++) {
+      gdouble p50 = _percentile(*stages[k], 0.50);
+      gdouble p95 = _percentile(*stages[k], 0.95);
+      gdouble p99 = _percentile(*stages[k], 0.99);
+      g_print("%s latency to %s: p50 %.1f ms, p95 %.1f ms, p99 %.1f ms"
+              " over %lu samples\n", li->first.c_str(), stage_names[k],
+              p50, p95, p99, (unsigned long) stages[k]->size());
+      if (fout.is_open()) {
+        fout << li->first << "," << stage_names[k] << ","
+             << stages[k]->size() << "," << p50 << "," << p95 << ","
+             << p99 << endl;
+      }
+    }
+  }
+  _latencies.clear();
+}
+
+gdouble
+Latency_meter::_now(void) const {
+  return 1000.0 * g_timer_elapsed(_timer, NULL);
+}
+
+gdouble
+Latency_meter::_percentile(vector<gdouble>& values, gdouble p) {
+  if (values.empty()) {
+    return 0.0;
+  }
+  int rank = (int) ceil(p * values.size()) - 1;
+  vector<gdouble>::iterator vi = values.begin() + max(rank, 0);
+  nth_element(values.begin(), vi, values.end());
+  return *vi;
+}
@@ -0,0 +1,53 @@
+#ifndef __LATENCY_METER_HH__
+#define __LATENCY_METER_HH__
+
+#include <glib.h>
+#include <map>
+#include <string>
+#include <vector>
+
+/*
+ * Latency of the input samples, from their GDK event time to the time the
+ * tool has rasterized them, and to the time their pixels are displayed.
+ * Event times are given by the X server clock, which is mapped to the local
+ * clock by the smallest difference seen between them, when an event was
+ * received at once. Latencies are gathered per tool, in milliseconds.
+ */
+class Latency_meter {
+public:
+  Latency_meter(void);
+  ~Latency_meter(void);
+  // a sample just received
+  void receive(guint32 event_time);
+  // the samples received have been drawn into the canvas
+  void rasterize(const char *tool_name);
+  // the samples rasterized are on screen
+  void display(void);
+  // prints the 50th, 95th and 99th percentiles per tool, appending them to
+  // the CSV file named by the environment variable RELIEF_LATENCY_CSV if
+  // any, then starts the measurement again
+  void report(void);
+  
+private:
+  typedef struct {
+    std::vector<gdouble> rasterized, displayed;
+  } _Latencies;
+  typedef struct {
+    std::string tool_name;
+    gdouble event_time, rasterize_time;
+  } _Sample;
+  
+  // milliseconds on the local clock
+  gdouble _now(void) const;
+  // nearest rank percentile, values are reordered
+  static gdouble _percentile(std::vector<gdouble>& values, gdouble p);
+  
+  GTimer *_timer;
+  gdouble _clock_offset; // local minus server time
+  bool _has_clock_offset;
+  std::vector<guint32> _received;
+  std::vector<_Sample> _rasterized;
+  std::map<std::string, _Latencies> _latencies;
+};
+
+#endif // __LATENCY_METER_HH__
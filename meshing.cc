@@ -1,6 +1,8 @@
 #include <fstream>
+#include <algorithm>
 
 #include "application.hh"
+#include "binary_file.hh"
 #include "drawing.hh"
 #include "tetrahedrization_iostream.hh"
 #include "tetrahedrization_display.hh"
@@ -14,6 +16,102 @@ static const float HALFTONING_SCALE = 0.1f;
 static const GLfloat ABSOLUTE_UNIT_OFFSET_SCALE = 0.05f;
 static const GLfloat RELATIVE_UNIT_OFFSET_SCALE = 0.15f;
 static const int BACKGROUND_ERROR = 45;
+static const unsigned int MAX_POINTS_RANGE[2] = {1 << 10, 1 << 22};
+// Rationale:
+// four million points already take a few gigabytes once tetrahedrized
+
+static Tetrahedrization_iostream::Format
+stream_format(File::Type file_type) {
+  switch (file_type) {
+  case File::RLF:
+    return Tetrahedrization_iostream::DEFAULT;
+  case File::OFF:
+    return Tetrahedrization_iostream::OFF;
+  case File::RLM:
+    return Tetrahedrization_iostream::COMPRESSED;
+  case File::PLY:
+    return Tetrahedrization_iostream::PLY;
+  case File::STL:
+    return Tetrahedrization_iostream::STL;
+  case File::OBJ:
+    return Tetrahedrization_iostream::OBJ;
+  case File::XYZ:
+    return Tetrahedrization_iostream::XYZ;
+  default:
+    assert(false);
+    return Tetrahedrization_iostream::DEFAULT;
+  }
+}
+
+static bool
+ask_max_points(unsigned int& max_points) {
+  GtkWidget *dialog = gtk_dialog_new_with_buttons("Import point cloud",
+                                                  NULL,
+                                                  GTK_DIALOG_MODAL,
+                                                  GTK_STOCK_OK,
+                                                  GTK_RESPONSE_OK,
+                                                  GTK_STOCK_CANCEL,
+                                                  GTK_RESPONSE_CANCEL,
+                                                  NULL);
+  
+  GtkWidget *frame = gtk_frame_new("Thinning");
+  gtk_box_pack_start(GTK_BOX(GTK_DIALOG(dialog)->vbox), frame, TRUE, TRUE, 5);
+  
+  GtkWidget *hbox = gtk_hbox_new(FALSE, 0);
+  gtk_container_set_border_width(GTK_CONTAINER(hbox), 5);
+  gtk_container_add(GTK_CONTAINER(frame), hbox);
+  
+  GtkWidget *label = gtk_label_new("Maximum number of points: ");
+  gtk_misc_set_alignment(GTK_MISC(label), 0.0, 0.5);
+  gtk_box_pack_start(GTK_BOX(hbox), label, FALSE, FALSE, 0);
+  
+  GtkAdjustment *adj = (GtkAdjustment *) gtk_adjustment_new(
+    Tetrahedrization_iostream::default_max_points(),
+    MAX_POINTS_RANGE[0], MAX_POINTS_RANGE[1], 1024, 65536, 0);
+  
+  GtkWidget *spinner = gtk_spin_button_new(adj, 1.0, 0);
+  gtk_spin_button_set_numeric(GTK_SPIN_BUTTON(spinner), TRUE);
+  gtk_spin_button_set_wrap(GTK_SPIN_BUTTON(spinner), FALSE);
+  gtk_spin_button_set_update_policy(GTK_SPIN_BUTTON(spinner),
+                                    GTK_UPDATE_IF_VALID);
+  gtk_box_pack_start(GTK_BOX(hbox), spinner, FALSE, FALSE, 0);
+  
+  gtk_widget_show_all(dialog);
+  gint response = gtk_dialog_run(GTK_DIALOG(dialog));
+  bool result = false;
+  switch (response) {
+  case GTK_RESPONSE_OK:
+    max_points = gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(spinner));
+    result = true;
+    break;
+  case GTK_RESPONSE_CANCEL:
+  case GTK_RESPONSE_DELETE_EVENT:
+    result = false;
+    break;
+  default:
+    assert(false);
+    break;
+  }
+  gtk_widget_destroy(dialog);
+  return result;
+}
+
+static void
+display_thinning_message(const Tetrahedrization_iostream& tin) {
+  GtkWidget *dialog
+    = gtk_message_dialog_new(NULL,
+                             GTK_DIALOG_MODAL,
+                             GTK_MESSAGE_INFO,
+                             GTK_BUTTONS_CLOSE,
+                             "The point cloud was thinned to %u of its "
+                             "%u points,\none per voxel of size %g.\n",
+                             tin.number_of_points_kept(),
+                             tin.number_of_points_read(),
+                             tin.thinning_size());
+  gtk_widget_show(dialog);
+  gtk_dialog_run(GTK_DIALOG(dialog));
+  gtk_widget_destroy(dialog);
+}
 
 Meshing::Meshing(Application *application)
   : _application(application),
@@ -25,7 +123,6 @@ Meshing::Meshing(Application *application)
     _smoothed_vertices(),
     _removed_vertices(),
     _visible_vertices(),
-    _visible_facets(),
     _integer_positions(),
     _has_changed(false),
     _is_at_depth(false),
@@ -36,7 +133,6 @@ Meshing::Meshing(Application *application)
   _depthbuf = gl_framebuf_new();
   _colorbuf = gl_framebuf_new();
   _errorbuf = gl_framebuf_new();
-  _itembuf = gl_itembuf_new(GL_ITEMBUF_1D);
   _list = gl_list_new();
   
   gl_framebuf_set_format(_stencilbuf, GL_STENCIL_INDEX);
@@ -56,7 +152,6 @@ Meshing::~Meshing(void) {
   gl_framebuf_delete(_depthbuf);
   gl_framebuf_delete(_colorbuf);
   gl_framebuf_delete(_errorbuf);
-  gl_itembuf_delete(_itembuf);
   gl_list_delete(_list);
 }
 
@@ -86,49 +181,49 @@ Meshing::read(ifstream& fin, File::Type file_type) {
   if (!init()) {
     return false;
   } else {
-    Tetrahedrization_iostream::Format stream_format;
-    switch (file_type) {
-    case File::RLF:
-      stream_format = Tetrahedrization_iostream::DEFAULT;
-      break;
-    case File::OFF:
-      stream_format = Tetrahedrization_iostream::OFF;
-      break;
-    default:
-      assert(false);
-      break;
-    }
     Tetrahedrization_iostream tin(*_tetrahedrization_proxy,
-                                  stream_format, true);
+                                  stream_format(file_type), true);
     fin >> tin;
     if (fin.fail()) {
       fin.clear();
       return false;
     } else {
-      Reconstruct_surface reconstruct_surface(*_tetrahedrization_proxy);
-      reconstruct_surface(_tetrahedrization_proxy->finite_vertices_begin(),
-                          _tetrahedrization_proxy->finite_vertices_end());
+      _reconstruct_read_surface();
       return true;
     }
   }
 }
 
 bool
-Meshing::write(ofstream& fout, File::Type file_type) const {
-  Tetrahedrization_iostream::Format stream_format;
-  switch (file_type) {
-  case File::RLF:
-    stream_format = Tetrahedrization_iostream::DEFAULT;
-    break;
-  case File::OFF:
-    stream_format = Tetrahedrization_iostream::OFF;
-    break;
-  default:
-    assert(false);
-    break;
+Meshing::read(const char *name, File::Type file_type) {
+  if (!init()) {
+    return false;
+  } else {
+    Tetrahedrization_iostream tin(*_tetrahedrization_proxy,
+                                  stream_format(file_type), true);
+    if (file_type == File::PLY || file_type == File::XYZ) {
+      unsigned int max_points = 0;
+      if (!ask_max_points(max_points)) {
+        return false;
+      }
+      tin.set_thinning(0.0, max_points);
+    }
+    if (!tin.read(name)) {
+      return false;
+    } else {
+      if (tin.number_of_points_kept() < tin.number_of_points_read()) {
+        display_thinning_message(tin);
+      }
+      _reconstruct_read_surface();
+      return true;
+    }
   }
+}
+
+bool
+Meshing::write(ofstream& fout, File::Type file_type) const {
   Tetrahedrization_iostream tout(*_tetrahedrization_proxy,
-                                 stream_format, true);
+                                 stream_format(file_type), true);
   fout << tout;
   if (fout.fail()) {
     fout.clear();
@@ -138,6 +233,54 @@ Meshing::write(ofstream& fout, File::Type file_type) const {
   }
 }
 
+bool
+Meshing::read(const Binary_file& file) {
+  // surface flags were saved along with the tetrahedrization
+  return (init() && _tetrahedrization_proxy->read(file));
+}
+
+void
+Meshing::write(Binary_file& file) const {
+  _tetrahedrization_proxy->write(file);
+}
+
+bool
+Meshing::replay(const vector<Journal::Record>& records) {
+  bool has_replayed_edits = false;
+  for (vector<Journal::Record>::const_iterator ri = records.begin();
+       ri != records.end(); ri++) {
+    Point p(ri->coordinates[0], ri->coordinates[1], ri->coordinates[2]);
+    Vertex_handle vh;
+    switch (ri->kind) {
+    case Journal::TETRAHEDRIZATION_INSERT:
+      _tetrahedrization_proxy->insert_first(p);
+      has_replayed_edits = true;
+      break;
+    case Journal::TETRAHEDRIZATION_REMOVE:
+      if (_tetrahedrization_proxy->is_vertex(p, vh)) {
+        _tetrahedrization_proxy->remove_first(vh);
+      }
+      has_replayed_edits = true;
+      break;
+    case Journal::TETRAHEDRIZATION_CLEAR:
+      _tetrahedrization_proxy->clear();
+      has_replayed_edits = true;
+      break;
+    default:
+      // triangulation records
+      break;
+    }
+  }
+  if (has_replayed_edits) {
+    _has_changed = true;
+    if (_tetrahedrization_proxy->dimension() == 3) {
+      _tetrahedrization_proxy->reset_flags();
+      _reconstruct_read_surface();
+    }
+  }
+  return _tetrahedrization_proxy->is_valid();
+}
+
 void
 Meshing::start_meshing(const GLveci drawbox) {
   gl_veci_eq(_drawbox, drawbox);
@@ -179,7 +322,7 @@ Meshing::mesh(GLtransf *ortho, GLtransf *persp) {
   _transf_persp = persp;
   
   /* burnisher and scraper tools */
-  _get_item_buffers();
+  _get_burnished_and_scraped_vertices();
   _smooth_or_remove_tetrahedrization_points();
   if (!_smoothed_vertices.empty() || !_removed_vertices.empty()) {
     _reconstruct_surface();
@@ -207,7 +350,7 @@ Meshing::mesh(GLtransf *ortho, GLtransf *persp) {
                           proj_center[2]);
   
   /* pencil, quill, brush, smudge and frisket tools */
-  _get_stencil_depth_and_item_buffers();
+  _get_stencil_and_depth_buffers();
   if (_visible_vertices.empty()) {
     // drawing either not on surface or at depth: use default depth value
     _evaluate_tesselation_error();
@@ -250,6 +393,16 @@ Meshing::display_tetrahedrization(Tetrahedrization_display::Style style,
   }
 }
 
+bool
+Meshing::pick(GLtransf *persp, GLdouble x, GLdouble y, GLvecf point) {
+  if (_tetrahedrization_proxy == NULL ||
+      _tetrahedrization_proxy->number_of_vertices() == 0) {
+    return false;
+  }
+  unsigned int facet_id;
+  return _cast_ray(persp, x, y, facet_id, point);
+}
+
 GLboolean
 Meshing::_display_list_cb(void *data, GLboolean test_proxy) {
   GLfloat gaussian_kernel[7]
@@ -287,50 +440,11 @@ Meshing::_remove(Tetrahedrization_display *tetrahedrization_display) {
 }
 
 void
-Meshing::_get_item_buffers(void) {
+Meshing::_get_burnished_and_scraped_vertices(void) {
   if (_tetrahedrization_proxy->number_of_vertices() == 0) return;
-  gl_transf_begin(_transf_persp);
-  
-  gl_itembuf_set_port(_itembuf, _drawport);
-  unsigned int npoint_items = _tetrahedrization_proxy->number_of_vertices();
-  gl_itembuf_set_items(_itembuf, &npoint_items);
-  gl_itembuf_render_begin(_itembuf, GL_TRUE);
-  
-  glPushAttrib(GL_POLYGON_BIT | GL_STENCIL_BUFFER_BIT);
-  
-  glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
-  glPolygonOffset(1.0, 1.0);
-  glEnable(GL_POLYGON_OFFSET_FILL);
-  
-  display_tetrahedrization(Tetrahedrization_display::SOLID, false);
-  
-  glDisable(GL_POLYGON_OFFSET_FILL);
-  glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-  glDepthMask(GL_FALSE);
-  glStencilFunc(GL_EQUAL, 0x20, 0x30); /* 0x10 + 0x20 */
-  glEnable(GL_STENCIL_TEST);
-  
-  display_tetrahedrization(Tetrahedrization_display::ITEM_BUFFER_POINTS,
-                           false);
-  
-  glPopAttrib();
+  _read_stencil_buffer();
   
-  gl_itembuf_render_end(_itembuf);
-  gl_itembuf_simple_lookup(_itembuf);
-#if DEBUG
-  gl_framebuf_swrite(_itembuf->gl_framebuf, "debug_06.rgb", GL_FILE_SGI,
-                     GL_FALSE);
-#endif
-  
-  _smoothed_vertices.clear();
-  _smoothed_vertices.reserve(_itembuf->nitems._1D);
-  Finite_vertices_iterator vi
-    = _tetrahedrization_proxy->finite_vertices_begin();
-  for (guint32 i = 0; i < _itembuf->nitems._1D; i++, vi++) {
-    if (_itembuf->items._1D[i] != 0) {
-      _smoothed_vertices.push_back(vi);
-    }
-  }
+  _get_visible_vertices(0x20, 0x30, _smoothed_vertices); /* 0x10 + 0x20 */
 #if DEBUG
   cout << "Smoothing " << _smoothed_vertices.size() << " vertices" << endl;
 #endif
@@ -338,44 +452,14 @@ Meshing::_get_item_buffers(void) {
   // burnisher *or* scraper to avoid problems in determining first vertex
   // inserted or removed (useful for undo purposes)
   if (!_smoothed_vertices.empty()) {
-    gl_transf_end(_transf_persp);
+    _removed_vertices.clear();
     return;
   }
   
-  gl_itembuf_reset_items(_itembuf);
-  gl_itembuf_render_begin(_itembuf, GL_FALSE);
-  
-  glPushAttrib(GL_STENCIL_BUFFER_BIT);
-  
-  glDepthFunc(GL_LESS);
-  glStencilFunc(GL_EQUAL, 0x40, 0x50); /* 0x10 + 0x40 */
-  glEnable(GL_STENCIL_TEST);
-  
-  display_tetrahedrization(Tetrahedrization_display::ITEM_BUFFER_POINTS,
-                           false);
-  
-  glPopAttrib();
-  
-  gl_itembuf_render_end(_itembuf);
-  gl_itembuf_simple_lookup(_itembuf);
-#if DEBUG
-  gl_framebuf_swrite(_itembuf->gl_framebuf, "debug_07.rgb", GL_FILE_SGI,
-                     GL_FALSE);
-#endif
-  
-  _removed_vertices.clear();
-  _removed_vertices.reserve(_itembuf->nitems._1D);
-  vi = _tetrahedrization_proxy->finite_vertices_begin();
-  for (guint32 i = 0; i < _itembuf->nitems._1D; i++, vi++) {
-    if (_itembuf->items._1D[i] != 0) {
-      _removed_vertices.push_back(vi);
-    }
-  }
+  _get_visible_vertices(0x40, 0x50, _removed_vertices); /* 0x10 + 0x40 */
 #if DEBUG
   cout << "Removing " << _removed_vertices.size() << " vertices" << endl;
 #endif
-  
-  gl_transf_end(_transf_persp);
 }
 
 void
@@ -384,11 +468,9 @@ Meshing::_smooth_or_remove_tetrahedrization_points(void) {
     Smooth_surface smooth_surface(*_tetrahedrization_proxy);
     smooth_surface(_smoothed_vertices.begin(), _smoothed_vertices.end());
   } else if (!_removed_vertices.empty()) {
-    vector<Vertex_handle>::iterator vhi = _removed_vertices.begin();
-    _tetrahedrization_proxy->remove_first(*vhi);
-    for (vhi++; vhi != _removed_vertices.end(); vhi++) {
-      _tetrahedrization_proxy->remove(*vhi);
-    }
+    // handles are not used past this point, the tetrahedrization may have
+    // been rebuilt
+    _tetrahedrization_proxy->remove_first(_removed_vertices);
   }
 }
 
@@ -581,7 +663,7 @@ Meshing::_unproject_new_triangulation_points(void) {
 }
 
 void
-Meshing::_get_stencil_depth_and_item_buffers(void) {
+Meshing::_get_stencil_and_depth_buffers(void) {
   if (_tetrahedrization_proxy->number_of_vertices() == 0) {
     _read_stencil_buffer();
     _clear_color_buffer();
@@ -589,7 +671,6 @@ Meshing::_get_stencil_depth_and_item_buffers(void) {
   }
   
   _visible_vertices.clear();
-  _visible_facets.clear();
   
   gl_transf_begin(_transf_persp);
   
@@ -608,97 +689,183 @@ Meshing::_get_stencil_depth_and_item_buffers(void) {
   gl_framebuf_delete(depthbuf);
 #endif
   
-  if (_is_at_depth) {
-    gl_transf_end(_transf_persp);
-    _clear_color_buffer();
-    return;
-  }
-  
-  /* get visible vertices */
-  gl_itembuf_set_port(_itembuf, _drawport);
-  unsigned int npoint_items = _tetrahedrization_proxy->number_of_vertices();
-  gl_itembuf_set_items(_itembuf, &npoint_items);
-  gl_itembuf_render_begin(_itembuf, GL_TRUE);
-  
-  glPushAttrib(GL_POLYGON_BIT | GL_STENCIL_BUFFER_BIT);
-  
-  glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
-  glPolygonOffset(1.0, 1.0);
-  glEnable(GL_POLYGON_OFFSET_FILL);
-  
-  display_tetrahedrization(Tetrahedrization_display::SOLID, false);
-  
-  glDisable(GL_POLYGON_OFFSET_FILL);
-  glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-  glDepthMask(GL_FALSE);
-  glStencilFunc(GL_NOTEQUAL, 0x10, 0x10);
-  glEnable(GL_STENCIL_TEST);
-  
-  display_tetrahedrization(Tetrahedrization_display::ITEM_BUFFER_POINTS,
-                           false);
-  
-  glPopAttrib();
+  gl_transf_end(_transf_persp);
+  _clear_color_buffer();
+  if (_is_at_depth) return;
   
-  gl_itembuf_render_end(_itembuf);
-  gl_itembuf_simple_lookup(_itembuf);
+  /* get visible vertices, outside of the frisket */
+  _get_visible_vertices(0x0, 0x10, _visible_vertices);
 #if DEBUG
-  gl_framebuf_swrite(_itembuf->gl_framebuf, "debug_13.rgb", GL_FILE_SGI,
-                     GL_FALSE);
+  cout << _visible_vertices.size() << " visible vertices" << endl;
 #endif
-  
-  Finite_vertices_iterator vi
-    = _tetrahedrization_proxy->finite_vertices_begin();
-  for (guint32 i = 0; i < _itembuf->nitems._1D; i++, vi++) {
-    if (_itembuf->items._1D[i] != 0) {
-      _visible_vertices[i] = vi;
+}
+
+void
+Meshing::_get_drawport_frustum(GLvecf planes[6]) {
+  /*
+   * The drawport corners are unprojected on the near and far planes, and
+   * each side of the frustum is the plane through three of them, oriented
+   * towards the frustum center.
+   */
+  static const int sides[6][3] = {
+    {0, 3, 4}, {1, 2, 5}, {0, 1, 4}, {3, 2, 7}, {0, 1, 2}, {4, 5, 6}
+  };
+  GLvecd corners[8], center = {0.0, 0.0, 0.0, 1.0};
+  
+  for (int i = 0; i < 8; i++) {
+    GLvecd win;
+    gl_vecd_set(win,
+                _drawport[0] + ((i == 1 || i == 2 || i == 5 || i == 6) ?
+                                _drawport[2] : 0),
+                _drawport[1] + ((i == 2 || i == 3 || i == 6 || i == 7) ?
+                                _drawport[3] : 0),
+                (i < 4) ? 0.0 : 1.0,
+                1.0);
+    if (!gl_transf_unproject(_transf_persp, win, corners[i])) {
+      cerr << "Error: gl_transf_unproject() failure!" << endl;
+      assert(false);
+    }
+    for (int k = 0; k < 3; k++) {
+      center[k] += corners[i][k] / 8.0;
     }
   }
-#if DEBUG
-  cout << _visible_vertices.size() << " visible vertices" << endl;
-#endif
-  
-  /* get visible facets */
-  unsigned int ntriangle_items
-    = _tetrahedrization_proxy->number_of_surface_facets();
-  gl_itembuf_set_items(_itembuf, &ntriangle_items);
-  gl_itembuf_render_begin(_itembuf, GL_TRUE);
-  
-  glPushAttrib(GL_STENCIL_BUFFER_BIT);
-  
-  glStencilFunc(GL_NOTEQUAL, 0x10, 0x10);
-  glEnable(GL_STENCIL_TEST);
-  
-  display_tetrahedrization(Tetrahedrization_display::ITEM_BUFFER_TRIANGLES,
-                           false);
-  
-  glPopAttrib();
-  
-  gl_itembuf_render_end(_itembuf);
-  gl_itembuf_simple_lookup(_itembuf);
-#if DEBUG
-  gl_framebuf_swrite(_itembuf->gl_framebuf, "debug_14.rgb", GL_FILE_SGI,
-                     GL_FALSE);
-#endif
-  
-  guint32 index = 0u;
-  for (All_cells_iterator ci = _tetrahedrization_proxy->all_cells_begin();
-       ci != _tetrahedrization_proxy->all_cells_end(); ci++) {
-    for (int i = 0; i < 4; i++) {
-      if (ci->is_surface_facet(i)) {
-        assert(index < _itembuf->nitems._1D);
-        if (_itembuf->items._1D[index] != 0) {
-          _visible_facets[index] = Facet(ci, i);
-        }
-        index++;
-      }
+  for (int j = 0; j < 6; j++) {
+    const GLdouble *a = corners[sides[j][0]];
+    const GLdouble *b = corners[sides[j][1]];
+    const GLdouble *c = corners[sides[j][2]];
+    GLvecd ab, ac, n;
+    gl_vecd_sub(ab, b, a);
+    gl_vecd_sub(ac, c, a);
+    gl_vecd_set(n,
+                ab[1] * ac[2] - ab[2] * ac[1],
+                ab[2] * ac[0] - ab[0] * ac[2],
+                ab[0] * ac[1] - ab[1] * ac[0],
+                0.0);
+    GLdouble d = - (n[0] * a[0] + n[1] * a[1] + n[2] * a[2]);
+    if (n[0] * center[0] + n[1] * center[1] + n[2] * center[2] + d < 0.0) {
+      gl_vecd_set(n, -n[0], -n[1], -n[2], 0.0);
+      d = -d;
     }
+    gl_vecf_set(planes[j], n[0], n[1], n[2], d);
+  }
+}
+
+void
+Meshing::_get_visible_vertices(GLubyte stencil_value, GLubyte stencil_mask,
+                               vector<Vertex_handle>& vertices) {
+  /*
+   * Replaces item buffer rendering: candidates are the vertices of the
+   * surface facets within the drawport frustum, and the vertices off the
+   * surface, which the item buffer drew too. They are kept if they project
+   * on a pixel whose stencil matches, and if the hierarchy finds no facet
+   * between them and the eye.
+   */
+  const Bounding_volume_hierarchy& hierarchy
+    = _tetrahedrization_display()->bounding_volume_hierarchy();
+  const GLubyte *stencilbuf_pixels = (const GLubyte *) _stencilbuf->pixels;
+  GLvecf planes[6];
+  vector<unsigned int> triangles;
+  vector<GLuint> ids;
+  
+  vertices.clear();
+  _get_drawport_frustum(planes);
+  hierarchy.frustum_query(planes, 6, triangles);
+  ids.reserve(3*triangles.size());
+  for (unsigned int i = 0; i < triangles.size(); i++) {
+    for (int j = 0; j < 3; j++) {
+      ids.push_back(hierarchy.vertex_id(triangles[i], j));
+    }
+  }
+  // vertices off the surface are not in the hierarchy
+  vector<bool> is_surface_vertex(
+    _tetrahedrization_proxy->number_of_vertex_ids(), false);
+  for (unsigned int i = 0; i < hierarchy.number_of_triangles(); i++) {
+    for (int j = 0; j < 3; j++) {
+      assert(hierarchy.vertex_id(i, j) < is_surface_vertex.size());
+      is_surface_vertex[hierarchy.vertex_id(i, j)] = true;
+    }
+  }
+  for (Finite_vertices_iterator vi
+         = _tetrahedrization_proxy->finite_vertices_begin();
+       vi != _tetrahedrization_proxy->finite_vertices_end(); vi++) {
+    if (!is_surface_vertex[vi->id()]) {
+      ids.push_back(vi->id());
+    }
+  }
+  sort(ids.begin(), ids.end());
+  ids.erase(unique(ids.begin(), ids.end()), ids.end());
+  
+  vector<GLfloat> points;
+  vector<GLuint> candidate_ids;
+  points.reserve(3*ids.size());
+  candidate_ids.reserve(ids.size());
+  for (unsigned int i = 0; i < ids.size(); i++) {
+    Point p(_tetrahedrization_proxy->vertex_with_id(ids[i])->point());
+    GLvecd obj, win;
+    
+    gl_vecd_set(obj, p.x(), p.y(), p.z(), 1.0);
+    if (!gl_transf_project(_transf_persp, obj, win)) {
+      cerr << "Error: gl_transf_project() failure!" << endl;
+      assert(false);
+    }
+    if (win[2] < 0.0 || win[2] > 1.0) continue;
+    GLuint index = gl_framebuf_index(_stencilbuf,
+                                     (GLint) floor(win[0]),
+                                     (GLint) floor(win[1]));
+    if (index == GL_FRAMEBUF_NULL_INDEX ||
+        (stencilbuf_pixels[index] & stencil_mask) != stencil_value) {
+      continue;
+    }
+    points.push_back(p.x());
+    points.push_back(p.y());
+    points.push_back(p.z());
+    candidate_ids.push_back(ids[i]);
   }
-#if DEBUG
-  cout << _visible_facets.size() << " visible facets" << endl;
-#endif
   
-  gl_transf_end(_transf_persp);
-  _clear_color_buffer();
+  GLvecd proj_center;
+  if (!gl_transf_get_proj_center(_transf_persp, proj_center)) {
+    cerr << "Error: gl_transf_get_proj_center() failure!" << endl;
+    assert(false);
+  }
+  GLvecf eye;
+  gl_vecf_set(eye, proj_center[0], proj_center[1], proj_center[2], 1.0f);
+  vector<GLboolean> is_visible;
+  hierarchy.are_visible(eye, points, candidate_ids, is_visible);
+  for (unsigned int i = 0; i < candidate_ids.size(); i++) {
+    if (is_visible[i]) {
+      vertices.push_back(
+        _tetrahedrization_proxy->vertex_with_id(candidate_ids[i]));
+    }
+  }
+}
+
+bool
+Meshing::_cast_ray(GLtransf *transf, GLdouble x, GLdouble y,
+                   unsigned int& facet_id, GLvecf point) {
+  const Bounding_volume_hierarchy& hierarchy
+    = _tetrahedrization_display()->bounding_volume_hierarchy();
+  GLvecd win, obj_near, obj_far;
+  
+  gl_vecd_set(win, x, y, 0.0, 1.0);
+  if (!gl_transf_unproject(transf, win, obj_near)) return false;
+  gl_vecd_set(win, x, y, 1.0, 1.0);
+  if (!gl_transf_unproject(transf, win, obj_far)) return false;
+  
+  GLvecf origin, direction;
+  GLfloat t;
+  gl_vecf_set(origin, obj_near[0], obj_near[1], obj_near[2], 1.0f);
+  gl_vecf_set(direction,
+              obj_far[0] - obj_near[0],
+              obj_far[1] - obj_near[1],
+              obj_far[2] - obj_near[2],
+              0.0f);
+  if (!hierarchy.ray_cast(origin, direction, facet_id, t)) return false;
+  gl_vecf_set(point,
+              origin[0] + t * direction[0],
+              origin[1] + t * direction[1],
+              origin[2] + t * direction[2],
+              1.0f);
+  return true;
 }
 
 void
@@ -709,9 +876,9 @@ Meshing::_render_tesselation_with_tetrahedrization_points(const Point& eye,
   GLvecd obj, win;
   
   _integer_positions.clear();
-  for (map<guint32, Vertex_handle>::iterator vhi = _visible_vertices.begin();
+  for (vector<Vertex_handle>::iterator vhi = _visible_vertices.begin();
        vhi != _visible_vertices.end(); vhi++) {
-    Vertex_handle vh_3D = vhi->second;
+    Vertex_handle vh_3D = *vhi;
     Point p_3D = vh_3D->point();
     
     mean_vector = mean_vector + (p_3D - CGAL::ORIGIN);
@@ -776,7 +943,7 @@ Meshing::_insert_new_tetrahedrization_points_in_tesselation(
   GLfloat *depthbuf_pixels = (GLfloat *) _depthbuf->pixels;
   GLubyte *colorbuf_pixels = (GLubyte *) _colorbuf->pixels;
   GLubyte *errorbuf_pixels = (GLubyte *) _errorbuf->pixels;
-  guint32 *itembuf_pixels = (guint32 *) _itembuf->gl_framebuf->pixels;
+  GLubyte *stencilbuf_pixels = (GLubyte *) _stencilbuf->pixels;
   int width  = _errorbuf->width;
   int height = _errorbuf->height;
   int number_of_inserted_points = 0;
@@ -793,12 +960,21 @@ Meshing::_insert_new_tetrahedrization_points_in_tesselation(
           number_of_inserted_points++;
           vh->depth() = depthbuf_pixels[index];
           vh->offsetub() = colorbuf_pixels[index];
-          guint32 id = itembuf_pixels[index];
-          if (id != GL_ITEMBUF_NULL_ID) {
-            assert(id < _itembuf->nitems._1D);
+          // normal of the facet seen through the pixel center, if any
+          GLuint stencil_index = gl_framebuf_index(_stencilbuf,
+                                                   position.first,
+                                                   position.second);
+          unsigned int facet_id;
+          GLvecf facet_point;
+          assert(stencil_index != GL_FRAMEBUF_NULL_INDEX);
+          if (!(stencilbuf_pixels[stencil_index] & 0x10) &&
+              _cast_ray(_transf_persp,
+                        position.first + 0.5, position.second + 0.5,
+                        facet_id, facet_point)) {
             vh->normal()
-              = _tetrahedrization_proxy->triangle(_visible_facets[id])
-                  .supporting_plane().orthogonal_vector();
+              = _tetrahedrization_proxy->triangle(
+                  _tetrahedrization_display()->surface_facet_with_id(
+                    facet_id)).supporting_plane().orthogonal_vector();
           } else {
             vh->normal() = normal;
           }
@@ -908,14 +1084,18 @@ Meshing::_clear_color_buffer(void) {
   glPopAttrib();
 }
 
+void
+Meshing::_reconstruct_read_surface(void) {
+  Reconstruct_surface reconstruct_surface(*_tetrahedrization_proxy);
+  reconstruct_surface(_tetrahedrization_proxy->finite_vertices_begin(),
+                      _tetrahedrization_proxy->finite_vertices_end());
+}
+
 void
 Meshing::_reconstruct_surface(void) {
   assert(_tetrahedrization_proxy->dimension() == 3);
   cout << "Reconstruct surface" << endl;
-  for (All_cells_iterator ci = _tetrahedrization_proxy->all_cells_begin();
-       ci != _tetrahedrization_proxy->all_cells_end(); ci++) {
-    ci->reset();
-  }
+  _tetrahedrization_proxy->reset_flags();
   Reconstruct_surface reconstruct_surface(*_tetrahedrization_proxy);
   reconstruct_surface(_tetrahedrization_proxy->finite_vertices_begin(),
                       _tetrahedrization_proxy->finite_vertices_end());
@@ -924,7 +1104,15 @@ Meshing::_reconstruct_surface(void) {
        << " vertices and "
        << _tetrahedrization_proxy->number_of_surface_facets()
        << " faces" << endl;
-  _remove(_tetrahedrization_display_ptr);
+#if DEBUG
+  cout << (double) _tetrahedrization_proxy->number_of_bytes()
+            / _tetrahedrization_proxy->number_of_vertices()
+       << " bytes per vertex" << endl;
+#endif
+  // keep the display, only the facets that changed are uploaded again
+  if (_tetrahedrization_display_ptr != NULL) {
+    _tetrahedrization_display_ptr->update();
+  }
   cout << "done." << endl;
   _has_changed = true;
 }
@@ -7,10 +7,12 @@
 //#include <hash_set>
 
 #include "file.hh"
+#include "journal.hh"
 #include "tetrahedrization_display.hh"
 #include "tesselation.hh"
 
 class Application;
+class Binary_file;
 
 class Meshing {
 public:
@@ -21,13 +23,20 @@ public:
   bool& is_at_depth(void);
   bool init(void);
   bool read(std::ifstream& fin, File::Type file_type);
+  bool read(const char *name, File::Type file_type);
   bool write(std::ofstream& fout, File::Type file_type) const;
+  bool read(const Binary_file& file);
+  void write(Binary_file& file) const;
+  // edits journaled since the last snapshot read
+  bool replay(const std::vector<Journal::Record>& records);
   void start_meshing(const GLveci drawbox);
   void stop_meshing(void);
   void mesh(GLtransf *ortho, GLtransf *persp);
   void unmesh(void);
   void display_tetrahedrization(Tetrahedrization_display::Style style,
                                 bool display_bbox);
+  // surface point under window position (x, y), if any
+  bool pick(GLtransf *persp, GLdouble x, GLdouble y, GLvecf point);
   
 private:
   typedef Tetrahedrization::Geom_traits::Kernel::Vector_3 Vector;
@@ -41,7 +50,7 @@ private:
   static GLboolean _display_list_cb(void *data, GLboolean test_proxy);
   Tetrahedrization_display *_tetrahedrization_display(void);
   void _remove(Tetrahedrization_display *tetrahedrization_display);
-  void _get_item_buffers(void);
+  void _get_burnished_and_scraped_vertices(void);
   void _smooth_or_remove_tetrahedrization_points(void);
   void _evaluate_tesselation_error(void);
   void _insert_new_triangulation_points_in_tesselation(
@@ -49,7 +58,12 @@ private:
   void _insert_new_triangulation_points_in_tesselation_at_depth(
     const Vector& normal, const Point& eye);
   void _unproject_new_triangulation_points(void);
-  void _get_stencil_depth_and_item_buffers(void);
+  void _get_stencil_and_depth_buffers(void);
+  void _get_drawport_frustum(GLvecf planes[6]);
+  void _get_visible_vertices(GLubyte stencil_value, GLubyte stencil_mask,
+                             std::vector<Vertex_handle>& vertices);
+  bool _cast_ray(GLtransf *transf, GLdouble x, GLdouble y,
+                 unsigned int& facet_id, GLvecf point);
   void _render_tesselation_with_tetrahedrization_points(const Point& eye,
                                                         Point& center);
   void _insert_new_tetrahedrization_points_in_tesselation(
@@ -57,6 +71,7 @@ private:
   void _unproject_new_tetrahedrization_points(void);
   void _read_stencil_buffer(void);
   void _clear_color_buffer(void);
+  void _reconstruct_read_surface(void);
   void _reconstruct_surface(void);
   void _set_height_field_offset_scale(double height_field_max, GLdouble depth);
   
@@ -65,13 +80,11 @@ private:
   Tetrahedrization_display *_tetrahedrization_display_ptr;
   GLveci _drawbox, _drawport;
   GLframebuf *_stencilbuf, *_depthbuf, *_colorbuf, *_errorbuf;
-  GLitembuf *_itembuf;
   GLlist *_list;
   Tesselation _tesselation;
   GLtransf *_transf_ortho, *_transf_persp;
   std::vector<Vertex_handle> _smoothed_vertices, _removed_vertices;
-  std::map<guint32, Vertex_handle> _visible_vertices;
-  std::map<guint32, Facet> _visible_facets;
+  std::vector<Vertex_handle> _visible_vertices;
   std::set< std::pair<int, int> > _integer_positions;
   bool _has_changed, _is_at_depth;
   GLfloat _offset_scale;
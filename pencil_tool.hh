@@ -9,6 +9,7 @@ class Pencil_tool : public Tool {
 public:
   Pencil_tool(Toolbox *toolbox);
   virtual ~Pencil_tool(void);
+  virtual const char *name(void) const;
   virtual void start_drawing_pixels(GdkInputSource source,
                                     gdouble x, gdouble y, gdouble pressure,
                                     gdouble xtilt, gdouble ytilt);
@@ -20,10 +21,9 @@ public:
 private:
   typedef Tool Base;
   
-  static GLboolean _display_list_cb(void *data, GLboolean test_proxy);
+  void _draw_segment(void);
   
   Vec2f _point_1, _point_2;
-  GLfloat _point_size;
   GLfloat _line_width;
   GLvecf _color;
 };
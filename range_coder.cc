@@ -0,0 +1,211 @@
+#include <cassert>
+#include <cstdio>
+
+#include "range_coder.hh"
+
+using namespace std;
+
+static const int PROBABILITY_BITS = 11;
+static const guint16 PROBABILITY_INIT = 1 << (PROBABILITY_BITS - 1);
+static const int ADAPTATION_SHIFT = 5;
+// Rationale:
+// the same precision and adaptation rate as in LZMA, which adapt within
+// a few dozen symbols and still reach skewed probabilities
+static const guint32 TOP = 1 << 24;
+
+Range_integer_model::Range_integer_model(void) {
+  for (int k = 0; k <= _MAX_LENGTH; k++) {
+    _length[k] = PROBABILITY_INIT;
+    for (int j = 0; j < _MODELED_BITS; j++) {
+      _leading[k][j] = PROBABILITY_INIT;
+    }
+  }
+}
+
+Range_encoder::Range_encoder(ostream& out)
+  : _out(out),
+    _low(0),
+    _range(0xFFFFFFFFu),
+    _cache(0),
+    _cache_size(1) {}
+
+Range_encoder::~Range_encoder(void) {}
+
+void
+Range_encoder::encode_bits(guint32 value, int n) {
+  assert(0 <= n && n <= 32);
+  for (int i = n - 1; i >= 0; i--) {
+    _range >>= 1;
+    if ((value >> i) & 1) {
+      _low += _range;
+    }
+    while (_range < TOP) {
+      _range <<= 8;
+      _shift_low();
+    }
+  }
+}
+
+void
+Range_encoder::encode_integer(Range_integer_model& model, guint32 value) {
+  assert(value < 0xFFFFFFFFu);
+  guint32 u = value + 1;
+  int k = 0;
+  while ((u >> k) > 1) k++;
+  for (int i = 0; i < k; i++) {
+    _encode_bit(model._length[i], 1);
+  }
+  _encode_bit(model._length[k], 0);
+  
+  int j = 0;
+  for (; j < k && j < Range_integer_model::_MODELED_BITS; j++) {
+    _encode_bit(model._leading[k][j], (u >> (k - 1 - j)) & 1);
+  }
+  if (j < k) {
+    encode_bits(u & ((1u << (k - j)) - 1), k - j);
+  }
+}
+
+void
+Range_encoder::encode_signed_integer(Range_integer_model& model,
+                                     gint32 value) {
+  // zigzag mapping, so that small magnitudes get small codes
+  encode_integer(model, ((guint32) value << 1) ^ (guint32) (value >> 31));
+}
+
+void
+Range_encoder::flush(void) {
+  for (int i = 0; i < 5; i++) {
+    _shift_low();
+  }
+}
+
+void
+Range_encoder::_encode_bit(guint16& probability, int bit) {
+  guint32 bound = (_range >> PROBABILITY_BITS) * probability;
+  if (bit == 0) {
+    _range = bound;
+    probability += ((1 << PROBABILITY_BITS) - probability)
+                   >> ADAPTATION_SHIFT;
+  } else {
+    _low += bound;
+    _range -= bound;
+    probability -= probability >> ADAPTATION_SHIFT;
+  }
+  while (_range < TOP) {
+    _range <<= 8;
+    _shift_low();
+  }
+}
+
+void
+Range_encoder::_shift_low(void) {
+  // a carry may still propagate into the cached byte and the 0xFF bytes
+  // that follow it
+  if ((guint32) _low < 0xFF000000u || (_low >> 32) != 0) {
+    guint8 carry = (guint8) (_low >> 32);
+    guint8 byte = _cache;
+    do {
+      _out.put((char) (guint8) (byte + carry));
+      byte = 0xFF;
+    } while (--_cache_size != 0);
+    _cache = (guint8) (_low >> 24);
+  }
+  _cache_size++;
+  _low = (_low & 0x00FFFFFFu) << 8;
+}
+
+Range_decoder::Range_decoder(istream& in)
+  : _in(in),
+    _code(0),
+    _range(0xFFFFFFFFu),
+    _has_failed(false) {
+  for (int i = 0; i < 5; i++) {
+    _code = (_code << 8) | _next_byte();
+  }
+}
+
+Range_decoder::~Range_decoder(void) {}
+
+guint32
+Range_decoder::decode_bits(int n) {
+  assert(0 <= n && n <= 32);
+  guint32 value = 0;
+  for (int i = 0; i < n; i++) {
+    _range >>= 1;
+    guint32 bit = 0;
+    if (_code >= _range) {
+      _code -= _range;
+      bit = 1;
+    }
+    value = (value << 1) | bit;
+    while (_range < TOP) {
+      _range <<= 8;
+      _code = (_code << 8) | _next_byte();
+    }
+  }
+  return value;
+}
+
+guint32
+Range_decoder::decode_integer(Range_integer_model& model) {
+  int k = 0;
+  while (k < Range_integer_model::_MAX_LENGTH &&
+         _decode_bit(model._length[k]) == 1) {
+    k++;
+  }
+  
+  guint32 u = 1;
+  int j = 0;
+  for (; j < k && j < Range_integer_model::_MODELED_BITS; j++) {
+    u = (u << 1) | _decode_bit(model._leading[k][j]);
+  }
+  if (j < k) {
+    u = (u << (k - j)) | decode_bits(k - j);
+  }
+  return u - 1;
+}
+
+gint32
+Range_decoder::decode_signed_integer(Range_integer_model& model) {
+  guint32 u = decode_integer(model);
+  return (gint32) (u >> 1) ^ -(gint32) (u & 1);
+}
+
+bool
+Range_decoder::fail(void) const {
+  return _has_failed;
+}
+
+int
+Range_decoder::_decode_bit(guint16& probability) {
+  guint32 bound = (_range >> PROBABILITY_BITS) * probability;
+  int bit = 0;
+  if (_code < bound) {
+    _range = bound;
+    probability += ((1 << PROBABILITY_BITS) - probability)
+                   >> ADAPTATION_SHIFT;
+  } else {
+    _code -= bound;
+    _range -= bound;
+    probability -= probability >> ADAPTATION_SHIFT;
+    bit = 1;
+  }
+  while (_range < TOP) {
+    _range <<= 8;
+    _code = (_code << 8) | _next_byte();
+  }
+  return bit;
+}
+
+guint8
+Range_decoder::_next_byte(void) {
+  int c = _in.get();
+  if (c == EOF) {
+    // the encoder flushes enough bytes that a complete stream never ends
+    // while decoding
+    _has_failed = true;
+    return 0;
+  }
+  return (guint8) c;
+}
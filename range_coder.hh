@@ -0,0 +1,72 @@
+#ifndef __RANGE_CODER_HH__
+#define __RANGE_CODER_HH__
+
+#include <iostream>
+#include <glib.h>
+
+/*
+ * Adaptive binary range coder, in the manner of the one of LZMA. Unsigned
+ * integers are binarized with an Elias gamma code: the bit length is coded
+ * in unary, then the leading bits below the most significant one are coded
+ * with adaptive probabilities, and the trailing bits as is.
+ */
+class Range_integer_model {
+public:
+  Range_integer_model(void);
+  
+private:
+  friend class Range_encoder;
+  friend class Range_decoder;
+  
+  static const int _MAX_LENGTH = 32;
+  static const int _MODELED_BITS = 2;
+  
+  // probabilities of zero bits, in 1/2048th
+  guint16 _length[_MAX_LENGTH + 1];
+  guint16 _leading[_MAX_LENGTH + 1][_MODELED_BITS];
+};
+
+class Range_encoder {
+public:
+  Range_encoder(std::ostream& out);
+  ~Range_encoder(void);
+  // n equiprobable bits, the most significant first, with n <= 32
+  void encode_bits(guint32 value, int n);
+  // value < 2^32 - 1
+  void encode_integer(Range_integer_model& model, guint32 value);
+  void encode_signed_integer(Range_integer_model& model, gint32 value);
+  // to be called once, after the last symbol
+  void flush(void);
+  
+private:
+  void _encode_bit(guint16& probability, int bit);
+  void _shift_low(void);
+  
+  std::ostream& _out;
+  guint64 _low;
+  guint32 _range;
+  guint8 _cache;
+  guint64 _cache_size;
+};
+
+class Range_decoder {
+public:
+  Range_decoder(std::istream& in);
+  ~Range_decoder(void);
+  guint32 decode_bits(int n);
+  guint32 decode_integer(Range_integer_model& model);
+  gint32 decode_signed_integer(Range_integer_model& model);
+  // true when the stream ended before the coded data
+  bool fail(void) const;
+  
+private:
+  int _decode_bit(guint16& probability);
+  guint8 _next_byte(void);
+  
+  std::istream& _in;
+  guint32 _code;
+  guint32 _range;
+  bool _has_failed;
+};
+
+#endif // __RANGE_CODER_HH__
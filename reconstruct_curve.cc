@@ -1,3 +1,5 @@
+#include <map>
+
 #include "reconstruct_curve.hh"
 
 using namespace std;
@@ -28,67 +30,22 @@ Reconstruct_curve::operator()(vector<Vertex_handle>& vertices) {
     return;
   }
   
-  /* initialization */
-  vector<Edge> convex_hull_edges;
   if (distance(vertices.begin(), vertices.end())
         == _triangulation.number_of_vertices()) {
     // full reconstruction of the point set
     // assuming all faces of the triangulation have been reset
-    _triangulation.set_granularity(vertices.begin(), vertices.end());
-    Face_circulator
-      fc = _triangulation.incident_faces(_triangulation.infinite_vertex()),
-      done(fc);
-    do {
-      fc->is_outside() = true;
-      for (int i = 0; i < 3; i++) {
-        if (_triangulation.is_infinite(fc->vertex(i))) {
-          convex_hull_edges.push_back(Edge(fc, i));
-          _convect(convex_hull_edges.back());
-        }
-      }
-    } while (++fc != done);
-  } else {
-#if 0
-    // partial reconstruction of the point set
-    set<Vertex_handle> adjacent_vertices(vertices.begin(), vertices.end());
-    for (vector<Vertex_handle>::iterator vhi = vertices.begin();
-         vhi != vertices.end(); vhi++) {
-      Vertex_circulator vc = _triangulation.incident_vertices(*vhi), done(vc);
-      do {
-        adjacent_vertices.insert(vc);
-      } while (++vc != done);
-    }
-    _triangulation.set_granularity(adjacent_vertices.begin(),
-                                   adjacent_vertices.end());
-    Vertex_handle infinite_vertex = _triangulation.infinite_vertex();
-    set<Face_handle> incident_faces;
-    for (vector<Vertex_handle>::iterator vhi = vertices.begin();
-         vhi != vertices.end(); vhi++) {
-      Face_circulator fc = _triangulation.incident_faces(*vhi), done(fc);
-      do {
-        if (fc->has_vertex(infinite_vertex)) {
-          incident_faces.insert(fc);
-        }
-      } while (++fc != done);
+    _reconstruct(vertices);
+  } else if (!_reconstruct_locally(vertices)) {
+    // a stroke closing or opening a region changes the whole curve
+    _triangulation.reset_flags();
+    vector<Vertex_handle> triangulation_vertices;
+    triangulation_vertices.reserve(_triangulation.number_of_vertices());
+    for (Finite_vertices_iterator vi = _triangulation.finite_vertices_begin();
+         vi != _triangulation.finite_vertices_end(); vi++) {
+      triangulation_vertices.push_back(vi);
     }
-    for (set<Face_handle>::const_iterator fhi = incident_faces.begin();
-         fhi != incident_faces.end(); fhi++) {
-      for (int i = 0; i < 3; i++) {
-        Face_handle fh(*fhi);
-        if (_triangulation.is_infinite(fh->vertex(i))) {
-          convex_hull_edges.push_back(Edge(fh, i));
-          _convect(convex_hull_edges.back());
-        }
-      }
-    }
-#else
-    assert(false);
-#endif
+    _reconstruct(triangulation_vertices);
   }
-  
-  /* convection */
-  _start_convection();
-  _stop_convection(convex_hull_edges);
 }
 
 void
@@ -121,6 +78,168 @@ Reconstruct_curve::operator()(set<Face_handle>& marked_faces) {
   _stop_convection(marked_faces_edges);
 }
 
+void
+Reconstruct_curve::_reconstruct(vector<Vertex_handle>& vertices) {
+  /* initialization */
+  vector<Edge> convex_hull_edges;
+  _triangulation.set_granularity(vertices.begin(), vertices.end());
+  Face_circulator
+    fc = _triangulation.incident_faces(_triangulation.infinite_vertex()),
+    done(fc);
+  do {
+    fc->is_outside() = true;
+    for (int i = 0; i < 3; i++) {
+      if (_triangulation.is_infinite(fc->vertex(i))) {
+        convex_hull_edges.push_back(Edge(fc, i));
+        _convect(convex_hull_edges.back());
+      }
+    }
+  } while (++fc != done);
+  
+  /* convection */
+  _start_convection();
+  _stop_convection(convex_hull_edges);
+}
+
+// The granularity only depends on the incident vertices, and whether an
+// edge is convectable on the granularity of its vertices and on the faces
+// sharing it. Thus only the faces incident to the vertices or to their
+// neighbors are convected again, from the outside faces around them.
+bool
+Reconstruct_curve::_reconstruct_locally(vector<Vertex_handle>& vertices) {
+  /* initialization */
+  set<Vertex_handle> adjacent_vertices(vertices.begin(), vertices.end());
+  for (vector<Vertex_handle>::iterator vhi = vertices.begin();
+       vhi != vertices.end(); vhi++) {
+    Vertex_circulator vc = _triangulation.incident_vertices(*vhi), done(vc);
+    do {
+      if (!_triangulation.is_infinite(vc)) {
+        adjacent_vertices.insert(vc);
+      }
+    } while (++vc != done);
+  }
+  _triangulation.set_granularity(adjacent_vertices.begin(),
+                                 adjacent_vertices.end());
+  set<Face_handle> incident_faces;
+  for (set<Vertex_handle>::iterator vhi = adjacent_vertices.begin();
+       vhi != adjacent_vertices.end(); vhi++) {
+    Face_circulator fc = _triangulation.incident_faces(*vhi), done(fc);
+    do {
+      incident_faces.insert(fc);
+    } while (++fc != done);
+  }
+  for (set<Face_handle>::iterator fhi = incident_faces.begin();
+       fhi != incident_faces.end(); fhi++) {
+    Face_handle fh(*fhi);
+    fh->reset();
+    fh->is_outside() = _triangulation.is_infinite(fh);
+  }
+  
+  // restart from the convex hull and from the outside faces left as is
+  vector<Edge> restart_edges;
+  for (set<Face_handle>::iterator fhi = incident_faces.begin();
+       fhi != incident_faces.end(); fhi++) {
+    Face_handle fh(*fhi);
+    for (int i = 0; i < 3; i++) {
+      Face_handle fh_next = fh->neighbor(i);
+      if (!_triangulation.is_infinite(fh, i) &&
+          incident_faces.find(fh_next) == incident_faces.end()) {
+        int i_next = fh->mirror_index(i);
+        fh_next->is_convection_edge(i_next) = false;
+        fh_next->is_curve_edge(i_next) = false;
+        if (fh_next->is_outside()) {
+          restart_edges.push_back(Edge(fh_next, i_next));
+        }
+      }
+    }
+  }
+  for (set<Face_handle>::iterator fhi = incident_faces.begin();
+       fhi != incident_faces.end(); fhi++) {
+    Face_handle fh(*fhi);
+    for (int i = 0; i < 3; i++) {
+      if (_triangulation.is_infinite(fh->vertex(i))) {
+        restart_edges.push_back(Edge(fh, i));
+      }
+    }
+  }
+  for (vector<Edge>::iterator ei = restart_edges.begin();
+       ei != restart_edges.end(); ei++) {
+    _convect(*ei);
+  }
+  
+  /* convection */
+  _start_convection();
+  vector<Edge> thin_part_edges;
+  _stop_convection(restart_edges, &thin_part_edges);
+  return _is_region_unchanged(incident_faces, thin_part_edges);
+}
+
+// Fronts meet on both sides of an open stroke, leaving thin parts whose
+// sides are joined around the end of the stroke, within the star. When a
+// stroke closes a region, the front coming from the stale outside faces
+// of that region meets the outer one along the stroke only. When erasing
+// opens a region, the fronts reach its former curve, beyond the star.
+bool
+Reconstruct_curve::_is_region_unchanged(
+  const set<Face_handle>& faces,
+  const vector<Edge>& thin_part_edges) const {
+  if (thin_part_edges.empty()) {
+    return true;
+  }
+  set<Edge> thin_part_half_edges;
+  for (vector<Edge>::const_iterator ei = thin_part_edges.begin();
+       ei != thin_part_edges.end(); ei++) {
+    Edge e_in(ei->first->neighbor(ei->second),
+              ei->first->mirror_index(ei->second));
+    if (faces.find(ei->first) == faces.end() ||
+        faces.find(e_in.first) == faces.end()) {
+      return false;
+    }
+    thin_part_half_edges.insert(*ei);
+    thin_part_half_edges.insert(e_in);
+  }
+  
+  // outside faces joined across edges that are neither curve nor thin
+  // part edges
+  map<Face_handle, int> components;
+  vector<Face_handle> stack;
+  int n = 0;
+  for (set<Face_handle>::const_iterator fhi = faces.begin();
+       fhi != faces.end(); fhi++) {
+    if (!(*fhi)->is_outside() || components.find(*fhi) != components.end()) {
+      continue;
+    }
+    components[*fhi] = n;
+    stack.push_back(*fhi);
+    while (!stack.empty()) {
+      Face_handle fh(stack.back());
+      stack.pop_back();
+      for (int i = 0; i < 3; i++) {
+        Face_handle fh_next = fh->neighbor(i);
+        int i_next = fh->mirror_index(i);
+        if (fh_next->is_outside() &&
+            !fh->is_curve_edge(i) && !fh_next->is_curve_edge(i_next) &&
+            faces.find(fh_next) != faces.end() &&
+            components.find(fh_next) == components.end() &&
+            thin_part_half_edges.find(Edge(fh, i))
+              == thin_part_half_edges.end()) {
+          components[fh_next] = n;
+          stack.push_back(fh_next);
+        }
+      }
+    }
+    n++;
+  }
+  for (vector<Edge>::const_iterator ei = thin_part_edges.begin();
+       ei != thin_part_edges.end(); ei++) {
+    Face_handle fh_next = ei->first->neighbor(ei->second);
+    if (components[ei->first] != components[fh_next]) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void
 Reconstruct_curve::_convect(const Edge& e_out) {
   // vertices and inside half edge
@@ -182,7 +301,8 @@ Reconstruct_curve::_start_convection(void) {
 
 template <typename Edge_container>
 void
-Reconstruct_curve::_stop_convection(Edge_container& edges) {
+Reconstruct_curve::_stop_convection(Edge_container& edges,
+                                    vector<Edge> *thin_part_edges) {
   while (!_curve_edges.empty()) { // remove thin part edges
     Edge e_out(_curve_edges.front());
     _curve_edges.pop();
@@ -195,14 +315,19 @@ Reconstruct_curve::_stop_convection(Edge_container& edges) {
       e_out.first->is_curve_edge(e_out.second) = false;
       e_in.first->is_convection_edge(e_in.second) = false;
       e_in.first->is_curve_edge(e_in.second) = false;
+      if (thin_part_edges != NULL) {
+        thin_part_edges->push_back(e_out);
+      }
     }
   }
 }
 
 template void
 Reconstruct_curve::_stop_convection< vector<Triangulation::Edge> >(
-  vector<Triangulation::Edge>& edges);
+  vector<Triangulation::Edge>& edges,
+  vector<Triangulation::Edge> *thin_part_edges);
 
 template void
 Reconstruct_curve::_stop_convection< set<Triangulation::Edge> >(
-  set<Triangulation::Edge>& edges);
+  set<Triangulation::Edge>& edges,
+  vector<Triangulation::Edge> *thin_part_edges);
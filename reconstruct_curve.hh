@@ -9,6 +9,8 @@ class Reconstruct_curve {
 public:
   Reconstruct_curve(Triangulation& triangulation);
   ~Reconstruct_curve(void);
+  // all the vertices, the faces being reset, or only those whose incident
+  // edges changed since the curve was last reconstructed
   void operator()(std::vector<Triangulation::Vertex_handle>& vertices);
   void operator()(std::set<Triangulation::Face_handle>& marked_faces);
   
@@ -21,10 +23,19 @@ private:
   typedef Triangulation::Vertex_circulator Vertex_circulator;
   typedef Triangulation::Face_circulator Face_circulator;
   
+  void _reconstruct(std::vector<Vertex_handle>& vertices);
+  // false when the curve changed beyond the star of the vertices
+  bool _reconstruct_locally(std::vector<Vertex_handle>& vertices);
+  // false when thin parts lie beyond the faces, or when their two sides
+  // are not joined by outside faces among them
+  bool _is_region_unchanged(const std::set<Face_handle>& faces,
+                            const std::vector<Edge>& thin_part_edges) const;
   void _convect(const Edge& e_out);
   void _start_convection(void);
+  // thin part edges removed are appended to thin_part_edges, if any
   template <typename Edge_container>
-  void _stop_convection(Edge_container& edges);
+  void _stop_convection(Edge_container& edges,
+                        std::vector<Edge> *thin_part_edges = NULL);
   
   Triangulation& _triangulation;
   std::queue<Edge> _convection_edges;
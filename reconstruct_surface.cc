@@ -127,13 +127,16 @@ Reconstruct_surface::_convect(const Facet& f_out) {
   //Sphere sphere(vh1->point(), vh2->point(), vh3->point());
   bool is_not_gabriel
     = sphere.has_on_bounded_side(f_in.first->vertex(f_in.second)->point());
-  assert(vh1->granularity() != 0 &&
-         vh2->granularity() != 0 &&
-         vh3->granularity() != 0 );
+  FT granularity1 = _tetrahedrization.granularity(vh1);
+  FT granularity2 = _tetrahedrization.granularity(vh2);
+  FT granularity3 = _tetrahedrization.granularity(vh3);
+  assert(granularity1 != 0 &&
+         granularity2 != 0 &&
+         granularity3 != 0 );
   bool is_hiding_cavity
     = (sphere.squared_radius()
-       > GRANULARITY_RATIO * min(vh1->granularity(), min(vh2->granularity(),
-                                                         vh3->granularity())));
+       > GRANULARITY_RATIO * min(granularity1, min(granularity2,
+                                                   granularity3)));
   bool is_convectable = (is_not_gabriel || is_hiding_cavity);
   bool is_resting_on_surface
     = f_in.first->is_surface_facet(f_in.second);
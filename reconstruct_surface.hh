@@ -14,6 +14,7 @@ public:
   
 private:
   typedef Tetrahedrization::Geom_traits::Kernel::Sphere_3 Sphere;
+  typedef Tetrahedrization::Geom_traits::FT FT;
   typedef Tetrahedrization::Point Point;
   typedef Tetrahedrization::Facet Facet;
   typedef Tetrahedrization::Vertex_handle Vertex_handle;
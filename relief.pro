@@ -33,7 +33,7 @@ unix:LIBS         += -lXt -lSM -lICE -ldl \
                      -lgtk-x11-2.0 -lgdk-x11-2.0 -lgdk_pixbuf-2.0 \
                      -latk-1.0 \
                      -lpangoxft-1.0 -lpangox-1.0 -lpango-1.0 \
-                     -lgobject-2.0 -lgmodule-2.0 -lglib-2.0 \
+                     -lgobject-2.0 -lgmodule-2.0 -lgthread-2.0 -lglib-2.0 \
                      -L$(CGAL_LIB_DIR) -lCGAL -lgmp \
                      -L$(HOME)/$(HOSTTYPE)/lib -lopenglutils
 win32:LIBS        += /libpath:C:/GtkGLExt/1.0/lib \
@@ -43,7 +43,8 @@ win32:LIBS        += /libpath:C:/GtkGLExt/1.0/lib \
                      atk-1.0.lib gdk_pixbuf-2.0.lib \
                      pangowin32-1.0.lib pangoft2-1.0.lib \
                      pango-1.0.lib \
-                     gobject-2.0.lib gmodule-2.0.lib glib-2.0.lib \
+                     gobject-2.0.lib gmodule-2.0.lib \
+                     gthread-2.0.lib glib-2.0.lib \
                      intl.lib iconv.lib \
                      /libpath:C:/CGAL-3.0.1/lib/msvc7 \
                      CGAL.lib \
@@ -62,20 +63,29 @@ SOURCES           =  main.cc \
                      frisket_tool.cc \
                      burnisher_tool.cc \
                      scraper_tool.cc \
-                     tool_texture.cc \
+                     canvas.cc \
                      file.cc \
+                     binary_file.cc \
+                     journal.cc \
                      drawing.cc \
+                     tiled_texture.cc \
                      triangulation.cc \
                      triangulation_display.cc \
                      reconstruct_curve.cc \
                      meshing.cc \
                      tetrahedrization.cc \
                      tetrahedrization_iostream.cc \
+                     range_coder.cc \
+                     voxel_grid.cc \
                      tetrahedrization_display.cc \
+                     bounding_volume_hierarchy.cc \
                      reconstruct_surface.cc \
                      smooth_surface.cc \
                      tesselation.cc \
                      viewer.cc \
+                     latency_meter.cc \
                      debug.cc \
-                     images.c
+                     resources.cc \
+                     images.c \
+                     embedded_resources.c
 TARGET            =  relief
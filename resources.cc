@@ -0,0 +1,98 @@
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "embedded_resources.h"
+#include "resources.hh"
+
+using namespace std;
+
+static const char *DIRECTORY_VARIABLE = "RELIEF_RESOURCES";
+
+static const Embedded_resource *
+find_embedded(const char *name) {
+  for (unsigned int i = 0; i < EMBEDDED_RESOURCES_NUMBER; i++) {
+    if (strcmp(EMBEDDED_RESOURCES[i].name, name) == 0) {
+      return &EMBEDDED_RESOURCES[i];
+    }
+  }
+  return NULL;
+}
+
+string Resources::_directory;
+bool Resources::_is_directory_read = false;
+
+bool
+Resources::read_image(GLframebuf *buf, const char *name) {
+  assert(buf != NULL);
+  string override_name = _override_name(name);
+  if (!override_name.empty()) {
+    if (gl_framebuf_sread(buf, override_name.c_str(), GL_FILE_SGI)) {
+      return true;
+    }
+    cerr << "Warning: unable to read image " << override_name
+         << ", using the linked one!" << endl;
+  }
+  const Embedded_resource *resource = find_embedded(name);
+  if (resource == NULL || resource->pixels == NULL) {
+    cerr << "Error: no image " << name << " linked!" << endl;
+    return false;
+  }
+  // framebuffers own their pixels
+  size_t size
+    = resource->width * resource->height * resource->components;
+  GLubyte *pixels = (GLubyte *) malloc(size);
+  assert(pixels != NULL);
+  memcpy(pixels, resource->pixels, size);
+  free(buf->pixels);
+  buf->width = resource->width;
+  buf->height = resource->height;
+  buf->components = resource->components;
+  switch (resource->components) {
+  case 1: buf->format = GL_LUMINANCE; break;
+  case 2: buf->format = GL_LUMINANCE_ALPHA; break;
+  case 3: buf->format = GL_RGB; break;
+  case 4: buf->format = GL_RGBA; break;
+  default:
+    assert(false);
+    break;
+  }
+  buf->type = GL_UNSIGNED_BYTE;
+  buf->pixels = pixels;
+  return true;
+}
+
+GtkWidget *
+Resources::new_image(const char *name) {
+  string override_name = _override_name(name);
+  if (!override_name.empty()) {
+    return gtk_image_new_from_file(override_name.c_str());
+  }
+  const Embedded_resource *resource = find_embedded(name);
+  if (resource == NULL || resource->xpm == NULL) {
+    cerr << "Error: no image " << name << " linked!" << endl;
+    return gtk_image_new();
+  }
+  GdkPixbuf *pixbuf = gdk_pixbuf_new_from_xpm_data(resource->xpm);
+  GtkWidget *image = gtk_image_new_from_pixbuf(pixbuf);
+  g_object_unref(pixbuf);
+  return image;
+}
+
+// empty when there is no file of this name in the override directory
+string
+Resources::_override_name(const char *name) {
+  if (!_is_directory_read) {
+    const gchar *directory = g_getenv(DIRECTORY_VARIABLE);
+    _directory = (directory != NULL) ? directory : "";
+    _is_directory_read = true;
+  }
+  if (_directory.empty()) {
+    return string();
+  }
+  gchar *path = g_build_filename(_directory.c_str(), name, NULL);
+  string override_name = g_file_test(path, G_FILE_TEST_EXISTS) ? path : "";
+  g_free(path);
+  return override_name;
+}
@@ -0,0 +1,27 @@
+#ifndef __RESOURCES_HH__
+#define __RESOURCES_HH__
+
+#include <gtk/gtk.h>
+#include <string>
+#include <opengl_buffer.h>
+
+/*
+ * Images used at startup, linked into relief so that it runs from any
+ * directory. A file of the same name in the directory given by the
+ * environment variable RELIEF_RESOURCES, if any, replaces the linked
+ * image, for editing images without rebuilding.
+ */
+class Resources {
+public:
+  // names are relative, such as "rgb/gooch.bw"
+  static bool read_image(GLframebuf *buf, const char *name);
+  static GtkWidget *new_image(const char *name);
+  
+private:
+  static std::string _override_name(const char *name);
+  
+  static std::string _directory;
+  static bool _is_directory_read;
+};
+
+#endif // __RESOURCES_HH__
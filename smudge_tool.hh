@@ -1,13 +1,15 @@
 #ifndef __SMUDGE_TOOL_HH__
 #define __SMUDGE_TOOL_HH__
 
+#include <vector>
+
 #include "tool.hh"
 
 class Smudge_tool : public Tool {
 public:
   Smudge_tool(Toolbox *toolbox);
   virtual ~Smudge_tool(void);
-  virtual void clear(void);
+  virtual const char *name(void) const;
   virtual void start_recording_path(GdkInputSource source,
                                     gdouble x, gdouble y, gdouble pressure,
                                     gdouble xtilt, gdouble ytilt);
@@ -26,11 +28,8 @@ public:
 private:
   typedef Tool Base;
   
-  static GLboolean _setup_texture_cb(void *data, GLboolean test_proxy);
-  static GLboolean _display_list_cb(void *data, GLboolean test_proxy);
-  
   GLfloat _rate;
-  GLtexture *_texture;
+  std::vector<GLubyte> _pixels; // picked up at the previous event
 };
 
 #endif // __SMUDGE_TOOL_HH__
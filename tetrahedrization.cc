@@ -1,4 +1,8 @@
+#include <algorithm>
+
 #include "application.hh"
+#include "binary_file.hh"
+#include "journal.hh"
 #include "tetrahedrization.hh"
 
 using namespace std;
@@ -10,13 +14,71 @@ const unsigned int NEAREST_NEIGHBOR_RANK = 5;
 // the mean number of neighbors in a 3D triangulation is between 12 and 18
 // in our experiments, we observed values around 14.5
 // thus, to keep the same ratio as in 2D, we should choose 4.83.. ~ 5
+static const int MORTON_BITS = 10;
+// Rationale:
+// 3 x 10 bits fit in an unsigned int, and 1024 cells per axis are enough
+// to keep consecutive points in neighboring cells
+static const double REBUILD_FRACTION = 0.25;
+// Rationale:
+// removing a vertex retriangulates its whole star, which costs several
+// insertions located from the previous point, so that the remaining points
+// are inserted again instead once a fair fraction of them goes
+static const guint64 CELL_FLAG_BITS = 9;
+// Rationale:
+// the outside flag, then 4 convection and 4 surface facet flags
+
+static unsigned int
+morton_code(unsigned int x, unsigned int y, unsigned int z) {
+  unsigned int code = 0;
+  for (int b = MORTON_BITS - 1; b >= 0; b--) {
+    code = (code << 3)
+         | (((x >> b) & 1) << 2) | (((y >> b) & 1) << 1) | ((z >> b) & 1);
+  }
+  return code;
+}
+
+static void
+z_order(const vector<Tetrahedrization::Point>& points,
+        vector<unsigned int>& order) {
+  if (points.empty()) return;
+  CGAL::Bbox_3 bbox = points[0].bbox();
+  for (vector<Tetrahedrization::Point>::const_iterator pi = points.begin();
+       pi != points.end(); pi++) {
+    bbox = bbox + pi->bbox();
+  }
+  const double scale[3] = {
+    (bbox.xmax() > bbox.xmin()) ?
+      ((1 << MORTON_BITS) - 1) / (bbox.xmax() - bbox.xmin()) : 0.0,
+    (bbox.ymax() > bbox.ymin()) ?
+      ((1 << MORTON_BITS) - 1) / (bbox.ymax() - bbox.ymin()) : 0.0,
+    (bbox.zmax() > bbox.zmin()) ?
+      ((1 << MORTON_BITS) - 1) / (bbox.zmax() - bbox.zmin()) : 0.0
+  };
+  vector< pair<unsigned int, unsigned int> > codes(points.size());
+  for (unsigned int i = 0; i < points.size(); i++) {
+    codes[i].first
+      = morton_code((unsigned int) ((points[i].x() - bbox.xmin()) * scale[0]),
+                    (unsigned int) ((points[i].y() - bbox.ymin()) * scale[1]),
+                    (unsigned int) ((points[i].z() - bbox.zmin()) * scale[2]));
+    codes[i].second = i;
+  }
+  sort(codes.begin(), codes.end());
+  order.resize(codes.size());
+  for (unsigned int i = 0; i < codes.size(); i++) {
+    order[i] = codes[i].second;
+  }
+}
 
 Tetrahedrization::Tetrahedrization(Application *application)
   : Base(),
     _application(application),
+    _journal(NULL),
     _bbox(BBOX_NULL),
     _old_points(),
-    _new_vertices() {}
+    _new_vertices(),
+    _vertices_by_id(),
+    _free_vertex_ids(),
+    _granularities() {}
 
 Tetrahedrization::~Tetrahedrization(void) {}
 
@@ -28,7 +90,23 @@ Tetrahedrization::bbox(void) const {
 void
 Tetrahedrization::clear(void) {
   _bbox = BBOX_NULL;
+  _vertices_by_id.clear();
+  _free_vertex_ids.clear();
+  _granularities.clear();
   Base::clear();
+  if (_journal != NULL) {
+    _journal->append(Journal::TETRAHEDRIZATION_CLEAR);
+  }
+}
+
+void
+Tetrahedrization::set_journal(Journal *journal) {
+  _journal = journal;
+}
+
+Journal *
+Tetrahedrization::journal(void) const {
+  return _journal;
 }
 
 int
@@ -89,6 +167,228 @@ Tetrahedrization::number_of_inside_cells(void) const {
   return n;
 }
 
+void
+Tetrahedrization::reset_flags(void) {
+  if (!Cell::reset_all()) {
+    for (All_cells_iterator ci = all_cells_begin();
+         ci != all_cells_end(); ci++) {
+      ci->reset();
+    }
+  }
+}
+
+unsigned int
+Tetrahedrization::number_of_vertex_ids(void) const {
+  return _vertices_by_id.size();
+}
+
+Tetrahedrization::Vertex_handle
+Tetrahedrization::vertex_with_id(unsigned int id) const {
+  assert(id < _vertices_by_id.size());
+  assert(_vertices_by_id[id] != Vertex_handle(NULL));
+  return _vertices_by_id[id];
+}
+
+void
+Tetrahedrization::renumber_vertices(void) {
+  // needed when vertices were created behind our back (e.g. operator>>)
+  vector<FT> granularities;
+  granularities.reserve(number_of_vertices());
+  _vertices_by_id.clear();
+  _free_vertex_ids.clear();
+  _vertices_by_id.reserve(number_of_vertices());
+  for (Finite_vertices_iterator vi = finite_vertices_begin();
+       vi != finite_vertices_end(); vi++) {
+    unsigned int id = vi->id();
+    granularities.push_back(id < _granularities.size() ?
+                            _granularities[id] : 0);
+    vi->id() = _vertices_by_id.size();
+    _vertices_by_id.push_back(vi);
+  }
+  _granularities.swap(granularities);
+}
+
+Tetrahedrization::FT
+Tetrahedrization::granularity(Vertex_handle v) const {
+  assert(v->id() < _granularities.size());
+  return _granularities[v->id()];
+}
+
+Tetrahedrization::FT&
+Tetrahedrization::granularity(Vertex_handle v) {
+  assert(v->id() < _granularities.size());
+  return _granularities[v->id()];
+}
+
+unsigned long
+Tetrahedrization::number_of_bytes(void) const {
+  return (number_of_vertices() + 1) * sizeof(Vertex)
+    + tds().number_of_cells() * sizeof(Cell)
+    + _vertices_by_id.capacity() * sizeof(Vertex_handle)
+    + _free_vertex_ids.capacity() * sizeof(unsigned int)
+    + _granularities.capacity() * sizeof(FT);
+}
+
+void
+Tetrahedrization::write(Binary_file& file) const {
+  // vertex index 0 stands for the infinite vertex
+  vector<guint32> vertex_indices(number_of_vertex_ids(),
+                                 Binary_file::NULL_INDEX);
+  vector<FT> points, granularities;
+  points.reserve(3 * number_of_vertices());
+  granularities.reserve(number_of_vertices());
+  guint32 n = 1;
+  for (Finite_vertices_iterator vi = finite_vertices_begin();
+       vi != finite_vertices_end(); vi++, n++) {
+    assert(vi->id() < vertex_indices.size());
+    vertex_indices[vi->id()] = n;
+    points.push_back(vi->point().x());
+    points.push_back(vi->point().y());
+    points.push_back(vi->point().z());
+    granularities.push_back(granularity(vi));
+  }
+  
+  // cells are numbered in address order, so that neighbors are found by
+  // binary search
+  vector<const Cell *> cells;
+  if (dimension() == 3) {
+    for (All_cells_iterator ci = all_cells_begin();
+         ci != all_cells_end(); ci++) {
+      cells.push_back(&*ci);
+    }
+    sort(cells.begin(), cells.end());
+  }
+  vector<guint32> cell_vertices, cell_neighbors;
+  vector<guint8> flags;
+  cell_vertices.reserve(4 * cells.size());
+  cell_neighbors.reserve(4 * cells.size());
+  flags.reserve((CELL_FLAG_BITS * cells.size() + 7) / 8);
+  for (unsigned int c = 0; c < cells.size(); c++) {
+    const Cell *cell = cells[c];
+    guint64 bit = CELL_FLAG_BITS * (guint64) c;
+    Binary_file::set_bit(flags, bit, cell->is_outside());
+    for (int i = 0; i < 4; i++) {
+      Vertex_handle vh(cell->vertex(i));
+      cell_vertices.push_back(is_infinite(vh) ? 0 : vertex_indices[vh->id()]);
+      const Cell *neighbor = &*(cell->neighbor(i));
+      cell_neighbors.push_back(
+        lower_bound(cells.begin(), cells.end(), neighbor) - cells.begin());
+      Binary_file::set_bit(flags, bit + 1 + i, cell->is_convection_facet(i));
+      Binary_file::set_bit(flags, bit + 5 + i, cell->is_surface_facet(i));
+    }
+  }
+  
+  vector<guint32> header(3);
+  header[0] = dimension();
+  header[1] = number_of_vertices();
+  header[2] = cells.size();
+  file.set_section(Binary_file::TETRAHEDRIZATION, header);
+  file.set_section(Binary_file::TETRAHEDRIZATION_POINTS, points);
+  file.set_section(Binary_file::TETRAHEDRIZATION_GRANULARITIES,
+                   granularities);
+  file.set_section(Binary_file::TETRAHEDRIZATION_CELLS, cell_vertices);
+  file.set_section(Binary_file::TETRAHEDRIZATION_NEIGHBORS, cell_neighbors);
+  file.set_section(Binary_file::TETRAHEDRIZATION_FLAGS, flags);
+}
+
+bool
+Tetrahedrization::read(const Binary_file& file) {
+  guint64 size = 0;
+  const guint32 *header
+    = file.section<guint32>(Binary_file::TETRAHEDRIZATION, size);
+  if (header == NULL || size != 3) {
+    cerr << "Error: missing tetrahedrization section!" << endl;
+    return false;
+  }
+  int dim = (gint32) header[0];
+  guint64 n = header[1], m = header[2];
+  
+  const FT *points
+    = file.section<FT>(Binary_file::TETRAHEDRIZATION_POINTS, size);
+  bool is_valid = (points != NULL && size == 3 * n);
+  const FT *granularities
+    = file.section<FT>(Binary_file::TETRAHEDRIZATION_GRANULARITIES, size);
+  is_valid = is_valid && (granularities != NULL && size == n);
+  const guint32 *cell_vertices
+    = file.section<guint32>(Binary_file::TETRAHEDRIZATION_CELLS, size);
+  is_valid = is_valid && (cell_vertices != NULL && size == 4 * m);
+  const guint32 *cell_neighbors
+    = file.section<guint32>(Binary_file::TETRAHEDRIZATION_NEIGHBORS, size);
+  is_valid = is_valid && (cell_neighbors != NULL && size == 4 * m);
+  const guint8 *flags
+    = file.section<guint8>(Binary_file::TETRAHEDRIZATION_FLAGS, size);
+  is_valid = is_valid && (flags != NULL
+                          && size == (CELL_FLAG_BITS * m + 7) / 8);
+  is_valid = is_valid && (dim <= 3 && (dim == 3) == (m > 0));
+  
+  // incidences are checked beforehand, since the TDS does not
+  for (guint64 k = 0; k < 4 * m && is_valid; k++) {
+    guint64 c = cell_neighbors[k];
+    is_valid = (cell_vertices[k] <= n && c < m &&
+                (cell_neighbors[4 * c    ] == k / 4 ||
+                 cell_neighbors[4 * c + 1] == k / 4 ||
+                 cell_neighbors[4 * c + 2] == k / 4 ||
+                 cell_neighbors[4 * c + 3] == k / 4));
+  }
+  if (!is_valid) {
+    cerr << "Error: corrupted tetrahedrization sections!" << endl;
+    return false;
+  }
+  
+  clear();
+  if (dim < 3) {
+    // lower dimensional TDS are laid out differently, and are rebuilt
+    // by insertion instead
+    for (guint64 i = 0; i < n; i++) {
+      Point p(points[3 * i], points[3 * i + 1], points[3 * i + 2]);
+      Vertex_handle vh(i == 0 ? insert_first(p) : insert(p));
+      granularity(vh) = granularities[i];
+    }
+    return true;
+  }
+  
+  // only the lowest level of the hierarchy is rebuilt, as with operator>>
+  Triangulation_data_structure& tds = this->tds();
+  Vertex_handle infinite = infinite_vertex();
+  if (infinite->cell() != Cell_handle(NULL)) {
+    tds.delete_cell(infinite->cell());
+  }
+  vector<Vertex_handle> vertices;
+  vertices.reserve(n + 1);
+  vertices.push_back(infinite);
+  _vertices_by_id.reserve(n);
+  _granularities.reserve(n);
+  for (guint64 i = 0; i < n; i++) {
+    Point p(points[3 * i], points[3 * i + 1], points[3 * i + 2]);
+    _bbox = (i == 0) ? p.bbox() : _bbox + p.bbox();
+    Vertex_handle vh(tds.create_vertex());
+    vh->set_point(p);
+    _set_id(vh);
+    granularity(vh) = granularities[i];
+    vertices.push_back(vh);
+  }
+  vector<Cell_handle> cells;
+  cells.reserve(m);
+  for (guint64 c = 0; c < m; c++) {
+    cells.push_back(tds.create_cell());
+  }
+  for (guint64 c = 0; c < m; c++) {
+    Cell_handle ch(cells[c]);
+    guint64 bit = CELL_FLAG_BITS * c;
+    ch->is_outside() = Binary_file::bit(flags, bit);
+    for (int i = 0; i < 4; i++) {
+      Vertex_handle vh(vertices[cell_vertices[4 * c + i]]);
+      ch->set_vertex(i, vh);
+      ch->set_neighbor(i, cells[cell_neighbors[4 * c + i]]);
+      vh->set_cell(ch);
+      ch->is_convection_facet(i) = Binary_file::bit(flags, bit + 1 + i);
+      ch->is_surface_facet(i) = Binary_file::bit(flags, bit + 5 + i);
+    }
+  }
+  tds.set_dimension(3);
+  return true;
+}
+
 template <typename Output_iterator>
 Output_iterator
 Tetrahedrization::incident_surface_vertices(Vertex_handle v,
@@ -294,11 +594,29 @@ Tetrahedrization::insert_first(const Point& p, Cell_handle start) {
 Tetrahedrization::Vertex_handle
 Tetrahedrization::insert(const Point& p, Cell_handle start) {
   _bbox = _bbox + p.bbox();
-  Vertex_handle vh(Base::insert(p, start));
+  Vertex_handle vh(_insert(p, start));
   _new_vertices.push_back(vh);
   return vh;
 }
 
+int
+Tetrahedrization::insert_first(vector<Point>& points) {
+  /*
+   * Points are sorted along a Z-order curve over their bounding box, and
+   * each one is located starting from the cell of the previous one: point
+   * location then walks a few cells instead of crossing the triangulation.
+   */
+  if (points.empty()) return 0;
+  
+  vector<unsigned int> order;
+  z_order(points, order);
+  Vertex_handle vh = insert_first(points[order[0]]);
+  for (unsigned int i = 1; i < order.size(); i++) {
+    vh = insert(points[order[i]], vh->cell());
+  }
+  return number_of_vertices();
+}
+
 Tetrahedrization::Vertex_handle
 Tetrahedrization::move_first(Vertex_handle v, const Point& p) {
   assert(number_of_vertices() != 0);
@@ -318,13 +636,13 @@ Tetrahedrization::Vertex_handle
 Tetrahedrization::move_multipass_first(Vertex_handle v, const Point& p) {
   assert(number_of_vertices() != 0);
   _new_vertices.clear();
-  Base::remove(v);
+  _remove(v);
   return insert(p);
 }
 
 Tetrahedrization::Vertex_handle
 Tetrahedrization::move_multipass(Vertex_handle v, const Point& p) {
-  Base::remove(v);
+  _remove(v);
   return insert(p);
 }
 
@@ -340,19 +658,77 @@ void
 Tetrahedrization::remove(Vertex_handle v) {
   //CAVEAT: the bbox is not updated!
   _old_points.push_back(v->point());
-  Base::remove(v);
+  _remove(v);
+}
+
+bool
+Tetrahedrization::remove_first(const vector<Vertex_handle>& vertices) {
+  _old_points.clear();
+  _new_vertices.clear();
+  return remove(vertices);
+}
+
+bool
+Tetrahedrization::remove(const vector<Vertex_handle>& vertices) {
+  /*
+   * Removing a vertex next to the hole left by another one retriangulates
+   * a larger hole, whose cost grows faster than its size. The vertices are
+   * thus removed in rounds, skipping those adjacent to a vertex removed in
+   * the current round. The holes of a round do not touch each other, since
+   * they are only filled with the vertices of their boundaries.
+   */
+  //CAVEAT: the bbox is not updated!
+  if (vertices.size() > REBUILD_FRACTION * number_of_vertices()) {
+    _rebuild_without(vertices);
+    return true;
+  }
+  vector<bool> is_reached(number_of_vertex_ids(), false);
+  vector<unsigned int> reached_ids;
+  vector<Vertex_handle> pending_vertices(vertices), deferred_vertices;
+  vector<Vertex_handle> neighbors;
+  while (!pending_vertices.empty()) {
+    for (vector<Vertex_handle>::const_iterator
+           vhi = pending_vertices.begin();
+         vhi != pending_vertices.end(); vhi++) {
+      Vertex_handle vh(*vhi);
+      if (is_reached[vh->id()]) {
+        deferred_vertices.push_back(vh);
+        continue;
+      }
+      if (dimension() == 3) {
+        incident_vertices(vh, back_inserter(neighbors));
+        for (vector<Vertex_handle>::const_iterator nhi = neighbors.begin();
+             nhi != neighbors.end(); nhi++) {
+          if (!is_infinite(*nhi)) {
+            is_reached[(*nhi)->id()] = true;
+            reached_ids.push_back((*nhi)->id());
+          }
+        }
+        neighbors.clear();
+      }
+      remove(vh);
+    }
+    for (vector<unsigned int>::const_iterator ii = reached_ids.begin();
+         ii != reached_ids.end(); ii++) {
+      is_reached[*ii] = false;
+    }
+    reached_ids.clear();
+    pending_vertices.swap(deferred_vertices);
+    deferred_vertices.clear();
+  }
+  return false;
 }
 
 void
 Tetrahedrization::undo_last_changes(void) {
   for (vector<Vertex_handle>::const_iterator vhi = _new_vertices.begin();
        vhi != _new_vertices.end(); vhi++) {
-    Base::remove(*vhi);
+    _remove(*vhi);
   }
   _new_vertices.clear();
   for (vector<Point>::const_iterator pi = _old_points.begin();
        pi != _old_points.end(); pi++) {
-    Base::insert(*pi);
+    _insert(*pi);
   }
   _old_points.clear();
 }
@@ -376,11 +752,11 @@ Tetrahedrization::set_granularity(Finite_vertices_iterator begin,
     }
     if (squared_distances.size() < NEAREST_NEIGHBOR_RANK) {
       assert(!squared_distances.empty());
-      vi->granularity() = *(squared_distances.rbegin());
+      granularity(vi) = *(squared_distances.rbegin());
     } else {
       multiset<FT>::const_iterator fti = squared_distances.begin();
       advance(fti, NEAREST_NEIGHBOR_RANK - 1);
-      vi->granularity() = *fti;
+      granularity(vi) = *fti;
     }
     squared_distances.clear();
     vertices.clear();
@@ -388,3 +764,102 @@ Tetrahedrization::set_granularity(Finite_vertices_iterator begin,
   }
   return n;
 }
+
+Tetrahedrization::Vertex_handle
+Tetrahedrization::_insert(const Point& p, Cell_handle start) {
+  // moves and undos go through here as well
+  if (_journal != NULL) {
+    _journal->append(Journal::TETRAHEDRIZATION_INSERT, p.x(), p.y(), p.z());
+  }
+  Vertex_handle vh(Base::insert(p, start));
+  // inserting an existing point returns the existing vertex
+  if (vh->id() == Vertex::NULL_ID) {
+    _set_id(vh);
+  }
+  return vh;
+}
+
+void
+Tetrahedrization::_set_id(Vertex_handle v) {
+  if (_free_vertex_ids.empty()) {
+    v->id() = _vertices_by_id.size();
+    _vertices_by_id.push_back(v);
+    _granularities.push_back(0);
+  } else {
+    v->id() = _free_vertex_ids.back();
+    _free_vertex_ids.pop_back();
+    _vertices_by_id[v->id()] = v;
+    _granularities[v->id()] = 0;
+  }
+}
+
+void
+Tetrahedrization::_remove(Vertex_handle v) {
+  unsigned int id = v->id();
+  if (id != Vertex::NULL_ID) {
+    assert(id < _vertices_by_id.size() && _vertices_by_id[id] == v);
+    _vertices_by_id[id] = Vertex_handle(NULL);
+    _free_vertex_ids.push_back(id);
+  }
+  if (_journal != NULL) {
+    _journal->append(Journal::TETRAHEDRIZATION_REMOVE,
+                     v->point().x(), v->point().y(), v->point().z());
+  }
+  Base::remove(v);
+}
+
+void
+Tetrahedrization::_rebuild_without(const vector<Vertex_handle>& vertices) {
+  // removals are recorded one by one, for undos and the journal
+  vector<bool> is_removed(number_of_vertex_ids(), false);
+  for (vector<Vertex_handle>::const_iterator vhi = vertices.begin();
+       vhi != vertices.end(); vhi++) {
+    Vertex_handle vh(*vhi);
+    unsigned int id = vh->id();
+    assert(id < _vertices_by_id.size() && _vertices_by_id[id] == vh);
+    is_removed[id] = true;
+    _vertices_by_id[id] = Vertex_handle(NULL);
+    _free_vertex_ids.push_back(id);
+    _old_points.push_back(vh->point());
+    if (_journal != NULL) {
+      _journal->append(Journal::TETRAHEDRIZATION_REMOVE,
+                       vh->point().x(), vh->point().y(), vh->point().z());
+    }
+  }
+  vector<Point> points;
+  vector<unsigned int> ids;
+  points.reserve(number_of_vertices() - vertices.size());
+  ids.reserve(number_of_vertices() - vertices.size());
+  for (Finite_vertices_iterator vi = finite_vertices_begin();
+       vi != finite_vertices_end(); vi++) {
+    if (!is_removed[vi->id()]) {
+      points.push_back(vi->point());
+      ids.push_back(vi->id());
+    }
+  }
+  vector<unsigned int> new_vertex_ids;
+  for (vector<Vertex_handle>::const_iterator vhi = _new_vertices.begin();
+       vhi != _new_vertices.end(); vhi++) {
+    unsigned int id = (*vhi)->id();
+    if (id < _vertices_by_id.size() && _vertices_by_id[id] == *vhi) {
+      new_vertex_ids.push_back(id);
+    }
+  }
+  
+  // the remaining vertices keep their IDs, and thus their granularities
+  Base::clear();
+  vector<unsigned int> order;
+  z_order(points, order);
+  Vertex_handle vh;
+  for (unsigned int i = 0; i < order.size(); i++) {
+    vh = Base::insert(points[order[i]],
+                      (i == 0) ? Cell_handle(NULL) : vh->cell());
+    vh->id() = ids[order[i]];
+    _vertices_by_id[vh->id()] = vh;
+  }
+  _new_vertices.clear();
+  for (vector<unsigned int>::const_iterator ii = new_vertex_ids.begin();
+       ii != new_vertex_ids.end(); ii++) {
+    _new_vertices.push_back(_vertices_by_id[*ii]);
+  }
+}
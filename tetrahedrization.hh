@@ -4,6 +4,8 @@
 #include "tetrahedrization_base.hh"
 
 class Application;
+class Binary_file;
+class Journal;
 
 class Tetrahedrization : public Tetrahedrization_base {
 public:
@@ -11,9 +13,30 @@ public:
   ~Tetrahedrization(void);
   const CGAL::Bbox_3& bbox(void) const;
   void clear(void);
+  // edits are appended to the journal, if any
+  void set_journal(Journal *journal);
+  Journal *journal(void) const;
   int number_of_surface_vertices(void) const;
   int number_of_surface_facets(void) const;
   int number_of_inside_cells(void) const;
+  // clears the classification flags of all cells, in constant time but for
+  // every instance at once
+  void reset_flags(void);
+  // vertex IDs are in [0, number_of_vertex_ids()), with holes
+  unsigned int number_of_vertex_ids(void) const;
+  Vertex_handle vertex_with_id(unsigned int id) const;
+  void renumber_vertices(void);
+  // granularities are kept aside, indexed by vertex ID: the ID alone fits
+  // in the padding between the float point and the hierarchy pointers, so
+  // that the vertices of every level of the hierarchy lose a word
+  Geom_traits::FT granularity(Vertex_handle v) const;
+  Geom_traits::FT& granularity(Vertex_handle v);
+  // bytes taken by the vertices and cells of the lowest level of the
+  // hierarchy and by the per vertex data, allocator overhead excepted
+  unsigned long number_of_bytes(void) const;
+  // the TDS is written as is, and read back without insertion
+  void write(Binary_file& file) const;
+  bool read(const Binary_file& file);
   template <typename Output_iterator>
   Output_iterator incident_surface_vertices(Vertex_handle v,
                                             Output_iterator vertices) const;
@@ -27,12 +50,18 @@ public:
   Vertex_handle insert_first(const Point& p,
                              Cell_handle start = Cell_handle(NULL));
   Vertex_handle insert(const Point& p, Cell_handle start = Cell_handle(NULL));
+  // bulk insertion, reordering points along a space-filling curve
+  int insert_first(std::vector<Point>& points);
   Vertex_handle move_first(Vertex_handle v, const Point& p);
   Vertex_handle move(Vertex_handle v, const Point& p);
   Vertex_handle move_multipass_first(Vertex_handle v, const Point& p);
   Vertex_handle move_multipass(Vertex_handle v, const Point& p);
   void remove_first(Vertex_handle v);
   void remove(Vertex_handle v);
+  // batch removal, returns true when the tetrahedrization was rebuilt from
+  // the remaining points, which invalidates all handles but keeps IDs
+  bool remove_first(const std::vector<Vertex_handle>& vertices);
+  bool remove(const std::vector<Vertex_handle>& vertices);
   void undo_last_changes(void);
   int set_granularity(Finite_vertices_iterator begin,
                       Finite_vertices_iterator end);
@@ -42,10 +71,19 @@ private:
   typedef Geom_traits::Kernel::Vector_3 Vector;
   typedef Geom_traits::FT FT;
   
+  Vertex_handle _insert(const Point& p, Cell_handle start = Cell_handle(NULL));
+  void _remove(Vertex_handle v);
+  void _set_id(Vertex_handle v);
+  void _rebuild_without(const std::vector<Vertex_handle>& vertices);
+  
   Application *_application;
+  Journal *_journal;
   CGAL::Bbox_3 _bbox;
   std::vector<Point> _old_points;
   std::vector<Vertex_handle> _new_vertices;
+  std::vector<Vertex_handle> _vertices_by_id;
+  std::vector<unsigned int> _free_vertex_ids;
+  std::vector<FT> _granularities; // by vertex ID
 };
 
 #endif // __TETRAHEDRIZATION_HH__
@@ -2,6 +2,7 @@
 #define __TETRAHEDRIZATION_BASE_HH__
 
 #include "cgal_utils.hh"
+#include "epoch_flags.hh"
 
 template < typename K,
            typename V = CGAL::Triangulation_vertex_base_3<K> >
@@ -10,8 +11,6 @@ private:
   typedef V Base;
   
 public:
-  typedef typename K::FT            FT;
-  
   typedef typename V::Point         Point;
   typedef typename V::Vertex_handle Vertex_handle;
   typedef typename V::Cell_handle   Cell_handle;
@@ -22,23 +21,26 @@ public:
     typedef Tetrahedrization_vertex<K, V2>               Other;
   };
   
+  static const unsigned int NULL_ID = ~0u;
+  
   Tetrahedrization_vertex(void)
     : Base(),
-      _granularity(0) {}
+      _id(NULL_ID) {}
   Tetrahedrization_vertex(const Point& p)
     : Base(p),
-      _granularity(0) {}
+      _id(NULL_ID) {}
   Tetrahedrization_vertex(Cell_handle c)
     : Base(c),
-      _granularity(0) {}
+      _id(NULL_ID) {}
   Tetrahedrization_vertex(const Point& p, Cell_handle c)
     : Base(p, c),
-      _granularity(0) {}
-  FT granularity(void) const { return _granularity; }
-  FT& granularity(void) { return _granularity; }
+      _id(NULL_ID) {}
+  // stable item buffer ID (see Tetrahedrization::vertex_with_id)
+  unsigned int id(void) const { return _id; }
+  unsigned int& id(void) { return _id; }
   
 private:
-  FT _granularity;
+  unsigned int _id;
 };
 
 template < typename K,
@@ -51,6 +53,9 @@ public:
   typedef typename C::Vertex_handle Vertex_handle;
   typedef typename C::Cell_handle   Cell_handle;
   
+  typedef Epoch_flags<9>            Flags;
+  typedef typename Flags::Reference Flag;
+  
   template <typename TDS2>
   struct Rebind_TDS {
     typedef typename C::template Rebind_TDS<TDS2>::Other C2;
@@ -67,38 +72,42 @@ public:
                         Cell_handle   n0, Cell_handle   n1,
                         Cell_handle   n2, Cell_handle   n3)
     : Base(v0, v1, v2, v3, n0, n1, n2, n3) { reset(); }
-  bool is_outside(void) const { return _is_outside; }
+  bool is_outside(void) const { return _flags.test(_OUTSIDE, _epoch); }
   bool is_convection_facet(unsigned int i) const {
     assert(i < 4);
-    return _is_convection_facet[i];
+    return _flags.test(_CONVECTION_FACET + i, _epoch);
   }
   bool is_surface_facet(unsigned int i) const {
     assert(i < 4);
-    return _is_surface_facet[i];
+    return _flags.test(_SURFACE_FACET + i, _epoch);
   }
-  bool& is_outside(void) { return _is_outside; }
-  bool& is_convection_facet(unsigned int i) {
+  Flag is_outside(void) { return Flag(_flags, _OUTSIDE, _epoch); }
+  Flag is_convection_facet(unsigned int i) {
     assert(i < 4);
-    return _is_convection_facet[i];
+    return Flag(_flags, _CONVECTION_FACET + i, _epoch);
   }
-  bool& is_surface_facet(unsigned int i) {
+  Flag is_surface_facet(unsigned int i) {
     assert(i < 4);
-    return _is_surface_facet[i];
+    return Flag(_flags, _SURFACE_FACET + i, _epoch);
   }
-  void reset(void) {
-    _is_outside = false;
-    for (int i = 0; i < 4; i++) {
-      _is_convection_facet[i] = false;
-      _is_surface_facet[i] = false;
-    }
+  void reset(void) { _flags.clear(_epoch); }
+  // resets the flags of all cells, false when the epoch wrapped around and
+  // the cells have to be reset one by one
+  static bool reset_all(void) {
+    _epoch = (_epoch + 1) & Flags::EPOCH_MAX;
+    return (_epoch != 0);
   }
   
 private:
-  bool _is_outside;
-  bool _is_convection_facet[4];
-  bool _is_surface_facet[4];
+  enum { _OUTSIDE = 0, _CONVECTION_FACET = 1, _SURFACE_FACET = 5 };
+  
+  static unsigned int _epoch;
+  Flags _flags;
 };
 
+template <typename K, typename C>
+unsigned int Tetrahedrization_cell<K, C>::_epoch = 0;
+
 typedef Tetrahedrization_vertex<Kernel> Vb3;
 typedef CGAL::Triangulation_hierarchy_vertex_base_3<Vb3> Vbh3;
 typedef Tetrahedrization_cell<Kernel> Cb3;
@@ -1,7 +1,11 @@
+#include <algorithm>
 #include <glib.h>
+#include <gdk/gdkgl.h>
+#include <GL/glext.h>
 #include <opengl_widget.h>
 
 #include "images.h"
+#include "resources.hh"
 #include "tetrahedrization_display.hh"
 
 using namespace std;
@@ -10,17 +14,78 @@ static const GLfloat UNIT_NORMAL_DISPLAY_SCALE = 0.01f;
 static const GLfloat RASKAR_SIZE = 8.0f;
 static const GLfloat DEPTH_LINE_SIZE = 10.0f;
 
+// GL_ARB_vertex_buffer_object entry points, resolved at run time since
+// OpenGL 1.4 does not provide them
+static PFNGLGENBUFFERSARBPROC    gl_gen_buffers    = NULL;
+static PFNGLDELETEBUFFERSARBPROC gl_delete_buffers = NULL;
+static PFNGLBINDBUFFERARBPROC    gl_bind_buffer    = NULL;
+static PFNGLBUFFERDATAARBPROC    gl_buffer_data    = NULL;
+static PFNGLBUFFERSUBDATAARBPROC gl_buffer_sub_data = NULL;
+
+// bytes per facet slot, see _Array
+static const GLsizei SLOT_BYTE_SIZES[] = {
+  9*sizeof(GLfloat), 9*sizeof(GLfloat)
+};
+static const float BUFFER_GROWTH_RATIO = 1.5f;
+// Rationale:
+// strokes mostly add surface, so buffers are given some room to grow
+// before they have to be reallocated and uploaded again as a whole
+static const float HIERARCHY_REFIT_RATIO = 0.25f;
+// Rationale:
+// refitting keeps the tree topology, which degrades queries once a large
+// part of the surface has moved
+
+static bool
+has_vertex_buffer_objects(void) {
+  static bool is_first_query = true;
+  static bool has_extension = false;
+  
+  if (is_first_query) {
+    is_first_query = false;
+    if (gdk_gl_query_gl_extension("GL_ARB_vertex_buffer_object")) {
+      gl_gen_buffers = (PFNGLGENBUFFERSARBPROC)
+        gdk_gl_get_proc_address("glGenBuffersARB");
+      gl_delete_buffers = (PFNGLDELETEBUFFERSARBPROC)
+        gdk_gl_get_proc_address("glDeleteBuffersARB");
+      gl_bind_buffer = (PFNGLBINDBUFFERARBPROC)
+        gdk_gl_get_proc_address("glBindBufferARB");
+      gl_buffer_data = (PFNGLBUFFERDATAARBPROC)
+        gdk_gl_get_proc_address("glBufferDataARB");
+      gl_buffer_sub_data = (PFNGLBUFFERSUBDATAARBPROC)
+        gdk_gl_get_proc_address("glBufferSubDataARB");
+      has_extension = (gl_gen_buffers != NULL && gl_delete_buffers != NULL &&
+                       gl_bind_buffer != NULL && gl_buffer_data != NULL &&
+                       gl_buffer_sub_data != NULL);
+    }
+#if DEBUG
+    if (!has_extension) {
+      cerr << "Warning: no vertex buffer objects, "
+           << "using client vertex arrays!" << endl;
+    }
+#endif
+  }
+  return has_extension;
+}
+
 Tetrahedrization_display::Tetrahedrization_display(Tetrahedrization&
                                                      tetrahedrization)
   : _tetrahedrization(tetrahedrization),
     _style(),
+    _facet_vertices(),
+    _facet_normals(),
+    _facet_keys(),
+    _facet_slots(),
+    _dirty_facet_slots(),
+    _hierarchy(),
+    _facet_capacity(0),
+    _has_buffers(false),
+    _are_lists_outdated(false),
     _is_first_npr_gooch_display(true) {
   _style.push(SOLID);
   _gooch_image = gl_framebuf_new();
   _gooch_texture = gl_texture_new();
   _enable_lighting_list = gl_list_new();
   _disable_lighting_list = gl_list_new();
-  _facets_with_facet_normals_list = gl_list_new();
   _facet_normals_list = gl_list_new();
   _gooch_list = gl_list_new();
 #if DEBUG
@@ -28,14 +93,11 @@ Tetrahedrization_display::Tetrahedrization_display(Tetrahedrization&
   _vertex_normals_list = gl_list_new();
 #endif
   
-  gl_framebuf_sread(_gooch_image, "rgb/gooch.bw", GL_FILE_SGI);
+  Resources::read_image(_gooch_image, "rgb/gooch.bw");
   gl_list_set(_enable_lighting_list,
               _display_enable_lighting_list_cb, NULL, GL_FALSE);
   gl_list_set(_disable_lighting_list,
               _display_disable_lighting_list_cb, NULL, GL_FALSE);
-  gl_list_set(_facets_with_facet_normals_list,
-              _display_facets_with_facet_normals_list_cb, (void *) this,
-              GL_FALSE);
   gl_list_set(_facet_normals_list,
               _display_facet_normals_list_cb, (void *) this, GL_FALSE);
   gl_list_set(_gooch_list,
@@ -46,21 +108,9 @@ Tetrahedrization_display::Tetrahedrization_display(Tetrahedrization&
               GL_FALSE);
   gl_list_set(_vertex_normals_list,
               _display_vertex_normals_list_cb, (void *) this, GL_FALSE);
-  
-  _normals = CGAL::Unique_hash_map<Vertex_handle, Vector>(
-    CGAL::NULL_VECTOR, tetrahedrization.number_of_surface_vertices());
-  for (Finite_vertices_iterator vi = _tetrahedrization.finite_vertices_begin();
-       vi != _tetrahedrization.finite_vertices_end(); vi++) {
-    _normals[vi] = _tetrahedrization.approximate_normal(vi);
-  }
 #endif
   
-  CGAL::Bbox_3 bbox = tetrahedrization.bbox();
-  GLvecf min, max, diag;
-  gl_vecf_set(min, bbox.xmin(), bbox.ymin(), bbox.zmin(), 1.0f);
-  gl_vecf_set(max, bbox.xmax(), bbox.ymax(), bbox.zmax(), 1.0f);
-  _size = gl_vecf_norm(gl_vecf_sub(diag, min, max));
-  _normal_display_scale = UNIT_NORMAL_DISPLAY_SCALE * _size;
+  update();
 }
 
 Tetrahedrization_display::~Tetrahedrization_display(void) {
@@ -68,13 +118,15 @@ Tetrahedrization_display::~Tetrahedrization_display(void) {
   gl_texture_delete(_gooch_texture);
   gl_list_delete(_enable_lighting_list);
   gl_list_delete(_disable_lighting_list);
-  gl_list_delete(_facets_with_facet_normals_list);
   gl_list_delete(_facet_normals_list);
   gl_list_delete(_gooch_list);
 #if DEBUG
   gl_list_delete(_facets_with_vertex_normals_list);
   gl_list_delete(_vertex_normals_list);
 #endif
+  if (_has_buffers) {
+    gl_delete_buffers(_NUMBER_OF_ARRAYS, _buffers);
+  }
 }
 
 void
@@ -93,9 +145,82 @@ Tetrahedrization_display::size(void) const {
   return _size;
 }
 
+Tetrahedrization::Facet
+Tetrahedrization_display::surface_facet_with_id(unsigned int id) const {
+  assert(id < _facet_keys.size());
+  const _Facet_key& key = _facet_keys[id];
+  Cell_handle ch;
+  int i, j, k;
+  bool is_facet
+    = _tetrahedrization.is_facet(_tetrahedrization.vertex_with_id(key.first),
+                                 _tetrahedrization.vertex_with_id(key.second),
+                                 _tetrahedrization.vertex_with_id(key.third),
+                                 ch, i, j, k);
+  assert(is_facet);
+  // both sides of a facet share its vertices: pick the one with our winding
+  Facet f(ch, 6 - i - j - k);
+  Vertex_handle vh[3];
+  if (!f.first->is_surface_facet(f.second) ||
+      !(_oriented_facet(f, vh) == key)) {
+    f = Facet(f.first->neighbor(f.second),
+              f.first->mirror_index(f.second));
+  }
+  assert(f.first->is_surface_facet(f.second));
+  return f;
+}
+
+const Bounding_volume_hierarchy&
+Tetrahedrization_display::bounding_volume_hierarchy(void) const {
+  return _hierarchy;
+}
+
+void
+Tetrahedrization_display::update(void) {
+  /*
+   * Called after each reconstruction instead of building a new display:
+   * the surface is compared with the retained one, and only the slots that
+   * changed are marked for upload. This may happen outside of any OpenGL
+   * context, hence the upload itself is deferred to the next display.
+   */
+  const int number_of_dirty_facet_slots = _dirty_facet_slots.size();
+  const int number_of_facets = _facet_keys.size();
+  _update_facets();
+  if ((int) _facet_keys.size() == number_of_facets) {
+    _update_hierarchy(_dirty_facet_slots.size()
+                        - number_of_dirty_facet_slots);
+  } else {
+    _update_hierarchy(-1);
+  }
+#if DEBUG
+  _normals = CGAL::Unique_hash_map<Vertex_handle, Vector>(
+    CGAL::NULL_VECTOR, _tetrahedrization.number_of_surface_vertices());
+  for (Finite_vertices_iterator vi = _tetrahedrization.finite_vertices_begin();
+       vi != _tetrahedrization.finite_vertices_end(); vi++) {
+    _normals[vi] = _tetrahedrization.approximate_normal(vi);
+  }
+#endif
+  _are_lists_outdated = true;
+  
+  CGAL::Bbox_3 bbox = _tetrahedrization.bbox();
+  GLvecf min, max, diag;
+  gl_vecf_set(min, bbox.xmin(), bbox.ymin(), bbox.zmin(), 1.0f);
+  gl_vecf_set(max, bbox.xmax(), bbox.ymax(), bbox.zmax(), 1.0f);
+  _size = gl_vecf_norm(gl_vecf_sub(diag, min, max));
+  _normal_display_scale = UNIT_NORMAL_DISPLAY_SCALE * _size;
+}
+
 void
 Tetrahedrization_display::display(void) {
   if (_tetrahedrization.number_of_vertices() == 0) return;
+  _upload_arrays();
+  if (_are_lists_outdated) {
+    _are_lists_outdated = false;
+    gl_list_clear(_facet_normals_list);
+#if DEBUG
+    gl_list_clear(_facets_with_vertex_normals_list);
+    gl_list_clear(_vertex_normals_list);
+#endif
+  }
   
   switch (_style.top()) {
   case POINTS: {
@@ -103,7 +228,7 @@ Tetrahedrization_display::display(void) {
     
     glEnable(GL_DEPTH_TEST);
     glPolygonMode(GL_FRONT_AND_BACK, GL_POINT);
-    gl_list_call(_facets_with_facet_normals_list);
+    _draw_facets(false);
     
     glPopAttrib();
   } break;
@@ -112,7 +237,7 @@ Tetrahedrization_display::display(void) {
     
     glEnable(GL_DEPTH_TEST);
     glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-    gl_list_call(_facets_with_facet_normals_list);
+    _draw_facets(false);
     
     glPopAttrib();
   } break;
@@ -122,7 +247,7 @@ Tetrahedrization_display::display(void) {
     glEnable(GL_CULL_FACE);
     glEnable(GL_DEPTH_TEST);
     gl_list_call(_enable_lighting_list);
-    gl_list_call(_facets_with_facet_normals_list);
+    _draw_facets(true);
     
     glPopAttrib();
   } break;
@@ -135,12 +260,12 @@ Tetrahedrization_display::display(void) {
     glEnable(GL_POLYGON_OFFSET_FILL);
     glPolygonOffset(1.0, 1.0);
     gl_list_call(_enable_lighting_list);
-    gl_list_call(_facets_with_facet_normals_list);
+    _draw_facets(true);
     gl_list_call(_disable_lighting_list);
     
     glDisable(GL_POLYGON_OFFSET_FILL);
     glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-    gl_list_call(_facets_with_facet_normals_list);
+    _draw_facets(false);
     
     glColor4fv(GL_PURE_RED);
     gl_list_call(_facet_normals_list);
@@ -187,7 +312,7 @@ Tetrahedrization_display::display(void) {
     glEnable(GL_CULL_FACE);
     glEnable(GL_DEPTH_TEST);
     gl_list_call(_gooch_list);
-    gl_list_call(_facets_with_facet_normals_list);
+    _draw_facets(true);
     
     glPopAttrib();
   } break;
@@ -207,7 +332,7 @@ Tetrahedrization_display::display(void) {
     glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
     glEnable(GL_CULL_FACE);
     glEnable(GL_DEPTH_TEST);
-    gl_list_call(_facets_with_facet_normals_list);
+    _draw_facets(false);
     
     // Raskar 2nd pass */
     glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
@@ -215,12 +340,12 @@ Tetrahedrization_display::display(void) {
     glCullFace(GL_FRONT);
     glPolygonMode(GL_BACK, GL_LINE);
     glLineWidth(RASKAR_SIZE);
-    gl_list_call(_facets_with_facet_normals_list);
+    _draw_facets(false);
     
     // Rademacher 3rd pass
     glPolygonMode(GL_BACK, GL_POINT);
     glPointSize(0.5f*RASKAR_SIZE);
-    gl_list_call(_facets_with_facet_normals_list);
+    _draw_facets(false);
     
     glPopAttrib();
   } break;
@@ -235,48 +360,7 @@ Tetrahedrization_display::display(void) {
     glEnable(GL_CULL_FACE);
     glEnable(GL_STENCIL_TEST);
     glEnable(GL_DEPTH_TEST);
-    gl_list_call(_facets_with_facet_normals_list);
-    
-    glPopAttrib();
-  } break;
-  case ITEM_BUFFER_POINTS: {
-    guint32 index = 0u;
-    GLubyte *pindex = (GLubyte *) &index;
-    
-    glPushAttrib(GL_CURRENT_BIT);
-    
-    glBegin(GL_POINTS);
-    for (Finite_vertices_iterator vi
-           = _tetrahedrization.finite_vertices_begin();
-         vi != _tetrahedrization.finite_vertices_end(); vi++) {
-      glColor4ubv(pindex);
-      glPoint3(vi->point());
-      index++;
-    }
-    glEnd();
-    
-    glPopAttrib();
-  } break;
-  case ITEM_BUFFER_TRIANGLES: {
-    guint32 index = 0u;
-    GLubyte *pindex = (GLubyte *) &index;
-    
-    glPushAttrib(GL_ENABLE_BIT | GL_CURRENT_BIT);
-    
-    glEnable(GL_CULL_FACE);
-    glEnable(GL_DEPTH_TEST);
-    glBegin(GL_TRIANGLES);
-    for (All_cells_iterator ci = _tetrahedrization.all_cells_begin();
-         ci != _tetrahedrization.all_cells_end(); ci++) {
-      for (int i = 0; i < 4; i++) {
-        if (ci->is_surface_facet(i)) {
-          glColor4ubv(pindex);
-          glTriangle3(_tetrahedrization.triangle(ci, i));
-          index++;
-        }
-      }
-    }
-    glEnd();
+    _draw_facets(false);
     
     glPopAttrib();
   } break;
@@ -365,29 +449,6 @@ Tetrahedrization_display::_display_disable_lighting_list_cb(
   return GL_TRUE;
 }
 
-GLboolean
-Tetrahedrization_display::_display_facets_with_facet_normals_list_cb(
-  void *data, GLboolean test_proxy) {
-  Tetrahedrization& tetrahedrization
-    = ((Tetrahedrization_display *) data)->_tetrahedrization;
-  
-  if (test_proxy) return GL_TRUE;
-  glBegin(GL_TRIANGLES);
-  for (All_cells_iterator ci = tetrahedrization.all_cells_begin();
-       ci != tetrahedrization.all_cells_end(); ci++) {
-    for (int i = 0; i < 4; i++) {
-      if (ci->is_surface_facet(i)) {
-        Triangle triangle(tetrahedrization.triangle(ci, i));
-        Vector v = triangle.supporting_plane().orthogonal_vector();
-        glNormal3(normalize(v));
-        glTriangle3(triangle);
-      }
-    }
-  }
-  glEnd();
-  return GL_TRUE;
-}
-
 GLboolean
 Tetrahedrization_display::_display_facet_normals_list_cb(
   void *data, GLboolean test_proxy) {
@@ -483,3 +544,227 @@ Tetrahedrization_display::_display_gooch_list_cb(void *data,
   glEnable(GL_TEXTURE_2D);
   return GL_TRUE;
 }
+
+Tetrahedrization_display::_Facet_key
+Tetrahedrization_display::_oriented_facet(const Facet& f,
+                                          Vertex_handle vh[3]) const {
+  // same winding as Tetrahedrization::triangle()
+  const int i = f.second;
+  if ((i&1) == 0) {
+    vh[0] = f.first->vertex((i+2)&3);
+    vh[1] = f.first->vertex((i+1)&3);
+    vh[2] = f.first->vertex((i+3)&3);
+  } else {
+    vh[0] = f.first->vertex((i+1)&3);
+    vh[1] = f.first->vertex((i+2)&3);
+    vh[2] = f.first->vertex((i+3)&3);
+  }
+  // the key starts with the smallest ID, keeping the winding
+  GLuint ids[3] = {vh[0]->id(), vh[1]->id(), vh[2]->id()};
+  int first = 0;
+  if (ids[1] < ids[first]) first = 1;
+  if (ids[2] < ids[first]) first = 2;
+  return _Facet_key(ids[first], ids[(first+1)%3], ids[(first+2)%3]);
+}
+
+void
+Tetrahedrization_display::_set_facet_slot(int slot,
+                                          const Vertex_handle vh[3]) {
+  Triangle triangle(vh[0]->point(), vh[1]->point(), vh[2]->point());
+  Vector v = triangle.supporting_plane().orthogonal_vector();
+  normalize(v);
+  for (int j = 0; j < 3; j++) {
+    for (int k = 0; k < 3; k++) {
+      _facet_vertices[9*slot + 3*j + k] = triangle[j][k];
+      _facet_normals[9*slot + 3*j + k] = v[k];
+    }
+  }
+  _dirty_facet_slots.push_back(slot);
+}
+
+void
+Tetrahedrization_display::_remove_facet_slot(int slot) {
+  const int last = _facet_keys.size() - 1;
+  _facet_slots.erase(_facet_keys[slot]);
+  if (slot != last) {
+    copy(_facet_vertices.begin() + 9*last,
+         _facet_vertices.begin() + 9*last + 9,
+         _facet_vertices.begin() + 9*slot);
+    copy(_facet_normals.begin() + 9*last, _facet_normals.begin() + 9*last + 9,
+         _facet_normals.begin() + 9*slot);
+    _facet_keys[slot] = _facet_keys[last];
+    _facet_slots[_facet_keys[slot]] = slot;
+    _dirty_facet_slots.push_back(slot);
+  }
+  _facet_vertices.resize(9*last);
+  _facet_normals.resize(9*last);
+  _facet_keys.pop_back();
+}
+
+void
+Tetrahedrization_display::_update_facets(void) {
+  vector<bool> is_kept(_facet_keys.size(), false);
+  Vertex_handle vh[3];
+  
+  for (All_cells_iterator ci = _tetrahedrization.all_cells_begin();
+       ci != _tetrahedrization.all_cells_end(); ci++) {
+    for (int i = 0; i < 4; i++) {
+      if (ci->is_surface_facet(i)) {
+        _Facet_key key = _oriented_facet(Facet(ci, i), vh);
+        map<_Facet_key, int>::iterator si = _facet_slots.find(key);
+        if (si == _facet_slots.end()) {
+          // new facet
+          const int slot = _facet_keys.size();
+          _facet_vertices.resize(9*(slot + 1));
+          _facet_normals.resize(9*(slot + 1));
+          _facet_keys.push_back(key);
+          _facet_slots[key] = slot;
+          _set_facet_slot(slot, vh);
+          is_kept.push_back(true);
+        } else {
+          // kept facet, unless one of its vertex IDs was recycled
+          const int slot = si->second;
+          is_kept[slot] = true;
+          for (int j = 0; j < 3; j++) {
+            if (_facet_vertices[9*slot + 3*j]     != vh[j]->point()[0] ||
+                _facet_vertices[9*slot + 3*j + 1] != vh[j]->point()[1] ||
+                _facet_vertices[9*slot + 3*j + 2] != vh[j]->point()[2]) {
+              _set_facet_slot(slot, vh);
+              break;
+            }
+          }
+        }
+      }
+    }
+  }
+  
+  // removed facets, last slots first so that moved slots are kept ones
+  for (int slot = is_kept.size() - 1; slot >= 0; slot--) {
+    if (!is_kept[slot]) {
+      _remove_facet_slot(slot);
+    }
+  }
+}
+
+void
+Tetrahedrization_display::_update_hierarchy(int number_of_changed_facets) {
+  // a negative number of changed facets means that some were added or
+  // removed, and that the tree has to be rebuilt
+  if (number_of_changed_facets == 0) return;
+  vector<GLuint> vertex_ids(3*_facet_keys.size());
+  for (unsigned int id = 0; id < _facet_keys.size(); id++) {
+    vertex_ids[3*id]     = _facet_keys[id].first;
+    vertex_ids[3*id + 1] = _facet_keys[id].second;
+    vertex_ids[3*id + 2] = _facet_keys[id].third;
+  }
+  if (number_of_changed_facets > 0 &&
+      number_of_changed_facets
+        <= HIERARCHY_REFIT_RATIO * _hierarchy.number_of_triangles()) {
+    _hierarchy.refit(_facet_vertices, vertex_ids);
+  } else {
+    _hierarchy.build(_facet_vertices, vertex_ids);
+  }
+}
+
+void
+Tetrahedrization_display::_upload_arrays(void) {
+  if (!has_vertex_buffer_objects()) {
+    // client arrays are always up to date
+    _dirty_facet_slots.clear();
+    return;
+  }
+  
+  if (!_has_buffers) {
+    gl_gen_buffers(_NUMBER_OF_ARRAYS, _buffers);
+    _has_buffers = true;
+  }
+  
+  const GLsizei number_of_facets = _facet_keys.size();
+  if (number_of_facets > _facet_capacity) {
+    _facet_capacity = (GLsizei) (BUFFER_GROWTH_RATIO * number_of_facets);
+    for (int i = 0; i < _NUMBER_OF_ARRAYS; i++) {
+      gl_bind_buffer(GL_ARRAY_BUFFER_ARB, _buffers[i]);
+      gl_buffer_data(GL_ARRAY_BUFFER_ARB, _facet_capacity*SLOT_BYTE_SIZES[i],
+                     NULL, GL_DYNAMIC_DRAW_ARB);
+    }
+    _dirty_facet_slots.clear();
+    for (int slot = 0; slot < number_of_facets; slot++) {
+      _dirty_facet_slots.push_back(slot);
+    }
+  }
+  _upload_slots(_dirty_facet_slots);
+  
+  gl_bind_buffer(GL_ARRAY_BUFFER_ARB, 0);
+}
+
+void
+Tetrahedrization_display::_upload_slots(vector<int>& slots) {
+  if (slots.empty()) return;
+  const int number_of_slots = _facet_keys.size();
+  
+  // contiguous dirty slots are uploaded together
+  sort(slots.begin(), slots.end());
+  slots.erase(unique(slots.begin(), slots.end()), slots.end());
+  vector<int>::const_iterator begin = slots.begin();
+  while (begin != slots.end() && *begin < number_of_slots) {
+    vector<int>::const_iterator end = begin + 1;
+    while (end != slots.end() && *end == *(end - 1) + 1 &&
+           *end < number_of_slots) {
+      end++;
+    }
+    const int count = end - begin;
+    for (int i = 0; i < _NUMBER_OF_ARRAYS; i++) {
+      const GLubyte *data = (const GLubyte *) _client_array((_Array) i);
+      gl_bind_buffer(GL_ARRAY_BUFFER_ARB, _buffers[i]);
+      gl_buffer_sub_data(GL_ARRAY_BUFFER_ARB,
+                         (*begin)*SLOT_BYTE_SIZES[i],
+                         count*SLOT_BYTE_SIZES[i],
+                         data + (*begin)*SLOT_BYTE_SIZES[i]);
+    }
+    begin = end;
+  }
+  slots.clear();
+}
+
+const GLvoid *
+Tetrahedrization_display::_client_array(_Array array) const {
+  switch (array) {
+  case _FACET_VERTICES:
+    return _facet_vertices.empty() ? NULL : &_facet_vertices[0];
+  case _FACET_NORMALS:
+    return _facet_normals.empty() ? NULL : &_facet_normals[0];
+  default:
+    assert(false);
+    return NULL;
+  }
+}
+
+const GLvoid *
+Tetrahedrization_display::_array_pointer(_Array array) {
+  if (_has_buffers) {
+    // offset in the bound buffer object
+    gl_bind_buffer(GL_ARRAY_BUFFER_ARB, _buffers[array]);
+    return NULL;
+  } else {
+    return _client_array(array);
+  }
+}
+
+void
+Tetrahedrization_display::_draw_facets(bool with_normals) {
+  if (_facet_vertices.empty()) return;
+  glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+  
+  glEnableClientState(GL_VERTEX_ARRAY);
+  glVertexPointer(3, GL_FLOAT, 0, _array_pointer(_FACET_VERTICES));
+  if (with_normals) {
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glNormalPointer(GL_FLOAT, 0, _array_pointer(_FACET_NORMALS));
+  }
+  glDrawArrays(GL_TRIANGLES, 0, _facet_vertices.size()/3);
+  if (_has_buffers) {
+    gl_bind_buffer(GL_ARRAY_BUFFER_ARB, 0);
+  }
+  
+  glPopClientAttrib();
+}
@@ -1,10 +1,13 @@
 #ifndef __TETRAHEDRIZATION_DISPLAY_HH__
 #define __TETRAHEDRIZATION_DISPLAY_HH__
 
+#include <vector>
+#include <map>
 #include <opengl_utils.h>
 #include <opengl_buffer.h>
 
 #include "tetrahedrization.hh"
+#include "bounding_volume_hierarchy.hh"
 
 class Tetrahedrization_display {
 public:
@@ -18,9 +21,7 @@ public:
 #endif
     NPR_GOOCH,
     NPR_RASKAR,
-    DEPTH_BUFFER,
-    ITEM_BUFFER_POINTS,
-    ITEM_BUFFER_TRIANGLES
+    DEPTH_BUFFER
   } Style;
   
   Tetrahedrization_display(Tetrahedrization& tetrahedrization);
@@ -28,6 +29,11 @@ public:
   void push_style(Style style);
   void pop_style(void);
   GLfloat size(void) const;
+  // facet IDs are the slots of the surface facets in the display arrays
+  Tetrahedrization::Facet surface_facet_with_id(unsigned int id) const;
+  // triangles of the hierarchy are indexed by facet IDs
+  const Bounding_volume_hierarchy& bounding_volume_hierarchy(void) const;
+  void update(void);
   void display(void);
   void display_bbox(void);
   
@@ -37,16 +43,21 @@ private:
   typedef Tetrahedrization::Triangle Triangle;
   typedef Tetrahedrization::Facet Facet;
   typedef Tetrahedrization::Vertex_handle Vertex_handle;
+  typedef Tetrahedrization::Cell_handle Cell_handle;
   typedef Tetrahedrization::Finite_vertices_iterator Finite_vertices_iterator;
   typedef Tetrahedrization::All_cells_iterator All_cells_iterator;
+  typedef enum {
+    _FACET_VERTICES,
+    _FACET_NORMALS,
+    _NUMBER_OF_ARRAYS
+  } _Array;
+  typedef CGAL::Triple<GLuint, GLuint, GLuint> _Facet_key;
   
   static GLboolean _setup_gooch_texture_cb(void *data, GLboolean test_proxy);
   static GLboolean _display_enable_lighting_list_cb(
     void *data, GLboolean test_proxy);
   static GLboolean _display_disable_lighting_list_cb(
     void *data, GLboolean test_proxy);
-  static GLboolean _display_facets_with_facet_normals_list_cb(
-    void *data, GLboolean test_proxy);
   static GLboolean _display_facet_normals_list_cb(
     void *data, GLboolean test_proxy);
   static GLboolean _display_gooch_list_cb(
@@ -58,12 +69,35 @@ private:
     void *data, GLboolean test_proxy);
 #endif
   
+  _Facet_key _oriented_facet(const Facet& f, Vertex_handle vh[3]) const;
+  void _set_facet_slot(int slot, const Vertex_handle vh[3]);
+  void _remove_facet_slot(int slot);
+  void _update_facets(void);
+  void _update_hierarchy(int number_of_changed_facets);
+  void _upload_arrays(void);
+  void _upload_slots(std::vector<int>& slots);
+  const GLvoid *_client_array(_Array array) const;
+  const GLvoid *_array_pointer(_Array array);
+  void _draw_facets(bool with_normals);
+  
   Tetrahedrization& _tetrahedrization;
   std::stack<Style> _style;
+  // surface mesh retained between frames, as vertex buffer objects when
+  // supported and as client vertex arrays otherwise
+  // facets live in dense slots: a slot freed by an edit is
+  // filled with the last one, so that only changed slots are uploaded
+  std::vector<GLfloat> _facet_vertices, _facet_normals;
+  std::vector<_Facet_key> _facet_keys;
+  std::map<_Facet_key, int> _facet_slots;
+  std::vector<int> _dirty_facet_slots;
+  Bounding_volume_hierarchy _hierarchy;
+  GLuint _buffers[_NUMBER_OF_ARRAYS];
+  GLsizei _facet_capacity;
+  bool _has_buffers, _are_lists_outdated;
   GLframebuf *_gooch_image;
   GLtexture *_gooch_texture;
   GLlist *_enable_lighting_list, *_disable_lighting_list;
-  GLlist *_facets_with_facet_normals_list, *_facet_normals_list;
+  GLlist *_facet_normals_list;
   GLlist *_gooch_list;
 #if DEBUG
   GLlist *_facets_with_vertex_normals_list, *_vertex_normals_list;
@@ -1,18 +1,747 @@
+#include <algorithm>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <sstream>
 #include <string>
-// #include <CGAL/IO/File_scanner_OFF.h>
+#include <glib.h>
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
 
+#include "range_coder.hh"
+#include "voxel_grid.hh"
 #include "tetrahedrization_iostream.hh"
 
 using namespace std;
 
+static const streamsize READ_CHUNK_SIZE = 1 << 16;
+static const int OFF_PARALLEL_SIZE_MIN = 1 << 14;
+// Rationale:
+// below a few thousand vertices, parsing takes less time than starting
+// threads
+static const unsigned int OFF_VERTEX_LINE_SIZE_MIN = 6;
+// Rationale:
+// "0 0 0\n", so that vertex counts are bounded by the file size before
+// anything is allocated
+
+static const unsigned int NULL_INDEX = ~0u;
+
+static const unsigned int WRITE_BLOCK_LINES = 1 << 13;
+// Rationale:
+// blocks of a few hundred kilobytes amortize write calls, and are small
+// enough to be formatted by several threads and kept in cache
+
+static const int STL_HEADER_SIZE = 80;
+
+static const char COMPRESSED_MAGIC[4] = { '\211', 'R', 'L', 'M' };
+static const guint32 COMPRESSED_VERSION = 1;
+static const int DEFAULT_QUANTIZATION_BITS = 18;
+static const int MAX_QUANTIZATION_BITS = 24;
+// Rationale:
+// 18 bits resolve a 64th of a pixel on the largest (4096 pixels) drawings,
+// and single precision coordinates hold 24 significant bits anyway
+static const guint32 READ_RESERVE_MAX = 1 << 20;
+// Rationale:
+// vertex counts are not trusted with more memory than that before the
+// vertices themselves are decoded
+
+static const double DEFAULT_VOXEL_SIZE = 0.0;
+static const unsigned int DEFAULT_MAX_POINTS = 1 << 18;
+// Rationale:
+// each vertex brings about 6.5 cells to the tetrahedrization, so that a
+// quarter million points already take a few hundred megabytes; thinning
+// then starts at the granularity of the points, and coarsens only as much
+// as the budget requires
+static const unsigned int PLY_CHUNK_RECORDS = 1 << 12;
+
+static inline bool
+is_space(char c) {
+  return (c == ' ' || c == '\t' || c == '\n' || c == '\r' ||
+          c == '\v' || c == '\f');
+}
+
+static inline bool
+is_digit(char c) {
+  return ('0' <= c && c <= '9');
+}
+
+static inline const char *
+skip_line(const char *s, const char *end) {
+  const char *eol = (const char *) memchr(s, '\n', end - s);
+  return (eol == NULL) ? end : eol + 1;
+}
+
+static inline const char *
+skip_blanks(const char *s, const char *end) {
+  while (s != end && (*s == ' ' || *s == '\t')) s++;
+  return s;
+}
+
+static inline const char *
+skip_spaces(const char *s, const char *end) {
+  // comments run from a pound sign to the end of the line
+  while (s != end) {
+    if (is_space(*s)) {
+      s++;
+    } else if (*s == '#') {
+      s = skip_line(s, end);
+    } else {
+      break;
+    }
+  }
+  return s;
+}
+
+static bool
+is_off_keyword(const char *begin, const char *end) {
+  // [ST][C][N]OFF, in this order
+  if (end - begin >= 2 && begin[0] == 'S' && begin[1] == 'T') begin += 2;
+  if (end - begin >= 1 && begin[0] == 'C') begin++;
+  if (end - begin >= 1 && begin[0] == 'N') begin++;
+  return (end - begin == 3 && strncmp(begin, "OFF", 3) == 0);
+}
+
+static bool
+parse_unsigned(const char *&s, const char *end, unsigned int& n) {
+  const char *begin = s;
+  n = 0;
+  while (s != end && is_digit(*s)) {
+    n = 10 * n + (*s++ - '0');
+  }
+  return (s != begin);
+}
+
+static bool
+parse_double(const char *&s, const char *end, double& x) {
+  /*
+   * Decimal numbers with an optional exponent. Up to 19 significant
+   * digits are accumulated in an integer, and scaled once by a power of
+   * ten: this is exact enough for single precision coordinates.
+   */
+  static const double POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+  bool is_negative = false;
+  guint64 mantissa = 0;
+  int number_of_digits = 0, exponent = 0;
+  
+  if (s != end && (*s == '-' || *s == '+')) {
+    is_negative = (*s++ == '-');
+  }
+  const char *digits = s;
+  for (; s != end && is_digit(*s); s++) {
+    if (number_of_digits < 19) {
+      mantissa = 10 * mantissa + (*s - '0');
+      if (mantissa != 0) number_of_digits++;
+    } else {
+      exponent++;
+    }
+  }
+  bool has_digits = (s != digits);
+  if (s != end && *s == '.') {
+    const char *fraction_digits = ++s;
+    for (; s != end && is_digit(*s); s++) {
+      if (number_of_digits < 19) {
+        mantissa = 10 * mantissa + (*s - '0');
+        if (mantissa != 0) number_of_digits++;
+        exponent--;
+      }
+    }
+    has_digits = has_digits || (s != fraction_digits);
+  }
+  if (!has_digits || (s != end && !is_space(*s) && *s != 'e' && *s != 'E' &&
+                      *s != '#')) {
+    return false;
+  }
+  if (s != end && (*s == 'e' || *s == 'E')) {
+    bool is_exponent_negative = false;
+    unsigned int e = 0;
+    s++;
+    if (s != end && (*s == '-' || *s == '+')) {
+      is_exponent_negative = (*s++ == '-');
+    }
+    if (!parse_unsigned(s, end, e)) return false;
+    exponent += is_exponent_negative ? -(int) e : (int) e;
+  }
+  
+  x = (double) mantissa;
+  while (exponent > 22) {
+    x *= 1e22;
+    exponent -= 22;
+  }
+  while (exponent < -22) {
+    x /= 1e22;
+    exponent += 22;
+  }
+  x = (exponent >= 0) ? x * POWERS_OF_TEN[exponent]
+                      : x / POWERS_OF_TEN[-exponent];
+  if (is_negative) x = -x;
+  return true;
+}
+
+static char *
+format_unsigned(char *s, unsigned int n) {
+  char digits[10];
+  int number_of_digits = 0;
+  
+  do {
+    digits[number_of_digits++] = '0' + n % 10;
+    n /= 10;
+  } while (n != 0);
+  while (number_of_digits > 0) {
+    *s++ = digits[--number_of_digits];
+  }
+  return s;
+}
+
+static inline guint64
+round_half_even(double x) {
+  guint64 n = (guint64) x;
+  double fraction = x - (double) n;
+  if (fraction > 0.5 || (fraction == 0.5 && (n & 1))) n++;
+  return n;
+}
+
+static char *
+format_double(char *s, double x, int precision) {
+  /*
+   * Same output as printf("%.*g", precision, x), up to the last digit
+   * beyond single precision: the value is rounded to an integer of
+   * precision digits, printed in fixed notation when its decimal exponent
+   * lies in [-4, precision), in scientific notation otherwise, without
+   * trailing zeros.
+   */
+  static const double POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17
+  };
+  char digits[17];
+  
+  if (precision < 1) precision = 1;
+  if (precision > 17) precision = 17;
+  if (x != x) {
+    memcpy(s, "nan", 3);
+    return s + 3;
+  }
+  if (x < 0.0) {
+    *s++ = '-';
+    x = -x;
+  }
+  if (x == 0.0) {
+    *s++ = '0';
+    return s;
+  }
+  if (x > DBL_MAX) {
+    memcpy(s, "inf", 3);
+    return s + 3;
+  }
+  
+  int exponent = (int) floor(log10(x));
+  int shift = precision - 1 - exponent;
+  double scaled = (shift >= 0) ? x * pow(10.0, shift) : x / pow(10.0, -shift);
+  if (scaled < POWERS_OF_TEN[precision - 1]) {
+    scaled *= 10.0; // log10 was off by one
+    exponent--;
+  }
+  guint64 mantissa = round_half_even(scaled);
+  if (mantissa >= (guint64) POWERS_OF_TEN[precision]) {
+    mantissa = round_half_even(scaled / 10.0); // rounding carried a digit
+    exponent++;
+  }
+  for (int i = precision - 1; i >= 0; i--) {
+    digits[i] = '0' + (char) (mantissa % 10);
+    mantissa /= 10;
+  }
+  int number_of_digits = precision;
+  while (number_of_digits > 1 && digits[number_of_digits - 1] == '0') {
+    number_of_digits--;
+  }
+  
+  if (-4 <= exponent && exponent < precision) {
+    if (exponent < 0) {
+      *s++ = '0';
+      *s++ = '.';
+      for (int i = exponent + 1; i < 0; i++) *s++ = '0';
+      memcpy(s, digits, number_of_digits);
+      s += number_of_digits;
+    } else {
+      for (int i = 0; i <= exponent; i++) {
+        *s++ = (i < number_of_digits) ? digits[i] : '0';
+      }
+      if (number_of_digits > exponent + 1) {
+        *s++ = '.';
+        memcpy(s, digits + exponent + 1, number_of_digits - exponent - 1);
+        s += number_of_digits - exponent - 1;
+      }
+    }
+  } else {
+    *s++ = digits[0];
+    if (number_of_digits > 1) {
+      *s++ = '.';
+      memcpy(s, digits + 1, number_of_digits - 1);
+      s += number_of_digits - 1;
+    }
+    *s++ = 'e';
+    *s++ = (exponent < 0) ? '-' : '+';
+    if (exponent < 0) exponent = -exponent;
+    if (exponent < 10) *s++ = '0';
+    s = format_unsigned(s, exponent);
+  }
+  return s;
+}
+
+template <typename Line_formatter>
+static void
+write_lines(ostream& out, unsigned int number_of_lines,
+            const Line_formatter& format_line) {
+  /*
+   * Lines are formatted by blocks into reusable buffers, one write per
+   * block. With OpenMP, consecutive blocks are formatted in parallel, then
+   * written in order.
+   */
+  int number_of_buffers = 1;
+#ifdef _OPENMP
+  number_of_buffers = omp_get_max_threads();
+#endif
+  const unsigned int number_of_blocks
+    = (number_of_lines + WRITE_BLOCK_LINES - 1) / WRITE_BLOCK_LINES;
+  if ((unsigned int) number_of_buffers > number_of_blocks) {
+    number_of_buffers = (number_of_blocks > 0) ? number_of_blocks : 1;
+  }
+  vector< vector<char> > buffers(number_of_buffers,
+    vector<char>(WRITE_BLOCK_LINES * Line_formatter::MAX_LINE_SIZE));
+  vector<size_t> sizes(number_of_buffers);
+  
+  for (unsigned int first_block = 0; first_block < number_of_blocks;
+       first_block += number_of_buffers) {
+    const int n = min((unsigned int) number_of_buffers,
+                      number_of_blocks - first_block);
+#pragma omp parallel for schedule(static) if (n > 1)
+    for (int b = 0; b < n; b++) {
+      const unsigned int begin = (first_block + b) * WRITE_BLOCK_LINES;
+      const unsigned int end = min(begin + WRITE_BLOCK_LINES,
+                                   number_of_lines);
+      char *s = &buffers[b][0];
+      for (unsigned int i = begin; i < end; i++) {
+        s = format_line(s, i);
+      }
+      sizes[b] = s - &buffers[b][0];
+    }
+    for (int b = 0; b < n; b++) {
+      out.write(&buffers[b][0], sizes[b]);
+    }
+  }
+}
+
+class Vertex_line_formatter {
+public:
+  // three numbers of at most 24 characters, two spaces and a new line
+  static const unsigned int MAX_LINE_SIZE = 3*24 + 3;
+  
+  Vertex_line_formatter(
+    const vector<Tetrahedrization::Vertex_handle>& vertices, int precision)
+    : _vertices(vertices),
+      _precision(precision) {}
+  char *operator()(char *s, unsigned int i) const {
+    const Tetrahedrization::Point& p = _vertices[i]->point();
+    s = format_double(s, p.x(), _precision);
+    *s++ = ' ';
+    s = format_double(s, p.y(), _precision);
+    *s++ = ' ';
+    s = format_double(s, p.z(), _precision);
+    *s++ = '\n';
+    return s;
+  }
+  
+private:
+  const vector<Tetrahedrization::Vertex_handle>& _vertices;
+  int _precision;
+};
+
+class Facet_line_formatter {
+public:
+  // "3", three indices of at most 10 digits, three spaces and a new line
+  static const unsigned int MAX_LINE_SIZE = 1 + 3*10 + 4;
+  
+  Facet_line_formatter(const vector<unsigned int>& indices)
+    : _indices(indices) {}
+  char *operator()(char *s, unsigned int i) const {
+    *s++ = '3';
+    for (int j = 0; j < 3; j++) {
+      *s++ = ' ';
+      s = format_unsigned(s, _indices[3*i + j]);
+    }
+    *s++ = '\n';
+    return s;
+  }
+  
+private:
+  const vector<unsigned int>& _indices;
+};
+
+static inline char *
+put_uint32(char *s, guint32 x) {
+  // binary PLY and STL records are little endian, whatever the host
+  s[0] = (char) (x & 0xff);
+  s[1] = (char) ((x >> 8) & 0xff);
+  s[2] = (char) ((x >> 16) & 0xff);
+  s[3] = (char) ((x >> 24) & 0xff);
+  return s + 4;
+}
+
+static inline char *
+put_float(char *s, float x) {
+  guint32 bits;
+  memcpy(&bits, &x, sizeof(bits));
+  return put_uint32(s, bits);
+}
+
+class Ply_vertex_formatter {
+public:
+  // 3 coordinates and 3 normal coordinates as floats
+  static const unsigned int MAX_LINE_SIZE = 6*4;
+  
+  Ply_vertex_formatter(
+    const vector<Tetrahedrization::Vertex_handle>& vertices,
+    const vector<GLfloat>& normals)
+    : _vertices(vertices),
+      _normals(normals) {}
+  char *operator()(char *s, unsigned int i) const {
+    const Tetrahedrization::Point& p = _vertices[i]->point();
+    s = put_float(s, p.x());
+    s = put_float(s, p.y());
+    s = put_float(s, p.z());
+    s = put_float(s, _normals[3*i]);
+    s = put_float(s, _normals[3*i + 1]);
+    s = put_float(s, _normals[3*i + 2]);
+    return s;
+  }
+  
+private:
+  const vector<Tetrahedrization::Vertex_handle>& _vertices;
+  const vector<GLfloat>& _normals;
+};
+
+class Ply_face_formatter {
+public:
+  // vertex count as an unsigned char, then 3 indices as ints
+  static const unsigned int MAX_LINE_SIZE = 1 + 3*4;
+  
+  Ply_face_formatter(const vector<unsigned int>& indices)
+    : _indices(indices) {}
+  char *operator()(char *s, unsigned int i) const {
+    *s++ = 3;
+    for (int j = 0; j < 3; j++) {
+      s = put_uint32(s, _indices[3*i + j]);
+    }
+    return s;
+  }
+  
+private:
+  const vector<unsigned int>& _indices;
+};
+
+class Stl_facet_formatter {
+public:
+  // normal and 3 vertices as floats, then a zero attribute byte count
+  static const unsigned int MAX_LINE_SIZE = 12*4 + 2;
+  
+  Stl_facet_formatter(
+    const vector<Tetrahedrization::Vertex_handle>& vertices,
+    const vector<unsigned int>& indices)
+    : _vertices(vertices),
+      _indices(indices) {}
+  char *operator()(char *s, unsigned int i) const {
+    const Tetrahedrization::Point& p0 = _vertices[_indices[3*i]]->point();
+    const Tetrahedrization::Point& p1 = _vertices[_indices[3*i + 1]]->point();
+    const Tetrahedrization::Point& p2 = _vertices[_indices[3*i + 2]]->point();
+    double u[3], v[3], n[3];
+    for (int j = 0; j < 3; j++) {
+      u[j] = p1[j] - p0[j];
+      v[j] = p2[j] - p0[j];
+    }
+    n[0] = u[1]*v[2] - u[2]*v[1];
+    n[1] = u[2]*v[0] - u[0]*v[2];
+    n[2] = u[0]*v[1] - u[1]*v[0];
+    double norm = sqrt(n[0]*n[0] + n[1]*n[1] + n[2]*n[2]);
+    for (int j = 0; j < 3; j++) {
+      s = put_float(s, (norm > 0.0) ? n[j] / norm : 0.0);
+    }
+    for (int j = 0; j < 3; j++) {
+      const Tetrahedrization::Point& p = _vertices[_indices[3*i + j]]->point();
+      s = put_float(s, p.x());
+      s = put_float(s, p.y());
+      s = put_float(s, p.z());
+    }
+    *s++ = 0;
+    *s++ = 0;
+    return s;
+  }
+  
+private:
+  const vector<Tetrahedrization::Vertex_handle>& _vertices;
+  const vector<unsigned int>& _indices;
+};
+
+class Obj_vector_formatter {
+public:
+  // "vn", three numbers of at most 24 characters, three spaces, a new line
+  static const unsigned int MAX_LINE_SIZE = 2 + 3*24 + 4;
+  
+  Obj_vector_formatter(const char *keyword,
+                       const vector<GLfloat>& coordinates, int precision)
+    : _keyword(keyword),
+      _coordinates(coordinates),
+      _precision(precision) {}
+  char *operator()(char *s, unsigned int i) const {
+    for (const char *k = _keyword; *k != '\0'; k++) {
+      *s++ = *k;
+    }
+    for (int j = 0; j < 3; j++) {
+      *s++ = ' ';
+      s = format_double(s, _coordinates[3*i + j], _precision);
+    }
+    *s++ = '\n';
+    return s;
+  }
+  
+private:
+  const char *_keyword;
+  const vector<GLfloat>& _coordinates;
+  int _precision;
+};
+
+class Obj_face_formatter {
+public:
+  // "f", three "i//i" of at most 2*10 + 2 characters, three spaces and a
+  // new line
+  static const unsigned int MAX_LINE_SIZE = 1 + 3*(2*10 + 2) + 4;
+  
+  Obj_face_formatter(const vector<unsigned int>& indices)
+    : _indices(indices) {}
+  char *operator()(char *s, unsigned int i) const {
+    *s++ = 'f';
+    for (int j = 0; j < 3; j++) {
+      // OBJ indices start at 1, normals share the vertex indices
+      unsigned int index = _indices[3*i + j] + 1;
+      *s++ = ' ';
+      s = format_unsigned(s, index);
+      *s++ = '/';
+      *s++ = '/';
+      s = format_unsigned(s, index);
+    }
+    *s++ = '\n';
+    return s;
+  }
+  
+private:
+  const vector<unsigned int>& _indices;
+};
+
+static void
+traverse_facets(const vector<unsigned int>& facets,
+                vector<unsigned int>& order) {
+  /*
+   * Breadth-first traversal of the facets, two facets being adjacent when
+   * they share an edge whatever their orientation. Facets close in the
+   * traversal share vertices, which keeps the index deltas small.
+   */
+  const unsigned int n = facets.size() / 3;
+  vector< pair<guint64, unsigned int> > edges;
+  edges.reserve(3 * n);
+  for (unsigned int f = 0; f < n; f++) {
+    for (int j = 0; j < 3; j++) {
+      guint64 a = facets[3*f + j], b = facets[3*f + (j + 1)%3];
+      edges.push_back(make_pair((min(a, b) << 32) | max(a, b), f));
+    }
+  }
+  sort(edges.begin(), edges.end());
+  
+  vector<bool> is_visited(n, false);
+  order.clear();
+  order.reserve(n);
+  for (unsigned int seed = 0; seed < n; seed++) {
+    if (is_visited[seed]) continue;
+    is_visited[seed] = true;
+    order.push_back(seed);
+    // the traversal order itself is the queue
+    for (unsigned int q = order.size() - 1; q < order.size(); q++) {
+      unsigned int f = order[q];
+      for (int j = 0; j < 3; j++) {
+        guint64 a = facets[3*f + j], b = facets[3*f + (j + 1)%3];
+        guint64 key = (min(a, b) << 32) | max(a, b);
+        for (vector< pair<guint64, unsigned int> >::const_iterator ei
+               = lower_bound(edges.begin(), edges.end(), make_pair(key, 0u));
+             ei != edges.end() && ei->first == key; ei++) {
+          if (!is_visited[ei->second]) {
+            is_visited[ei->second] = true;
+            order.push_back(ei->second);
+          }
+        }
+      }
+    }
+  }
+}
+
+class Line_reader {
+public:
+  Line_reader(istream& in) : _in(in), _buffer(), _size(0) {}
+  // next chunk of complete lines, the last line of the stream possibly
+  // without end of line
+  bool read(const char *&begin, const char *&end) {
+    _buffer.erase(_buffer.begin(), _buffer.begin() + _size);
+    while (true) {
+      const size_t size = _buffer.size();
+      _buffer.resize(size + READ_CHUNK_SIZE);
+      streamsize n = _in.rdbuf()->sgetn(&_buffer[size], READ_CHUNK_SIZE);
+      _buffer.resize(size + n);
+      if (_buffer.empty()) return false;
+      _size = _buffer.size();
+      while (_size > 0 && _buffer[_size - 1] != '\n') _size--;
+      if (_size > 0) break;
+      if (n == 0) {
+        _size = _buffer.size();
+        break;
+      }
+    }
+    begin = &_buffer[0];
+    end = begin + _size;
+    return true;
+  }
+  
+private:
+  istream& _in;
+  vector<char> _buffer;
+  size_t _size;
+};
+
+static bool
+ply_scalar_type(const string& name, int& size, char& kind) {
+  // kind is 'i' for signed, 'u' for unsigned integers, 'f' for floats
+  static const struct {
+    const char *name;
+    int size;
+    char kind;
+  } TYPES[] = {
+    {"char", 1, 'i'}, {"int8", 1, 'i'}, {"uchar", 1, 'u'}, {"uint8", 1, 'u'},
+    {"short", 2, 'i'}, {"int16", 2, 'i'},
+    {"ushort", 2, 'u'}, {"uint16", 2, 'u'},
+    {"int", 4, 'i'}, {"int32", 4, 'i'}, {"uint", 4, 'u'}, {"uint32", 4, 'u'},
+    {"float", 4, 'f'}, {"float32", 4, 'f'},
+    {"double", 8, 'f'}, {"float64", 8, 'f'}
+  };
+  for (unsigned int i = 0; i < sizeof(TYPES) / sizeof(TYPES[0]); i++) {
+    if (name == TYPES[i].name) {
+      size = TYPES[i].size;
+      kind = TYPES[i].kind;
+      return true;
+    }
+  }
+  return false;
+}
+
+static double
+get_ply_scalar(const char *s, int size, char kind, bool is_swapped) {
+  char bytes[8];
+  for (int b = 0; b < size; b++) {
+    bytes[b] = s[is_swapped ? size - 1 - b : b];
+  }
+  switch (size) {
+  case 1:
+    return (kind == 'i') ? (double) (signed char) bytes[0]
+                         : (double) (unsigned char) bytes[0];
+  case 2: {
+    guint16 u;
+    memcpy(&u, bytes, 2);
+    return (kind == 'i') ? (double) (gint16) u : (double) u;
+  }
+  case 4: {
+    guint32 u;
+    memcpy(&u, bytes, 4);
+    if (kind == 'f') {
+      float x;
+      memcpy(&x, bytes, 4);
+      return x;
+    }
+    return (kind == 'i') ? (double) (gint32) u : (double) u;
+  }
+  case 8: {
+    double x;
+    memcpy(&x, bytes, 8);
+    return x;
+  }
+  default:
+    assert(false);
+    return 0.0;
+  }
+}
+
+static inline guint32
+float_bits(float x) {
+  guint32 bits;
+  memcpy(&bits, &x, sizeof(bits));
+  return bits;
+}
+
+static inline float
+bits_float(guint32 bits) {
+  float x;
+  memcpy(&x, &bits, sizeof(x));
+  return x;
+}
+
 Tetrahedrization_iostream::Tetrahedrization_iostream(
   Tetrahedrization& tetrahedrization, Format format, bool verbose)
   : _tetrahedrization(tetrahedrization),
     _format(format),
-    _verbose(verbose) {}
+    _verbose(verbose),
+    _quantization_bits(DEFAULT_QUANTIZATION_BITS),
+    _voxel_size(DEFAULT_VOXEL_SIZE),
+    _max_points(DEFAULT_MAX_POINTS),
+    _number_of_points_read(0),
+    _number_of_points_kept(0),
+    _thinning_size(0.0) {}
 
 Tetrahedrization_iostream::~Tetrahedrization_iostream(void) {}
 
+void
+Tetrahedrization_iostream::set_quantization_bits(int bits) {
+  assert(1 <= bits && bits <= MAX_QUANTIZATION_BITS);
+  _quantization_bits = bits;
+}
+
+void
+Tetrahedrization_iostream::set_thinning(double voxel_size,
+                                        unsigned int max_points) {
+  assert(voxel_size >= 0.0 && max_points > 0);
+  _voxel_size = voxel_size;
+  _max_points = max_points;
+}
+
+unsigned int
+Tetrahedrization_iostream::default_max_points(void) {
+  return DEFAULT_MAX_POINTS;
+}
+
+unsigned int
+Tetrahedrization_iostream::number_of_points_read(void) const {
+  return _number_of_points_read;
+}
+
+unsigned int
+Tetrahedrization_iostream::number_of_points_kept(void) const {
+  return _number_of_points_kept;
+}
+
+double
+Tetrahedrization_iostream::thinning_size(void) const {
+  return _thinning_size;
+}
+
 istream&
 operator>>(istream& in, Tetrahedrization_iostream& tin) {
   switch (tin._format) {
@@ -22,6 +751,15 @@ operator>>(istream& in, Tetrahedrization_iostream& tin) {
   case Tetrahedrization_iostream::OFF:
     tin._read_off(in);
     break;
+  case Tetrahedrization_iostream::COMPRESSED:
+    tin._read_compressed(in);
+    break;
+  case Tetrahedrization_iostream::PLY:
+    tin._read_ply(in);
+    break;
+  case Tetrahedrization_iostream::XYZ:
+    tin._read_xyz(in);
+    break;
   default:
     assert(false);
     break;
@@ -39,6 +777,18 @@ operator<<(ostream& out, const Tetrahedrization_iostream& tout) {
   case Tetrahedrization_iostream::OFF:
     tout._write_off(out);
     break;
+  case Tetrahedrization_iostream::COMPRESSED:
+    tout._write_compressed(out);
+    break;
+  case Tetrahedrization_iostream::PLY:
+    tout._write_ply(out);
+    break;
+  case Tetrahedrization_iostream::STL:
+    tout._write_stl(out);
+    break;
+  case Tetrahedrization_iostream::OBJ:
+    tout._write_obj(out);
+    break;
   default:
     assert(false);
     break;
@@ -46,66 +796,398 @@ operator<<(ostream& out, const Tetrahedrization_iostream& tout) {
   return out;
 }
 
+bool
+Tetrahedrization_iostream::read(const char *name) {
+  if (_format != OFF) {
+    ifstream fin(name, (_format == DEFAULT) ? ios::in
+                                            : ios::in | ios::binary);
+    fin >> *this;
+    return !fin.fail();
+  }
+  
+  GError *error = NULL;
+  GMappedFile *file = g_mapped_file_new(name, FALSE, &error);
+  if (file == NULL) {
+    cerr << "Error: " << error->message << "!" << endl;
+    g_error_free(error);
+    return false;
+  }
+  const char *begin = g_mapped_file_get_contents(file);
+  const char *end = begin + g_mapped_file_get_length(file);
+  bool is_read = (begin != NULL && _read_off(begin, end));
+  g_mapped_file_free(file);
+  return is_read;
+}
+
 void
 Tetrahedrization_iostream::_read(istream& in) {
   in >> _tetrahedrization;
+  _tetrahedrization.renumber_vertices();
+}
+
+void
+Tetrahedrization_iostream::_read_off(istream& in) {
+  // the whole stream is read at once and parsed in place
+  vector<char> buffer;
+  char chunk[READ_CHUNK_SIZE];
+  streamsize size = 0;
+  
+  while ((size = in.rdbuf()->sgetn(chunk, READ_CHUNK_SIZE)) > 0) {
+    buffer.insert(buffer.end(), chunk, chunk + size);
+  }
+  if (buffer.empty() || !_read_off(&buffer[0], &buffer[0] + buffer.size())) {
+    in.setstate(istream::failbit);
+  }
 }
 
-static string&
-first_line_not_pound_comment(istream& in, string& s) {
-  const string::value_type BLANK_SPACE = string(" ")[0];
-  const string::value_type POUND_SIGN = string("#")[0];
+bool
+Tetrahedrization_iostream::_read_off(const char *begin, const char *end) {
+  /*
+   * Object File Format, as documented with Geomview: an optional [ST][C][N]
+   * prefix announces texture coordinates, colors and normals after the
+   * vertex coordinates. Only coordinates are kept, the rest of each vertex
+   * line is skipped. Faces and trailing data are not read, since the
+   * surface is reconstructed from the points.
+   */
+  const char *s = skip_spaces(begin, end);
+  const char *keyword = s;
+  while (s != end && !is_space(*s)) s++;
+  if (!is_off_keyword(keyword, s)) return false;
+  s = skip_blanks(s, end);
+  if (s != end && *s != '\n' && *s != '\r' && *s != '#') {
+    return false; // binary OFF
+  }
   
-  bool is_comment_line = true;
-  while (is_comment_line) {
-    s.clear();
-    getline(in, s);
-    string::size_type pos = s.find_first_not_of(BLANK_SPACE);
-    if (!s.empty() && s.find(POUND_SIGN, pos) != pos) {
-      is_comment_line = false;
+  unsigned int number_of_vertices = 0;
+  unsigned int number_of_faces = 0;
+  s = skip_spaces(s, end);
+  if (!parse_unsigned(s, end, number_of_vertices)) return false;
+  s = skip_spaces(s, end);
+  if (!parse_unsigned(s, end, number_of_faces)) return false;
+  s = skip_line(s, end); // number of edges, often missing
+  cout << number_of_vertices << " vertices and "
+       << number_of_faces << " faces" << endl;
+  if (number_of_vertices == 0) return false;
+  if (number_of_vertices > (unsigned int) INT_MAX ||
+      number_of_vertices > (guint64) (end - s) / OFF_VERTEX_LINE_SIZE_MIN) {
+    cerr << "Error: vertex count exceeds file size!" << endl;
+    return false;
+  }
+  
+  // vertex lines are found serially, and parsed in parallel
+  vector<const char *> lines(number_of_vertices);
+  for (unsigned int i = 0; i < number_of_vertices; i++) {
+    s = skip_spaces(s, end);
+    if (s == end) return false;
+    lines[i] = s;
+    s = skip_line(s, end);
+  }
+  vector<Point> points(number_of_vertices);
+  const int n = number_of_vertices;
+  int number_of_errors = 0;
+#pragma omp parallel for schedule(static) reduction(+:number_of_errors) \
+        if (n >= OFF_PARALLEL_SIZE_MIN)
+  for (int i = 0; i < n; i++) {
+    const char *t = lines[i];
+    double x = 0.0, y = 0.0, z = 0.0;
+    if (parse_double(t, end, x) &&
+        parse_double(t = skip_blanks(t, end), end, y) &&
+        parse_double(t = skip_blanks(t, end), end, z)) {
+      points[i] = Point(x, y, z);
+    } else {
+      number_of_errors++;
     }
   }
-  return s;
+  if (number_of_errors > 0) {
+    cerr << "Error: " << number_of_errors << " invalid vertices!" << endl;
+    return false;
+  }
+  
+  _tetrahedrization.insert_first(points);
+  assert(_tetrahedrization.is_valid());
+  return true;
 }
 
 void
-Tetrahedrization_iostream::_read_off(istream& in) {
-  string s;
-  
-  if (first_line_not_pound_comment(in, s).substr(0, 3) == "OFF") {
-    unsigned int number_of_vertices = 0;
-    unsigned int number_of_faces = 0;
-    unsigned int number_of_edges = 0;
-    in >> number_of_vertices >> number_of_faces >> number_of_edges;
-    cout << number_of_vertices << " vertices and "
-         << number_of_faces << " faces" << endl;
-    
-    double xd = 0.0, yd = 0.0, zd = 0.0;
-    sscanf(first_line_not_pound_comment(in, s).c_str(),
-           "%lf %lf %lf\n", &xd, &yd, &zd);
-    _tetrahedrization.insert_first(Point(xd, yd, zd));
-    FT x = 0.0, y = 0.0, z = 0.0;
-    for (unsigned int i = 1; i < number_of_vertices; i++) {
-      in >> x >> y >> z;
-      _tetrahedrization.insert(Point(x, y, z));
-    }
-    assert(_tetrahedrization.is_valid());
+Tetrahedrization_iostream::_read_compressed(istream& in) {
+  char magic[sizeof(COMPRESSED_MAGIC)];
+  in.read(magic, sizeof(COMPRESSED_MAGIC));
+  if (in.fail() ||
+      memcmp(magic, COMPRESSED_MAGIC, sizeof(COMPRESSED_MAGIC)) != 0) {
+    cerr << "Error: not a compressed mesh!" << endl;
+    in.setstate(istream::failbit);
+    return;
+  }
+  
+  // symbols are decoded as bytes come, with no intermediate buffer
+  Range_decoder decoder(in);
+  guint32 version = decoder.decode_bits(8);
+  int bits = decoder.decode_bits(5);
+  float bounds[6];
+  for (int i = 0; i < 6; i++) {
+    bounds[i] = bits_float(decoder.decode_bits(32));
+  }
+  guint32 number_of_vertices = decoder.decode_bits(32);
+  guint32 number_of_facets = decoder.decode_bits(32);
+  if (decoder.fail() || version != COMPRESSED_VERSION ||
+      bits < 1 || bits > MAX_QUANTIZATION_BITS) {
+    cerr << "Error: unsupported compressed mesh!" << endl;
+    in.setstate(istream::failbit);
+    return;
+  }
+  cout << number_of_vertices << " vertices and "
+       << number_of_facets << " faces" << endl;
+  
+  // vertices are delta coded from the previous one in traversal order
+  const gint32 q_max = (1 << bits) - 1;
+  Range_integer_model position_models[3];
+  gint32 q[3] = { 0, 0, 0 };
+  vector<Point> points;
+  points.reserve(min(number_of_vertices, READ_RESERVE_MAX));
+  for (guint32 i = 0; i < number_of_vertices && !decoder.fail(); i++) {
+    double x[3];
+    for (int j = 0; j < 3; j++) {
+      q[j] += decoder.decode_signed_integer(position_models[j]);
+      if (q[j] < 0 || q[j] > q_max) {
+        cerr << "Error: corrupted compressed mesh vertices!" << endl;
+        in.setstate(istream::failbit);
+        return;
+      }
+      x[j] = bounds[j] + (double) (bounds[3 + j] - bounds[j]) * q[j] / q_max;
+    }
+    points.push_back(Point(x[0], x[1], x[2]));
+  }
+  
+  // facets are decoded to check the stream, the surface being
+  // reconstructed from the points
+  Range_integer_model corner_models[3];
+  guint32 number_of_new_vertices = 0;
+  for (guint32 f = 0; f < number_of_facets && !decoder.fail(); f++) {
+    for (int j = 0; j < 3; j++) {
+      guint32 delta = decoder.decode_integer(corner_models[j]);
+      if (delta == 0) {
+        number_of_new_vertices++;
+      }
+      if (number_of_new_vertices > number_of_vertices ||
+          delta > number_of_new_vertices) {
+        cerr << "Error: corrupted compressed mesh facets!" << endl;
+        in.setstate(istream::failbit);
+        return;
+      }
+    }
+  }
+  if (decoder.fail() || points.empty()) {
+    cerr << "Error: truncated compressed mesh!" << endl;
+    in.setstate(istream::failbit);
+    return;
+  }
+  
+  _tetrahedrization.insert_first(points);
+  assert(_tetrahedrization.is_valid());
+}
+
+void
+Tetrahedrization_iostream::_read_xyz(istream& in) {
+  /*
+   * One point per line, as 3 coordinates separated by blanks, the rest of
+   * the line (normals, colors) being skipped. The stream is parsed by
+   * chunks of lines and thinned as it comes, so that only the points kept
+   * are held in memory.
+   */
+  Voxel_grid voxel_grid(_voxel_size, _max_points);
+  Line_reader reader(in);
+  const char *begin = NULL, *end = NULL;
+  unsigned int number_of_points = 0, number_of_errors = 0;
+  while (reader.read(begin, end)) {
+    const char *s = skip_spaces(begin, end);
+    while (s != end) {
+      double x = 0.0, y = 0.0, z = 0.0;
+      if (parse_double(s, end, x) &&
+          parse_double(s = skip_blanks(s, end), end, y) &&
+          parse_double(s = skip_blanks(s, end), end, z)) {
+        voxel_grid.insert(x, y, z);
+        number_of_points++;
+      } else {
+        number_of_errors++;
+      }
+      s = skip_spaces(skip_line(s, end), end);
+    }
+  }
+  cout << number_of_points << " points" << endl;
+  if (number_of_errors > 0) {
+    cerr << "Error: " << number_of_errors << " invalid points!" << endl;
+    in.setstate(istream::failbit);
+    return;
+  }
+  _insert_thinned_points(voxel_grid);
+  if (_tetrahedrization.number_of_vertices() == 0) {
+    in.setstate(istream::failbit);
+  }
+}
+
+void
+Tetrahedrization_iostream::_read_ply(istream& in) {
+  /*
+   * Polygon File Format, as documented by Greg Turk: ASCII or binary of
+   * either byte order. Only the x, y and z properties of vertices are
+   * read, and the elements after vertices, such as faces, are ignored.
+   */
+  string line, word;
+  getline(in, line);
+  if (line.empty() || line.substr(0, 3) != "ply") {
+    cerr << "Error: not a PLY file!" << endl;
+    in.setstate(istream::failbit);
+    return;
+  }
+  string format;
+  unsigned int number_of_vertices = 0;
+  bool is_in_vertex_element = false, has_vertex_element = false;
+  bool is_supported = true;
+  vector<int> sizes;
+  vector<char> kinds;
+  int coordinate_indices[3] = { -1, -1, -1 };
+  while (getline(in, line)) {
+    if (!line.empty() && line[line.size() - 1] == '\r') {
+      line.erase(line.size() - 1);
+    }
+    istringstream words(line);
+    words >> word;
+    if (word == "end_header") {
+      break;
+    } else if (word == "format") {
+      words >> format;
+    } else if (word == "element") {
+      string name;
+      unsigned int count = 0;
+      words >> name >> count;
+      is_in_vertex_element = (name == "vertex");
+      if (is_in_vertex_element) {
+        has_vertex_element = true;
+        number_of_vertices = count;
+      } else if (!has_vertex_element && count > 0) {
+        is_supported = false; // elements before vertices
+      }
+    } else if (word == "property" && is_in_vertex_element) {
+      string type, name;
+      words >> type >> name;
+      int size = 0;
+      char kind = 0;
+      if (type == "list" || !ply_scalar_type(type, size, kind)) {
+        is_supported = false;
+      }
+      for (int j = 0; j < 3; j++) {
+        if (name == string(1, (char) ('x' + j))) {
+          coordinate_indices[j] = sizes.size();
+        }
+      }
+      sizes.push_back(size);
+      kinds.push_back(kind);
+    }
+  }
+  if (in.fail() || !has_vertex_element || !is_supported ||
+      coordinate_indices[0] < 0 || coordinate_indices[1] < 0 ||
+      coordinate_indices[2] < 0 ||
+      (format != "ascii" && format != "binary_little_endian" &&
+       format != "binary_big_endian")) {
+    cerr << "Error: unsupported PLY header!" << endl;
+    in.setstate(istream::failbit);
+    return;
+  }
+  
+  Voxel_grid voxel_grid(_voxel_size, _max_points);
+  unsigned int number_of_points = 0;
+  if (format == "ascii") {
+    Line_reader reader(in);
+    const char *begin = NULL, *end = NULL;
+    while (number_of_points < number_of_vertices &&
+           reader.read(begin, end)) {
+      const char *s = skip_spaces(begin, end);
+      while (s != end && number_of_points < number_of_vertices) {
+        double x[3] = { 0.0, 0.0, 0.0 };
+        for (int i = 0; i < (int) sizes.size(); i++) {
+          double value = 0.0;
+          if (!parse_double(s, end, value)) {
+            cerr << "Error: invalid PLY vertex!" << endl;
+            in.setstate(istream::failbit);
+            return;
+          }
+          s = skip_blanks(s, end);
+          for (int j = 0; j < 3; j++) {
+            if (i == coordinate_indices[j]) x[j] = value;
+          }
+        }
+        voxel_grid.insert(x[0], x[1], x[2]);
+        number_of_points++;
+        s = skip_spaces(skip_line(s, end), end);
+      }
+    }
   } else {
+    const guint32 one = 1;
+    const bool is_little_endian = (*(const char *) &one == 1);
+    const bool is_swapped
+      = (is_little_endian != (format == "binary_little_endian"));
+    int offsets[3] = { 0, 0, 0 };
+    int record_size = 0;
+    for (int i = 0; i < (int) sizes.size(); i++) {
+      for (int j = 0; j < 3; j++) {
+        if (i == coordinate_indices[j]) offsets[j] = record_size;
+      }
+      record_size += sizes[i];
+    }
+    vector<char> chunk(PLY_CHUNK_RECORDS * record_size);
+    while (number_of_points < number_of_vertices) {
+      unsigned int n = min(number_of_vertices - number_of_points,
+                           PLY_CHUNK_RECORDS);
+      in.read(&chunk[0], n * record_size);
+      if (in.gcount() != (streamsize) (n * record_size)) break;
+      for (unsigned int r = 0; r < n; r++) {
+        const char *record = &chunk[r * record_size];
+        double x[3];
+        for (int j = 0; j < 3; j++) {
+          int i = coordinate_indices[j];
+          x[j] = get_ply_scalar(record + offsets[j], sizes[i], kinds[i],
+                                is_swapped);
+        }
+        voxel_grid.insert(x[0], x[1], x[2]);
+      }
+      number_of_points += n;
+    }
+  }
+  cout << number_of_points << " points" << endl;
+  if (number_of_points < number_of_vertices) {
+    cerr << "Error: truncated PLY file!" << endl;
+    in.setstate(istream::failbit);
+    return;
+  }
+  // faces are not read
+  in.clear();
+  _insert_thinned_points(voxel_grid);
+  if (_tetrahedrization.number_of_vertices() == 0) {
     in.setstate(istream::failbit);
   }
-//   CGAL::File_scanner_OFF file_scanner(in, _verbose);
-//   Point p;
-//   file_scan_vertex(file_scanner, p);
-//   _tetrahedrization.insert_first(p);
-//   file_scanner.skip_to_next_vertex(0);
-//   for (int i = 1; i < file_scanner.size_of_vertices() - 1; i++) {
-//     file_scan_vertex(file_scanner, p);
-//     _tetrahedrization.insert(p);
-//     file_scanner.skip_to_next_vertex(i);
-//   }
-//   file_scan_vertex(file_scanner, p);
-//   _tetrahedrization.insert_last(p);
-//   file_scanner.skip_to_next_vertex(file_scanner.size_of_vertices() - 1);
+}
+
+void
+Tetrahedrization_iostream::_insert_thinned_points(
+  const Voxel_grid& voxel_grid) {
+  vector<double> coordinates;
+  voxel_grid.get_points(coordinates);
+  _number_of_points_read = voxel_grid.number_of_points_inserted();
+  _number_of_points_kept = coordinates.size() / 3;
+  _thinning_size = voxel_grid.size();
+  if (_thinning_size > 0.0) {
+    cout << _number_of_points_kept << " of " << _number_of_points_read
+         << " points kept, one per voxel of size " << _thinning_size << endl;
+  }
+  vector<Point> points;
+  points.reserve(coordinates.size() / 3);
+  for (unsigned int i = 0; i < coordinates.size(); i += 3) {
+    points.push_back(Point(coordinates[i],
+                           coordinates[i + 1],
+                           coordinates[i + 2]));
+  }
+  // sorted along a space-filling curve before insertion
+  _tetrahedrization.insert_first(points);
 }
 
 void
@@ -115,62 +1197,232 @@ Tetrahedrization_iostream::_write(ostream& out) const {
 
 void
 Tetrahedrization_iostream::_write_off(ostream& out) const {
-  const unsigned int NULL_INDEX = ~0u;
-  
   /* set surface vertices and facets indices */
   
-  CGAL::Unique_hash_map<Vertex_handle, unsigned int>
-    indices(NULL_INDEX, _tetrahedrization.number_of_surface_vertices());
   vector<Vertex_handle> surface_vertices;
-  vector< CGAL::Triple<unsigned int, unsigned int, unsigned int> >
-    surface_facets;
+  vector<unsigned int> surface_facets;
+  _get_surface(surface_vertices, surface_facets);
+  
+  /* write OFF file */
+  
+  // write header
+  out << "OFF\n";
+  
+  // write number of vertices, facets, edges
+  out << surface_vertices.size() << " "
+      << surface_facets.size() / 3 << " "
+      << 0 << "\n"; // no edge info
+  cout << surface_vertices.size() << " vertices and "
+       << surface_facets.size() / 3 << " faces" << endl;
+  
+  // write vertices coordinates
+  write_lines(out, surface_vertices.size(),
+              Vertex_line_formatter(surface_vertices, out.precision()));
+  
+  // write faces with vertices indices oriented counterclockwise
+  write_lines(out, surface_facets.size() / 3,
+              Facet_line_formatter(surface_facets));
+  out.flush();
+}
+
+void
+Tetrahedrization_iostream::_write_compressed(ostream& out) const {
+  vector<Vertex_handle> surface_vertices;
+  vector<unsigned int> surface_facets;
+  _get_surface(surface_vertices, surface_facets);
+  cout << surface_vertices.size() << " vertices and "
+       << surface_facets.size() / 3 << " faces" << endl;
+  
+  /* renumber vertices in order of first use along the facet traversal */
+  
+  // a corner is coded as 0 for a new vertex, else as the distance to the
+  // last new vertex
+  vector<unsigned int> order;
+  traverse_facets(surface_facets, order);
+  vector<unsigned int> new_indices(surface_vertices.size(), NULL_INDEX);
+  vector<unsigned int> vertices_in_order;
+  vertices_in_order.reserve(surface_vertices.size());
+  vector<guint32> corners;
+  corners.reserve(surface_facets.size());
+  for (unsigned int q = 0; q < order.size(); q++) {
+    for (int j = 0; j < 3; j++) {
+      unsigned int index = surface_facets[3*order[q] + j];
+      if (new_indices[index] == NULL_INDEX) {
+        new_indices[index] = vertices_in_order.size();
+        vertices_in_order.push_back(index);
+        corners.push_back(0);
+      } else {
+        corners.push_back(vertices_in_order.size() - new_indices[index]);
+      }
+    }
+  }
+  
+  /* quantize positions */
+  
+  // bounds are those of the surface vertices, since the tetrahedrization
+  // bounding box is not shrunk on removal
+  float bounds[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+  for (unsigned int i = 0; i < vertices_in_order.size(); i++) {
+    const Point& p = surface_vertices[vertices_in_order[i]]->point();
+    for (int j = 0; j < 3; j++) {
+      if (i == 0 || p[j] < bounds[j]) bounds[j] = p[j];
+      if (i == 0 || p[j] > bounds[3 + j]) bounds[3 + j] = p[j];
+    }
+  }
+  const gint32 q_max = (1 << _quantization_bits) - 1;
+  
+  /* write compressed mesh */
+  
+  out.write(COMPRESSED_MAGIC, sizeof(COMPRESSED_MAGIC));
+  Range_encoder encoder(out);
+  encoder.encode_bits(COMPRESSED_VERSION, 8);
+  encoder.encode_bits(_quantization_bits, 5);
+  for (int i = 0; i < 6; i++) {
+    encoder.encode_bits(float_bits(bounds[i]), 32);
+  }
+  encoder.encode_bits(vertices_in_order.size(), 32);
+  encoder.encode_bits(surface_facets.size() / 3, 32);
+  
+  Range_integer_model position_models[3];
+  gint32 q_previous[3] = { 0, 0, 0 };
+  for (unsigned int i = 0; i < vertices_in_order.size(); i++) {
+    const Point& p = surface_vertices[vertices_in_order[i]]->point();
+    for (int j = 0; j < 3; j++) {
+      double extent = bounds[3 + j] - bounds[j];
+      gint32 q = (extent > 0.0)
+        ? (gint32) floor((p[j] - bounds[j]) / extent * q_max + 0.5) : 0;
+      q = max(0, min(q, q_max));
+      encoder.encode_signed_integer(position_models[j], q - q_previous[j]);
+      q_previous[j] = q;
+    }
+  }
+  
+  Range_integer_model corner_models[3];
+  for (unsigned int c = 0; c < corners.size(); c++) {
+    encoder.encode_integer(corner_models[c%3], corners[c]);
+  }
+  encoder.flush();
+  out.flush();
+}
+
+void
+Tetrahedrization_iostream::_write_ply(ostream& out) const {
+  vector<Vertex_handle> surface_vertices;
+  vector<unsigned int> surface_facets;
+  _get_surface(surface_vertices, surface_facets);
+  vector<GLfloat> normals;
+  _get_normals(surface_vertices, normals);
+  cout << surface_vertices.size() << " vertices and "
+       << surface_facets.size() / 3 << " faces" << endl;
+  
+  out << "ply\n"
+      << "format binary_little_endian 1.0\n"
+      << "comment relief surface\n"
+      << "element vertex " << surface_vertices.size() << "\n"
+      << "property float x\n"
+      << "property float y\n"
+      << "property float z\n"
+      << "property float nx\n"
+      << "property float ny\n"
+      << "property float nz\n"
+      << "element face " << surface_facets.size() / 3 << "\n"
+      << "property list uchar int vertex_indices\n"
+      << "end_header\n";
+  write_lines(out, surface_vertices.size(),
+              Ply_vertex_formatter(surface_vertices, normals));
+  write_lines(out, surface_facets.size() / 3,
+              Ply_face_formatter(surface_facets));
+  out.flush();
+}
+
+void
+Tetrahedrization_iostream::_write_stl(ostream& out) const {
+  vector<Vertex_handle> surface_vertices;
+  vector<unsigned int> surface_facets;
+  _get_surface(surface_vertices, surface_facets);
+  cout << surface_facets.size() / 3 << " faces" << endl;
+  
+  // the header must not start with "solid", which announces ASCII STL
+  char header[STL_HEADER_SIZE + 4];
+  memset(header, ' ', STL_HEADER_SIZE);
+  memcpy(header, "relief surface", strlen("relief surface"));
+  put_uint32(header + STL_HEADER_SIZE, surface_facets.size() / 3);
+  out.write(header, sizeof(header));
+  write_lines(out, surface_facets.size() / 3,
+              Stl_facet_formatter(surface_vertices, surface_facets));
+  out.flush();
+}
+
+void
+Tetrahedrization_iostream::_write_obj(ostream& out) const {
+  vector<Vertex_handle> surface_vertices;
+  vector<unsigned int> surface_facets;
+  _get_surface(surface_vertices, surface_facets);
+  vector<GLfloat> normals;
+  _get_normals(surface_vertices, normals);
+  vector<GLfloat> coordinates;
+  coordinates.reserve(3 * surface_vertices.size());
+  for (unsigned int i = 0; i < surface_vertices.size(); i++) {
+    const Point& p = surface_vertices[i]->point();
+    coordinates.push_back(p.x());
+    coordinates.push_back(p.y());
+    coordinates.push_back(p.z());
+  }
+  cout << surface_vertices.size() << " vertices and "
+       << surface_facets.size() / 3 << " faces" << endl;
+  
+  out << "# relief surface\n";
+  write_lines(out, surface_vertices.size(),
+              Obj_vector_formatter("v", coordinates, out.precision()));
+  write_lines(out, surface_vertices.size(),
+              Obj_vector_formatter("vn", normals, out.precision()));
+  write_lines(out, surface_facets.size() / 3,
+              Obj_face_formatter(surface_facets));
+  out.flush();
+}
+
+void
+Tetrahedrization_iostream::_get_surface(
+  vector<Vertex_handle>& surface_vertices,
+  vector<unsigned int>& surface_facets) const {
+  // vertex IDs are dense, so indices are looked up in a plain array
+  vector<unsigned int> indices(_tetrahedrization.number_of_vertex_ids(),
+                               NULL_INDEX);
   for (All_cells_iterator ci = _tetrahedrization.all_cells_begin();
        ci != _tetrahedrization.all_cells_end(); ci++) {
     for (int i = 0; i < 4; i++) {
       if (ci->is_surface_facet(i)) {
         Facet f(ci, i);
-        unsigned int facet_indices[3];
         unsigned int k = (f.second + 1)%4;
         for (int j = 0; j < 3; j++) {
           Vertex_handle vh = f.first->vertex(k);
           assert(!_tetrahedrization.is_infinite(vh));
-          if (indices[vh] == NULL_INDEX) {
-            indices[vh] = surface_vertices.size();
+          assert(vh->id() < indices.size());
+          unsigned int& index = indices[vh->id()];
+          if (index == NULL_INDEX) {
+            index = surface_vertices.size();
             surface_vertices.push_back(vh);
           }
-          facet_indices[j] = indices[vh];
+          surface_facets.push_back(index);
           k = Tetrahedrization::next_around_edge(k, f.second);
         }
-        surface_facets.push_back(CGAL::make_triple(facet_indices[0],
-                                                   facet_indices[1],
-                                                   facet_indices[2]));
       }
     }
   }
-  
-  /* write OFF file */
-  
-  // write header
-  out << "OFF" << endl;
-  
-  // write number of vertices, facets, edges
-  out << surface_vertices.size() << " "
-      << surface_facets.size() << " "
-      << 0 << endl; // no edge info
-  cout << surface_vertices.size() << " vertices and "
-       << surface_facets.size() << " faces" << endl;
-  
-  // write vertices coordinates
-  for (vector<Vertex_handle>::const_iterator vhi = surface_vertices.begin();
-       vhi != surface_vertices.end(); vhi++) {
-    out << **vhi << endl;
-  }
-  
-  // write faces with vertices indices oriented counterclockwise
-  for (vector< CGAL::Triple<unsigned int, unsigned int,
-         unsigned int> >::const_iterator ti = surface_facets.begin();
-       ti != surface_facets.end(); ti++) {
-    out << "3 " << ti->first << " " << ti->second << " " << ti->third
-        << endl;
+}
+
+void
+Tetrahedrization_iostream::_get_normals(
+  const vector<Vertex_handle>& surface_vertices,
+  vector<GLfloat>& normals) const {
+  // computed serially, since TDS traversals are not thread safe, so that
+  // records can then be formatted in parallel
+  normals.clear();
+  normals.reserve(3 * surface_vertices.size());
+  for (unsigned int i = 0; i < surface_vertices.size(); i++) {
+    Vector n = _tetrahedrization.approximate_normal(surface_vertices[i]);
+    normals.push_back(n.x());
+    normals.push_back(n.y());
+    normals.push_back(n.z());
   }
 }
@@ -3,17 +3,37 @@
 
 #include "tetrahedrization.hh"
 
+class Voxel_grid;
+
 class Tetrahedrization_iostream {
 public:
   typedef enum {
     DEFAULT,
-    OFF
+    OFF,
+    COMPRESSED, // quantized, delta and range coded surface
+    PLY,        // binary surface written, vertices read as a point cloud
+    STL,        // binary, write only
+    OBJ,        // with vertex normals, write only
+    XYZ         // point cloud, read only
   } Format;
   
   Tetrahedrization_iostream(Tetrahedrization& tetrahedrization,
                             Format format = DEFAULT,
                             bool verbose = false);
   ~Tetrahedrization_iostream(void);
+  // OFF files are memory mapped instead of going through a stream
+  bool read(const char *name);
+  // bit depth of compressed positions, relative to the surface bounding box
+  void set_quantization_bits(int bits);
+  // point clouds are streamed through a Voxel_grid of this initial size,
+  // a zero size thinning them only beyond the maximum number of points
+  void set_thinning(double voxel_size, unsigned int max_points);
+  static unsigned int default_max_points(void);
+  // points of the last point cloud read, and points kept once thinned
+  // with voxels of the given size, zero when it was not thinned
+  unsigned int number_of_points_read(void) const;
+  unsigned int number_of_points_kept(void) const;
+  double thinning_size(void) const;
   friend std::istream& operator>>(std::istream& in,
                                   Tetrahedrization_iostream& tin);
   friend std::ostream& operator<<(std::ostream& out,
@@ -22,6 +42,7 @@ public:
 private:
   typedef Tetrahedrization::Geom_traits::Kernel::FT FT;
   typedef Tetrahedrization::Point Point;
+  typedef Tetrahedrization::Geom_traits::Kernel::Vector_3 Vector;
   typedef Tetrahedrization::Facet Facet;
   typedef Tetrahedrization::Vertex_handle Vertex_handle;
   typedef Tetrahedrization::Finite_vertices_iterator Finite_vertices_iterator;
@@ -29,12 +50,31 @@ private:
   
   void _read(std::istream& in);
   void _read_off(std::istream& in);
+  bool _read_off(const char *begin, const char *end);
   void _write(std::ostream& out) const;
+  void _read_compressed(std::istream& in);
+  void _read_xyz(std::istream& in);
+  void _read_ply(std::istream& in);
+  void _insert_thinned_points(const Voxel_grid& voxel_grid);
   void _write_off(std::ostream& out) const;
+  void _write_compressed(std::ostream& out) const;
+  void _write_ply(std::ostream& out) const;
+  void _write_stl(std::ostream& out) const;
+  void _write_obj(std::ostream& out) const;
+  // surface facets are given by 3 indices into surface vertices each
+  void _get_surface(std::vector<Vertex_handle>& surface_vertices,
+                    std::vector<unsigned int>& surface_facets) const;
+  void _get_normals(const std::vector<Vertex_handle>& surface_vertices,
+                    std::vector<GLfloat>& normals) const;
   
   Tetrahedrization& _tetrahedrization;
   Format _format;
   bool _verbose;
+  int _quantization_bits;
+  double _voxel_size;
+  unsigned int _max_points;
+  unsigned int _number_of_points_read, _number_of_points_kept;
+  double _thinning_size;
 };
 
 #endif // __TETRAHEDRIZATION_IOSTREAM_HH__
@@ -0,0 +1,159 @@
+#include <cassert>
+
+#include "tiled_texture.hh"
+
+using namespace std;
+
+Tiled_texture::Tiled_texture(GLenum internal_format, bool is_sparse)
+  : _internal_format(internal_format),
+    _is_sparse(is_sparse),
+    _number_of_columns(0),
+    _number_of_rows(0),
+    _tiles(),
+    _blank_tile(0),
+    _number_of_tiles(0) {
+  gl_veci_eq(_viewport, GL_VECI_NULL);
+  _blank_color[0] = _blank_color[1] = _blank_color[2] = 0;
+}
+
+Tiled_texture::~Tiled_texture(void) {
+  clear();
+}
+
+void
+Tiled_texture::reset(const GLveci viewport) {
+  clear();
+  gl_veci_eq(_viewport, viewport);
+  _number_of_columns = (viewport[2] + TILE_SIZE - 1) / TILE_SIZE;
+  _number_of_rows = (viewport[3] + TILE_SIZE - 1) / TILE_SIZE;
+  _tiles.assign(_number_of_columns * _number_of_rows, 0);
+  if (_is_sparse) {
+    // the viewport has just been cleared
+    glPushClientAttrib(GL_CLIENT_PIXEL_STORE_BIT);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(viewport[0], viewport[1], 1, 1,
+                 GL_RGB, GL_UNSIGNED_BYTE, _blank_color);
+    glPopClientAttrib();
+    _blank_tile = _new_tile(true);
+  } else {
+    for (int j = 0; j < _number_of_rows; j++) {
+      for (int i = 0; i < _number_of_columns; i++) {
+        GLveci quadi;
+        tile_quad(i, j, quadi);
+        copy(i, j, quadi);
+      }
+    }
+  }
+}
+
+void
+Tiled_texture::clear(void) {
+  for (vector<GLuint>::iterator ti = _tiles.begin(); ti != _tiles.end();
+       ti++) {
+    if (*ti != 0) {
+      glDeleteTextures(1, &(*ti));
+    }
+  }
+  _tiles.clear();
+  if (_blank_tile != 0) {
+    glDeleteTextures(1, &_blank_tile);
+    _blank_tile = 0;
+  }
+  _number_of_tiles = 0;
+}
+
+void
+Tiled_texture::tile_range(const GLveci quadi, GLveci range) const {
+  range[0] = scali_clamp((quadi[0] - _viewport[0]) / TILE_SIZE,
+                         0, _number_of_columns);
+  range[1] = scali_clamp((quadi[1] - _viewport[1]) / TILE_SIZE,
+                         0, _number_of_rows);
+  range[2] = scali_clamp((quadi[2] - _viewport[0] + TILE_SIZE - 1)
+                         / TILE_SIZE, 0, _number_of_columns);
+  range[3] = scali_clamp((quadi[3] - _viewport[1] + TILE_SIZE - 1)
+                         / TILE_SIZE, 0, _number_of_rows);
+}
+
+void
+Tiled_texture::tile_quad(int i, int j, GLveci quadi) const {
+  assert(i >= 0 && i < _number_of_columns &&
+         j >= 0 && j < _number_of_rows);
+  quadi[0] = _viewport[0] + i * TILE_SIZE;
+  quadi[1] = _viewport[1] + j * TILE_SIZE;
+  quadi[2] = scali_min(quadi[0] + TILE_SIZE, _viewport[0] + _viewport[2]);
+  quadi[3] = scali_min(quadi[1] + TILE_SIZE, _viewport[1] + _viewport[3]);
+}
+
+void
+Tiled_texture::tile_tex_coords(int i, int j, const GLveci quadi,
+                               GLvecf quadf) const {
+  GLint x = _viewport[0] + i * TILE_SIZE;
+  GLint y = _viewport[1] + j * TILE_SIZE;
+  quadf[0] = (GLfloat) (quadi[0] - x) / (GLfloat) TILE_SIZE;
+  quadf[1] = (GLfloat) (quadi[1] - y) / (GLfloat) TILE_SIZE;
+  quadf[2] = (GLfloat) (quadi[2] - x) / (GLfloat) TILE_SIZE;
+  quadf[3] = (GLfloat) (quadi[3] - y) / (GLfloat) TILE_SIZE;
+}
+
+void
+Tiled_texture::bind(int i, int j) const {
+  GLuint tile = _tiles[j * _number_of_columns + i];
+  glBindTexture(GL_TEXTURE_2D, (tile != 0) ? tile : _blank_tile);
+}
+
+void
+Tiled_texture::copy(int i, int j, const GLveci quadi) {
+  GLuint& tile = _tiles[j * _number_of_columns + i];
+  if (tile == 0) {
+    tile = _new_tile(_is_sparse);
+    _number_of_tiles++;
+  }
+  glBindTexture(GL_TEXTURE_2D, tile);
+  
+  GLveci tile_quadi;
+  tile_quad(i, j, tile_quadi);
+  GLint x0 = scali_max(quadi[0], tile_quadi[0]);
+  GLint y0 = scali_max(quadi[1], tile_quadi[1]);
+  GLint x1 = scali_min(quadi[2], tile_quadi[2]);
+  GLint y1 = scali_min(quadi[3], tile_quadi[3]);
+  if (x0 < x1 && y0 < y1) {
+    glCopyTexSubImage2D(GL_TEXTURE_2D, 0,
+                        x0 - tile_quadi[0], y0 - tile_quadi[1],
+                        x0, y0, x1 - x0, y1 - y0);
+  }
+}
+
+unsigned int
+Tiled_texture::number_of_tiles(void) const {
+  return _number_of_tiles;
+}
+
+GLuint
+Tiled_texture::_new_tile(bool is_blank) const {
+  vector<GLubyte> pixels;
+  if (is_blank) {
+    pixels.resize(3 * TILE_SIZE * TILE_SIZE);
+    for (unsigned int k = 0; k < pixels.size(); k++) {
+      pixels[k] = _blank_color[k % 3];
+    }
+  }
+  GLuint tile = 0;
+  glGenTextures(1, &tile);
+  assert(tile != 0);
+  glBindTexture(GL_TEXTURE_2D, tile);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  
+  // blank pixels were read through the pixel transfer state already
+  glPushAttrib(GL_PIXEL_MODE_BIT);
+  glPushClientAttrib(GL_CLIENT_PIXEL_STORE_BIT);
+  glDisable(GL_COLOR_TABLE);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glTexImage2D(GL_TEXTURE_2D, 0, _internal_format, TILE_SIZE, TILE_SIZE, 0,
+               GL_RGB, GL_UNSIGNED_BYTE, is_blank ? &pixels[0] : NULL);
+  glPopClientAttrib();
+  glPopAttrib();
+  return tile;
+}
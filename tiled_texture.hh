@@ -0,0 +1,52 @@
+#ifndef __TILED_TEXTURE_HH__
+#define __TILED_TEXTURE_HH__
+
+#include <vector>
+#include <opengl_utils.h>
+
+/*
+ * Copy of a viewport of the frame buffer, cut in square tiles so that the
+ * viewport may have any size. A sparse texture allocates a tile the first
+ * time a region inside it is copied, the tiles never copied sharing a
+ * single blank tile, so that its memory grows with the area drawn.
+ * Quads are given by their corners, in window coordinates.
+ */
+class Tiled_texture {
+public:
+  static const int TILE_SIZE = 256;
+  
+  Tiled_texture(GLenum internal_format, bool is_sparse);
+  ~Tiled_texture(void);
+  // copies the viewport from the read buffer, through the current pixel
+  // transfer state, the viewport origin only when sparse
+  void reset(const GLveci viewport);
+  void clear(void);
+  // first and past the last column and row of the tiles overlapping quadi
+  void tile_range(const GLveci quadi, GLveci range) const;
+  // corners of the tile, clipped by the viewport
+  void tile_quad(int i, int j, GLveci quadi) const;
+  // texture coordinates of quadi, a part of the tile
+  void tile_tex_coords(int i, int j, const GLveci quadi,
+                       GLvecf quadf) const;
+  // to the active texture unit
+  void bind(int i, int j) const;
+  // copies the part of quadi inside the tile from the read buffer, through
+  // the current pixel transfer state, and binds the tile
+  void copy(int i, int j, const GLveci quadi);
+  unsigned int number_of_tiles(void) const;
+  
+private:
+  // left undefined unless blank
+  GLuint _new_tile(bool is_blank) const;
+  
+  GLenum _internal_format;
+  bool _is_sparse;
+  GLveci _viewport;
+  int _number_of_columns, _number_of_rows;
+  std::vector<GLuint> _tiles; // 0 when blank
+  GLuint _blank_tile;
+  GLubyte _blank_color[3];
+  unsigned int _number_of_tiles;
+};
+
+#endif // __TILED_TEXTURE_HH__
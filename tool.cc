@@ -8,25 +8,16 @@ static const Kernel::FT SQUARED_DISTANCE_MIN = Kernel::FT(16.0);
 static const Kernel::FT FOUR_TIMES_SQUARED_DISTANCE_MIN
   = Kernel::FT(4.0) * SQUARED_DISTANCE_MIN;
 
-Tool::Tool(Toolbox *toolbox, GLboolean (*display_list_cb)(void *, GLboolean))
+Tool::Tool(Toolbox *toolbox)
   : _toolbox(toolbox),
     _button(NULL),
     _points(),
     _points_buf(),
     _is_path_interpolated(false) {
   gl_veci_eq(_drawport, GL_VECI_NULL);
-  _list = gl_list_new();
-  gl_list_set(_list, display_list_cb, (void *) this, GL_FALSE);
 }
 
-Tool::~Tool(void) {
-  gl_list_delete(_list);
-}
-
-void
-Tool::clear(void) {
-  gl_list_clear(_list);
-}
+Tool::~Tool(void) {}
 
 void
 Tool::set_button(GtkWidget *button) {
@@ -81,7 +72,44 @@ Tool::recorded_path(void) const {
   return _points_buf;
 }
 
+void
+Tool::record_samples(GdkInputSource source,
+                     const vector<Sample>& samples) {
+  for (vector<Sample>::const_iterator si = samples.begin();
+       si != samples.end(); si++) {
+    record_path(source, si->x, si->y, si->pressure, si->xtilt, si->ytilt);
+  }
+}
+
+void
+Tool::draw_samples(GdkInputSource source, const vector<Sample>& samples) {
+  GLveci port;
+  gl_veci_eq(port, GL_VECI_NULL);
+  for (vector<Sample>::const_iterator si = samples.begin();
+       si != samples.end(); si++) {
+    draw_pixels(source, si->x, si->y, si->pressure, si->xtilt, si->ytilt);
+    _unite_ports(port, _drawport);
+  }
+  gl_veci_eq(_drawport, port);
+}
+
 const_GLveci_t
 Tool::drawn_pixels(void) const {
   return _drawport;
 }
+
+void
+Tool::_unite_ports(GLveci port, const GLveci other) {
+  if (other[2] <= 0 || other[3] <= 0) {
+    return;
+  } else if (port[2] <= 0 || port[3] <= 0) {
+    gl_veci_eq(port, other);
+    return;
+  }
+  GLint x1 = scali_max(port[0] + port[2], other[0] + other[2]);
+  GLint y1 = scali_max(port[1] + port[3], other[1] + other[3]);
+  port[0] = scali_min(port[0], other[0]);
+  port[1] = scali_min(port[1], other[1]);
+  port[2] = x1 - port[0];
+  port[3] = y1 - port[1];
+}
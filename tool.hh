@@ -10,10 +10,13 @@
 class Tool {
 public:
   typedef Kernel::Point_2 Point;
+  typedef struct {
+    gdouble x, y, pressure, xtilt, ytilt;
+  } Sample;
   
-  Tool(Toolbox *toolbox, GLboolean (*display_list_cb)(void *, GLboolean));
+  Tool(Toolbox *toolbox);
   virtual ~Tool(void);
-  virtual void clear(void);
+  virtual const char *name(void) const = 0;
   virtual void set_button(GtkWidget *button);
   virtual void active_button(gboolean is_active) const;
   virtual void start_recording_path(GdkInputSource source,
@@ -31,18 +34,27 @@ public:
   virtual void draw_pixels(GdkInputSource source,
                            gdouble x, gdouble y, gdouble pressure,
                            gdouble xtilt, gdouble ytilt) = 0;
+  // motion coalesced since the last frame, recorded and drawn sample by
+  // sample unless overridden
+  virtual void record_samples(GdkInputSource source,
+                              const std::vector<Sample>& samples);
+  virtual void draw_samples(GdkInputSource source,
+                            const std::vector<Sample>& samples);
+  // port of the pixels changed since the last call to a drawing method
   virtual const_GLveci_t drawn_pixels(void) const;
   
 protected:
   typedef Kernel::FT FT;
   typedef Kernel::Vector_2 Vector;
   
+  // port enlarged to contain the other one, empty ports being ignored
+  static void _unite_ports(GLveci port, const GLveci other);
+  
   Toolbox *_toolbox;
   GtkWidget *_button;
   std::vector<Point> _points, _points_buf;
   bool _is_path_interpolated;
   GLveci _drawport;
-  GLlist *_list;
 };
 
 #endif // __TOOL_HH__
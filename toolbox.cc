@@ -1,6 +1,7 @@
 #include <cassert>
 
 #include "images.h"
+#include "resources.hh"
 #include "application.hh"
 #include "file.hh"
 #include "pencil_tool.hh"
@@ -11,13 +12,14 @@
 #include "frisket_tool.hh"
 #include "burnisher_tool.hh"
 #include "scraper_tool.hh"
-#include "tool_texture.hh"
+#include "canvas.hh"
 #include "toolbox.hh"
 
 using namespace std;
 
 static const guint16 G_MAXUINT16 = 65535;
 static const unsigned int TOOL_TYPE_SIZE = 8u;
+static const gchar *TITLE = "Relief";
 
 Toolbox::Toolbox(Application *application)
   : _application(application),
@@ -25,7 +27,7 @@ Toolbox::Toolbox(Application *application)
     _stylus_pen_tool(NULL),
     _stylus_eraser_tool(NULL),
     _tools(TOOL_TYPE_SIZE, (Tool *) 0),
-    _tool_texture(NULL),
+    _canvas(NULL),
     _window(NULL),
     _toggle_black_color(false) {
   _core_pointer_tool = _tool(_PENCIL_TOOL);
@@ -44,8 +46,8 @@ Toolbox::~Toolbox(void) {
       delete pt;
     }
   }
-  if (_tool_texture != NULL) {
-    delete _tool_texture;
+  if (_canvas != NULL) {
+    delete _canvas;
   }
   if (GTK_IS_WIDGET(_window)) {
     gtk_widget_destroy(_window);
@@ -54,15 +56,8 @@ Toolbox::~Toolbox(void) {
 
 void
 Toolbox::clear(void) {
-  for (vector<Tool *>::iterator pti = _tools.begin();
-       pti != _tools.end(); pti++) {
-    Tool *pt(*pti);
-    if (pt != NULL) {
-      pt->clear();
-    }
-  }
-  if (_tool_texture != NULL) {
-    _tool_texture->clear();
+  if (_canvas != NULL) {
+    _canvas->clear();
   }
 }
 
@@ -84,13 +79,13 @@ Toolbox::stylus_eraser_tool(void) {
   return _stylus_eraser_tool;
 }
 
-Tool_texture *
-Toolbox::tool_texture(void) {
-  if (_tool_texture == NULL) {
-    _tool_texture = new Tool_texture();
-    assert(_tool_texture != NULL);
+Canvas *
+Toolbox::canvas(void) {
+  if (_canvas == NULL) {
+    _canvas = new Canvas();
+    assert(_canvas != NULL);
   }
-  return _tool_texture;
+  return _canvas;
 }
 
 const_GLvecf_t
@@ -132,6 +127,18 @@ Toolbox::sync(GdkInputSource source) {
   }
 }
 
+void
+Toolbox::set_status(const gchar *status) {
+  if (_window == NULL) return;
+  if (status == NULL) {
+    gtk_window_set_title(GTK_WINDOW(_window), TITLE);
+  } else {
+    gchar *title = g_strdup_printf("%s - %s", TITLE, status);
+    gtk_window_set_title(GTK_WINDOW(_window), title);
+    g_free(title);
+  }
+}
+
 void
 Toolbox::_item_factory_file_cb(Toolbox *toolbox, guint action,
                                GtkWidget *widget) {
@@ -145,6 +152,15 @@ Toolbox::_item_factory_file_cb(Toolbox *toolbox, guint action,
   case _FILE_IMPORT_OFF:
     toolbox->_application->file()->open(File::OFF);
     break;
+  case _FILE_IMPORT_RLM:
+    toolbox->_application->file()->open(File::RLM);
+    break;
+  case _FILE_IMPORT_PLY:
+    toolbox->_application->file()->open(File::PLY);
+    break;
+  case _FILE_IMPORT_XYZ:
+    toolbox->_application->file()->open(File::XYZ);
+    break;
   case _FILE_SAVE:
     toolbox->_application->file()->save();
     break;
@@ -154,6 +170,18 @@ Toolbox::_item_factory_file_cb(Toolbox *toolbox, guint action,
   case _FILE_EXPORT_OFF:
     toolbox->_application->file()->save_as(File::OFF);
     break;
+  case _FILE_EXPORT_RLM:
+    toolbox->_application->file()->save_as(File::RLM);
+    break;
+  case _FILE_EXPORT_PLY:
+    toolbox->_application->file()->save_as(File::PLY);
+    break;
+  case _FILE_EXPORT_STL:
+    toolbox->_application->file()->save_as(File::STL);
+    break;
+  case _FILE_EXPORT_OBJ:
+    toolbox->_application->file()->save_as(File::OBJ);
+    break;
   case _FILE_CLOSE:
     toolbox->_application->file()->close();
     break;
@@ -382,12 +410,23 @@ Toolbox::_create_window(void) {
     {"/File/_Open",       "<CTRL>O", f,    _FILE_OPEN,       "<Item>"},
 #endif
     {"/File/_Import OFF", "<CTRL>I", f,    _FILE_IMPORT_OFF, "<Item>"},
+    {"/File/Import compressed mesh",
+                          NULL,      f,    _FILE_IMPORT_RLM, "<Item>"},
+    {"/File/Import PLY point cloud",
+                          NULL,      f,    _FILE_IMPORT_PLY, "<Item>"},
+    {"/File/Import XYZ point cloud",
+                          NULL,      f,    _FILE_IMPORT_XYZ, "<Item>"},
 #if DEBUG // still under development
     {"/File/Separator1",  NULL,      NULL, 0,                "<Separator>"},
     {"/File/_Save",       "<CTRL>S", f,    _FILE_SAVE,       "<Item>"},
     {"/File/Save _As",    "<CTRL>A", f,    _FILE_SAVE_AS,    "<Item>"},
 #endif
     {"/File/_Export OFF", "<CTRL>E", f,    _FILE_EXPORT_OFF, "<Item>"},
+    {"/File/Export compressed mesh",
+                          NULL,      f,    _FILE_EXPORT_RLM, "<Item>"},
+    {"/File/Export PLY",  NULL,      f,    _FILE_EXPORT_PLY, "<Item>"},
+    {"/File/Export STL",  NULL,      f,    _FILE_EXPORT_STL, "<Item>"},
+    {"/File/Export OBJ",  NULL,      f,    _FILE_EXPORT_OBJ, "<Item>"},
     {"/File/Separator2",  NULL,      NULL, 0,                "<Separator>"},
     {"/File/Close",       "<CTRL>W", f,    _FILE_CLOSE,      "<Item>"},
     {"/File/_Quit",       "<CTRL>Q", f,    _FILE_QUIT,       "<Item>"},
@@ -402,7 +441,7 @@ Toolbox::_create_window(void) {
   int nitems = sizeof(items) / sizeof(GtkItemFactoryEntry);
   
   GtkWidget *window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
-  gtk_window_set_title(GTK_WINDOW(window), "Relief");
+  gtk_window_set_title(GTK_WINDOW(window), TITLE);
   gtk_container_set_border_width(GTK_CONTAINER(window), 0);
   g_signal_connect(G_OBJECT(window), "delete_event",
                    G_CALLBACK(_delete_event_cb), this);
@@ -438,7 +477,7 @@ Toolbox::_create_window(void) {
   
   vector<GtkWidget *> buttons(_tools.size(), (GtkWidget *) 0);
   
-  GtkWidget *pencil_image = gtk_image_new_from_file("xpm/pencil.xpm");
+  GtkWidget *pencil_image = Resources::new_image("xpm/pencil.xpm");
   GtkWidget *pencil_button
     = gtk_radio_button_new(NULL);
   gtk_toggle_button_set_mode(GTK_TOGGLE_BUTTON(pencil_button), FALSE);
@@ -451,7 +490,7 @@ Toolbox::_create_window(void) {
   gtk_tooltips_set_tip(tooltips, pencil_button, "Pencil", NULL);
   buttons[_PENCIL_TOOL] = pencil_button;
   
-  GtkWidget *quill_image = gtk_image_new_from_file("xpm/quill.xpm");
+  GtkWidget *quill_image = Resources::new_image("xpm/quill.xpm");
   GtkWidget *quill_button
     = gtk_radio_button_new_from_widget(GTK_RADIO_BUTTON(pencil_button));
   gtk_toggle_button_set_mode(GTK_TOGGLE_BUTTON(quill_button), FALSE);
@@ -464,7 +503,7 @@ Toolbox::_create_window(void) {
   gtk_tooltips_set_tip(tooltips, quill_button, "Quill", NULL);
   buttons[_QUILL_TOOL] = quill_button;
   
-  GtkWidget *brush_image = gtk_image_new_from_file("xpm/brush.xpm");
+  GtkWidget *brush_image = Resources::new_image("xpm/brush.xpm");
   GtkWidget *brush_button
     = gtk_radio_button_new_from_widget(GTK_RADIO_BUTTON(pencil_button));
   gtk_toggle_button_set_mode(GTK_TOGGLE_BUTTON(brush_button), FALSE);
@@ -477,7 +516,7 @@ Toolbox::_create_window(void) {
   gtk_tooltips_set_tip(tooltips, brush_button, "Brush", NULL);
   buttons[_BRUSH_TOOL] = brush_button;
   
-  GtkWidget *smudge_image = gtk_image_new_from_file("xpm/smudge.xpm");
+  GtkWidget *smudge_image = Resources::new_image("xpm/smudge.xpm");
   GtkWidget *smudge_button
     = gtk_radio_button_new_from_widget(GTK_RADIO_BUTTON(pencil_button));
   gtk_toggle_button_set_mode(GTK_TOGGLE_BUTTON(smudge_button), FALSE);
@@ -490,7 +529,7 @@ Toolbox::_create_window(void) {
   gtk_tooltips_set_tip(tooltips, smudge_button, "Smudge", NULL);
   buttons[_SMUDGE_TOOL] = smudge_button;
   
-  GtkWidget *eraser_image = gtk_image_new_from_file("xpm/eraser.xpm");
+  GtkWidget *eraser_image = Resources::new_image("xpm/eraser.xpm");
   GtkWidget *eraser_button
     = gtk_radio_button_new_from_widget(GTK_RADIO_BUTTON(pencil_button));
   gtk_toggle_button_set_mode(GTK_TOGGLE_BUTTON(eraser_button), FALSE);
@@ -528,7 +567,7 @@ Toolbox::_create_window(void) {
   color.green = (guint16) _foreground_color[2] * G_MAXUINT16;
   gtk_widget_modify_bg(drawing_area, GTK_STATE_NORMAL, &color);
   
-  GtkWidget *frisket_image = gtk_image_new_from_file("xpm/frisket.xpm");
+  GtkWidget *frisket_image = Resources::new_image("xpm/frisket.xpm");
   GtkWidget *frisket_button
     = gtk_radio_button_new_from_widget(GTK_RADIO_BUTTON(pencil_button));
   gtk_toggle_button_set_mode(GTK_TOGGLE_BUTTON(frisket_button), FALSE);
@@ -541,7 +580,7 @@ Toolbox::_create_window(void) {
   gtk_tooltips_set_tip(tooltips, frisket_button, "Frisket", NULL);
   buttons[_FRISKET_TOOL] = frisket_button;
   
-  GtkWidget *burnisher_image = gtk_image_new_from_file("xpm/burnisher.xpm");
+  GtkWidget *burnisher_image = Resources::new_image("xpm/burnisher.xpm");
   GtkWidget *burnisher_button
     = gtk_radio_button_new_from_widget(GTK_RADIO_BUTTON(pencil_button));
   gtk_toggle_button_set_mode(GTK_TOGGLE_BUTTON(burnisher_button), FALSE);
@@ -554,7 +593,7 @@ Toolbox::_create_window(void) {
   gtk_tooltips_set_tip(tooltips, burnisher_button, "Burnisher", NULL);
   buttons[_BURNISHER_TOOL] = burnisher_button;
   
-  GtkWidget *scraper_image = gtk_image_new_from_file("xpm/scraper.xpm");
+  GtkWidget *scraper_image = Resources::new_image("xpm/scraper.xpm");
   GtkWidget *scraper_button
     = gtk_radio_button_new_from_widget(GTK_RADIO_BUTTON(pencil_button));
   gtk_toggle_button_set_mode(GTK_TOGGLE_BUTTON(scraper_button), FALSE);
@@ -7,8 +7,8 @@
 #include <vector>
 
 class Application;
+class Canvas;
 class Tool;
-class Tool_texture;
 
 class Toolbox {
 public:
@@ -18,10 +18,12 @@ public:
   Tool *core_pointer_tool(void);
   Tool *stylus_pen_tool(void);
   Tool *stylus_eraser_tool(void);
-  Tool_texture *tool_texture(void);
+  Canvas *canvas(void);
   const_GLvecf_t foreground_color(void) const;
   const_GLvecf_t background_color(void) const;
   void sync(GdkInputSource source);
+  // shown in the title bar, NULL to clear
+  void set_status(const gchar *status);
   
 private:
   typedef enum {
@@ -29,9 +31,16 @@ private:
     _FILE_NEW,
     _FILE_OPEN,
     _FILE_IMPORT_OFF,
+    _FILE_IMPORT_RLM,
+    _FILE_IMPORT_PLY,
+    _FILE_IMPORT_XYZ,
     _FILE_SAVE,
     _FILE_SAVE_AS,
     _FILE_EXPORT_OFF,
+    _FILE_EXPORT_RLM,
+    _FILE_EXPORT_PLY,
+    _FILE_EXPORT_STL,
+    _FILE_EXPORT_OBJ,
     _FILE_CLOSE,
     _FILE_QUIT
   } _FileMenuType;
@@ -102,7 +111,7 @@ private:
   Tool *_stylus_pen_tool;
   Tool *_stylus_eraser_tool;
   std::vector<Tool *> _tools;
-  Tool_texture *_tool_texture;
+  Canvas *_canvas;
   GLvecf _foreground_color, _background_color;
   GtkWidget *_window;
   bool _toggle_black_color;
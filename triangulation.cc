@@ -1,4 +1,8 @@
+#include <algorithm>
+
 #include "application.hh"
+#include "binary_file.hh"
+#include "journal.hh"
 #include "triangulation.hh"
 
 using namespace std;
@@ -7,9 +11,57 @@ static const CGAL::Bbox_2 BBOX_NULL = CGAL::Bbox_2(0.0, 0.0, 0.0, 0.0);
 static const unsigned int NEAREST_NEIGHBOR_RANK = 2;
 // Rationale:
 // the mean number of neighbors in a 2D triangulation is 6 (see Chaine, 2003)
+static const int MORTON_BITS = 16;
+// Rationale:
+// 2 x 16 bits fit in an unsigned int
+static const double REBUILD_FRACTION = 0.25;
+// Rationale:
+// same as in tetrahedrization.cc
+static const guint64 FACE_FLAG_BITS = 7;
+// Rationale:
+// the outside flag, then 3 convection and 3 curve edge flags
+
+static unsigned int
+morton_code(unsigned int x, unsigned int y) {
+  unsigned int code = 0;
+  for (int b = MORTON_BITS - 1; b >= 0; b--) {
+    code = (code << 2) | (((x >> b) & 1) << 1) | ((y >> b) & 1);
+  }
+  return code;
+}
+
+static void
+z_order(const vector<Triangulation::Point>& points,
+        vector<unsigned int>& order) {
+  if (points.empty()) return;
+  CGAL::Bbox_2 bbox = points[0].bbox();
+  for (vector<Triangulation::Point>::const_iterator pi = points.begin();
+       pi != points.end(); pi++) {
+    bbox = bbox + pi->bbox();
+  }
+  const double scale[2] = {
+    (bbox.xmax() > bbox.xmin()) ?
+      ((1 << MORTON_BITS) - 1) / (bbox.xmax() - bbox.xmin()) : 0.0,
+    (bbox.ymax() > bbox.ymin()) ?
+      ((1 << MORTON_BITS) - 1) / (bbox.ymax() - bbox.ymin()) : 0.0
+  };
+  vector< pair<unsigned int, unsigned int> > codes(points.size());
+  for (unsigned int i = 0; i < points.size(); i++) {
+    codes[i].first
+      = morton_code((unsigned int) ((points[i].x() - bbox.xmin()) * scale[0]),
+                    (unsigned int) ((points[i].y() - bbox.ymin()) * scale[1]));
+    codes[i].second = i;
+  }
+  sort(codes.begin(), codes.end());
+  order.resize(codes.size());
+  for (unsigned int i = 0; i < codes.size(); i++) {
+    order[i] = codes[i].second;
+  }
+}
 
 Triangulation::Triangulation(Application *application) : Base() {
   _application = application;
+  _journal = NULL;
   _bbox = BBOX_NULL;
 }
 
@@ -23,7 +75,22 @@ Triangulation::bbox(void) const {
 void
 Triangulation::clear(void) {
   _bbox = BBOX_NULL;
+  _vertices_by_id.clear();
+  _free_vertex_ids.clear();
   Base::clear();
+  if (_journal != NULL) {
+    _journal->append(Journal::TRIANGULATION_CLEAR);
+  }
+}
+
+void
+Triangulation::set_journal(Journal *journal) {
+  _journal = journal;
+}
+
+Journal *
+Triangulation::journal(void) const {
+  return _journal;
 }
 
 int
@@ -81,6 +148,192 @@ Triangulation::number_of_inside_faces(void) const {
   return n;
 }
 
+void
+Triangulation::reset_flags(void) {
+  if (!Face::reset_all()) {
+    for (All_faces_iterator fi = all_faces_begin();
+         fi != all_faces_end(); fi++) {
+      fi->reset();
+    }
+  }
+}
+
+unsigned int
+Triangulation::number_of_vertex_ids(void) const {
+  return _vertices_by_id.size();
+}
+
+Triangulation::Vertex_handle
+Triangulation::vertex_with_id(unsigned int id) const {
+  assert(id < _vertices_by_id.size());
+  assert(_vertices_by_id[id] != Vertex_handle(NULL));
+  return _vertices_by_id[id];
+}
+
+void
+Triangulation::renumber_vertices(void) {
+  _vertices_by_id.clear();
+  _free_vertex_ids.clear();
+  _vertices_by_id.reserve(number_of_vertices());
+  for (Finite_vertices_iterator vi = finite_vertices_begin();
+       vi != finite_vertices_end(); vi++) {
+    vi->id() = _vertices_by_id.size();
+    _vertices_by_id.push_back(vi);
+  }
+}
+
+void
+Triangulation::write(Binary_file& file) const {
+  // vertex index 0 stands for the infinite vertex
+  vector<guint32> vertex_indices(number_of_vertex_ids(),
+                                 Binary_file::NULL_INDEX);
+  vector<FT> points, granularities;
+  points.reserve(2 * number_of_vertices());
+  granularities.reserve(number_of_vertices());
+  guint32 n = 1;
+  for (Finite_vertices_iterator vi = finite_vertices_begin();
+       vi != finite_vertices_end(); vi++, n++) {
+    assert(vi->id() < vertex_indices.size());
+    vertex_indices[vi->id()] = n;
+    points.push_back(vi->point().x());
+    points.push_back(vi->point().y());
+    granularities.push_back(vi->granularity());
+  }
+  
+  // faces are numbered in address order, as are tetrahedrization cells
+  vector<const Face *> faces;
+  if (dimension() == 2) {
+    for (All_faces_iterator fi = all_faces_begin();
+         fi != all_faces_end(); fi++) {
+      faces.push_back(&*fi);
+    }
+    sort(faces.begin(), faces.end());
+  }
+  vector<guint32> face_vertices, face_neighbors;
+  vector<guint8> flags;
+  face_vertices.reserve(3 * faces.size());
+  face_neighbors.reserve(3 * faces.size());
+  flags.reserve((FACE_FLAG_BITS * faces.size() + 7) / 8);
+  for (unsigned int f = 0; f < faces.size(); f++) {
+    const Face *face = faces[f];
+    guint64 bit = FACE_FLAG_BITS * (guint64) f;
+    Binary_file::set_bit(flags, bit, face->is_outside());
+    for (int i = 0; i < 3; i++) {
+      Vertex_handle vh(face->vertex(i));
+      face_vertices.push_back(is_infinite(vh) ? 0 : vertex_indices[vh->id()]);
+      const Face *neighbor = &*(face->neighbor(i));
+      face_neighbors.push_back(
+        lower_bound(faces.begin(), faces.end(), neighbor) - faces.begin());
+      Binary_file::set_bit(flags, bit + 1 + i, face->is_convection_edge(i));
+      Binary_file::set_bit(flags, bit + 4 + i, face->is_curve_edge(i));
+    }
+  }
+  
+  vector<guint32> header(3);
+  header[0] = dimension();
+  header[1] = number_of_vertices();
+  header[2] = faces.size();
+  file.set_section(Binary_file::TRIANGULATION, header);
+  file.set_section(Binary_file::TRIANGULATION_POINTS, points);
+  file.set_section(Binary_file::TRIANGULATION_GRANULARITIES, granularities);
+  file.set_section(Binary_file::TRIANGULATION_FACES, face_vertices);
+  file.set_section(Binary_file::TRIANGULATION_NEIGHBORS, face_neighbors);
+  file.set_section(Binary_file::TRIANGULATION_FLAGS, flags);
+}
+
+bool
+Triangulation::read(const Binary_file& file) {
+  guint64 size = 0;
+  const guint32 *header
+    = file.section<guint32>(Binary_file::TRIANGULATION, size);
+  if (header == NULL || size != 3) {
+    cerr << "Error: missing triangulation section!" << endl;
+    return false;
+  }
+  int dim = (gint32) header[0];
+  guint64 n = header[1], m = header[2];
+  
+  const FT *points
+    = file.section<FT>(Binary_file::TRIANGULATION_POINTS, size);
+  bool is_valid = (points != NULL && size == 2 * n);
+  const FT *granularities
+    = file.section<FT>(Binary_file::TRIANGULATION_GRANULARITIES, size);
+  is_valid = is_valid && (granularities != NULL && size == n);
+  const guint32 *face_vertices
+    = file.section<guint32>(Binary_file::TRIANGULATION_FACES, size);
+  is_valid = is_valid && (face_vertices != NULL && size == 3 * m);
+  const guint32 *face_neighbors
+    = file.section<guint32>(Binary_file::TRIANGULATION_NEIGHBORS, size);
+  is_valid = is_valid && (face_neighbors != NULL && size == 3 * m);
+  const guint8 *flags
+    = file.section<guint8>(Binary_file::TRIANGULATION_FLAGS, size);
+  is_valid = is_valid && (flags != NULL
+                          && size == (FACE_FLAG_BITS * m + 7) / 8);
+  is_valid = is_valid && (dim <= 2 && (dim == 2) == (m > 0));
+  
+  for (guint64 k = 0; k < 3 * m && is_valid; k++) {
+    guint64 f = face_neighbors[k];
+    is_valid = (face_vertices[k] <= n && f < m &&
+                (face_neighbors[3 * f    ] == k / 3 ||
+                 face_neighbors[3 * f + 1] == k / 3 ||
+                 face_neighbors[3 * f + 2] == k / 3));
+  }
+  if (!is_valid) {
+    cerr << "Error: corrupted triangulation sections!" << endl;
+    return false;
+  }
+  
+  clear();
+  if (dim < 2) {
+    for (guint64 i = 0; i < n; i++) {
+      Point p(points[2 * i], points[2 * i + 1]);
+      Vertex_handle vh(i == 0 ? insert_first(p) : insert(p));
+      vh->granularity() = granularities[i];
+    }
+    return true;
+  }
+  
+  Triangulation_data_structure& tds = this->tds();
+  Vertex_handle infinite = infinite_vertex();
+  if (infinite->face() != Face_handle(NULL)) {
+    tds.delete_face(infinite->face());
+  }
+  vector<Vertex_handle> vertices;
+  vertices.reserve(n + 1);
+  vertices.push_back(infinite);
+  _vertices_by_id.reserve(n);
+  for (guint64 i = 0; i < n; i++) {
+    Point p(points[2 * i], points[2 * i + 1]);
+    _bbox = (i == 0) ? p.bbox() : _bbox + p.bbox();
+    Vertex_handle vh(tds.create_vertex());
+    vh->set_point(p);
+    vh->granularity() = granularities[i];
+    vh->id() = _vertices_by_id.size();
+    _vertices_by_id.push_back(vh);
+    vertices.push_back(vh);
+  }
+  vector<Face_handle> faces;
+  faces.reserve(m);
+  for (guint64 f = 0; f < m; f++) {
+    faces.push_back(tds.create_face());
+  }
+  for (guint64 f = 0; f < m; f++) {
+    Face_handle fh(faces[f]);
+    guint64 bit = FACE_FLAG_BITS * f;
+    fh->is_outside() = Binary_file::bit(flags, bit);
+    for (int i = 0; i < 3; i++) {
+      Vertex_handle vh(vertices[face_vertices[3 * f + i]]);
+      fh->set_vertex(i, vh);
+      fh->set_neighbor(i, faces[face_neighbors[3 * f + i]]);
+      vh->set_face(fh);
+      fh->is_convection_edge(i) = Binary_file::bit(flags, bit + 1 + i);
+      fh->is_curve_edge(i) = Binary_file::bit(flags, bit + 4 + i);
+    }
+  }
+  tds.set_dimension(2);
+  return true;
+}
+
 Triangulation::Vertex_handle
 Triangulation::insert_first(const Point& p, Face_handle start) {
   if (number_of_vertices() == 0) {
@@ -92,7 +345,120 @@ Triangulation::insert_first(const Point& p, Face_handle start) {
 Triangulation::Vertex_handle
 Triangulation::insert(const Point& p, Face_handle start) {
   _bbox = _bbox + p.bbox();
-  return Base::insert(p, start);
+  if (_journal != NULL) {
+    _journal->append(Journal::TRIANGULATION_INSERT, p.x(), p.y());
+  }
+  Vertex_handle vh(Base::insert(p, start));
+  if (vh->id() == Vertex::NULL_ID) {
+    if (_free_vertex_ids.empty()) {
+      vh->id() = _vertices_by_id.size();
+      _vertices_by_id.push_back(vh);
+    } else {
+      vh->id() = _free_vertex_ids.back();
+      _free_vertex_ids.pop_back();
+      _vertices_by_id[vh->id()] = vh;
+    }
+  }
+  return vh;
+}
+
+void
+Triangulation::remove(Vertex_handle v) {
+  //CAVEAT: the bbox is not updated!
+  unsigned int id = v->id();
+  if (id != Vertex::NULL_ID) {
+    assert(id < _vertices_by_id.size() && _vertices_by_id[id] == v);
+    _vertices_by_id[id] = Vertex_handle(NULL);
+    _free_vertex_ids.push_back(id);
+  }
+  if (_journal != NULL) {
+    _journal->append(Journal::TRIANGULATION_REMOVE,
+                     v->point().x(), v->point().y());
+  }
+  Base::remove(v);
+}
+
+bool
+Triangulation::remove(const vector<Vertex_handle>& vertices) {
+  // holes are kept apart as in Tetrahedrization::remove
+  //CAVEAT: the bbox is not updated!
+  if (vertices.size() > REBUILD_FRACTION * number_of_vertices()) {
+    _rebuild_without(vertices);
+    return true;
+  }
+  vector<bool> is_reached(number_of_vertex_ids(), false);
+  vector<unsigned int> reached_ids;
+  vector<Vertex_handle> pending_vertices(vertices), deferred_vertices;
+  while (!pending_vertices.empty()) {
+    for (vector<Vertex_handle>::const_iterator
+           vhi = pending_vertices.begin();
+         vhi != pending_vertices.end(); vhi++) {
+      Vertex_handle vh(*vhi);
+      if (is_reached[vh->id()]) {
+        deferred_vertices.push_back(vh);
+        continue;
+      }
+      if (dimension() == 2) {
+        Vertex_circulator vc = incident_vertices(vh), done(vc);
+        do {
+          if (!is_infinite(vc)) {
+            is_reached[vc->id()] = true;
+            reached_ids.push_back(vc->id());
+          }
+        } while (++vc != done);
+      }
+      remove(vh);
+    }
+    for (vector<unsigned int>::const_iterator ii = reached_ids.begin();
+         ii != reached_ids.end(); ii++) {
+      is_reached[*ii] = false;
+    }
+    reached_ids.clear();
+    pending_vertices.swap(deferred_vertices);
+    deferred_vertices.clear();
+  }
+  return false;
+}
+
+void
+Triangulation::_rebuild_without(const vector<Vertex_handle>& vertices) {
+  // removals are journaled one by one
+  vector<bool> is_removed(number_of_vertex_ids(), false);
+  for (vector<Vertex_handle>::const_iterator vhi = vertices.begin();
+       vhi != vertices.end(); vhi++) {
+    Vertex_handle vh(*vhi);
+    unsigned int id = vh->id();
+    assert(id < _vertices_by_id.size() && _vertices_by_id[id] == vh);
+    is_removed[id] = true;
+    _vertices_by_id[id] = Vertex_handle(NULL);
+    _free_vertex_ids.push_back(id);
+    if (_journal != NULL) {
+      _journal->append(Journal::TRIANGULATION_REMOVE,
+                       vh->point().x(), vh->point().y());
+    }
+  }
+  vector<Point> points;
+  vector<unsigned int> ids;
+  points.reserve(number_of_vertices() - vertices.size());
+  ids.reserve(number_of_vertices() - vertices.size());
+  for (Finite_vertices_iterator vi = finite_vertices_begin();
+       vi != finite_vertices_end(); vi++) {
+    if (!is_removed[vi->id()]) {
+      points.push_back(vi->point());
+      ids.push_back(vi->id());
+    }
+  }
+  
+  Base::clear();
+  vector<unsigned int> order;
+  z_order(points, order);
+  Vertex_handle vh;
+  for (unsigned int i = 0; i < order.size(); i++) {
+    vh = Base::insert(points[order[i]],
+                      (i == 0) ? Face_handle(NULL) : vh->face());
+    vh->id() = ids[order[i]];
+    _vertices_by_id[vh->id()] = vh;
+  }
 }
 
 template <typename Vertex_handle_iterator>
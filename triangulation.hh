@@ -4,6 +4,8 @@
 #include "triangulation_base.hh"
 
 class Application;
+class Binary_file;
+class Journal;
 
 class Triangulation : public Triangulation_base {
 public:
@@ -11,12 +13,28 @@ public:
   ~Triangulation(void);
   const CGAL::Bbox_2& bbox(void) const;
   void clear(void);
+  // edits are appended to the journal, if any
+  void set_journal(Journal *journal);
+  Journal *journal(void) const;
   int number_of_curve_vertices(void) const;
   int number_of_curve_edges(void) const;
   int number_of_inside_faces(void) const;
+  // clears the classification flags of all faces, in constant time but for
+  // every instance at once
+  void reset_flags(void);
+  unsigned int number_of_vertex_ids(void) const;
+  Vertex_handle vertex_with_id(unsigned int id) const;
+  void renumber_vertices(void);
+  // the TDS is written as is, and read back without insertion
+  void write(Binary_file& file) const;
+  bool read(const Binary_file& file);
   Vertex_handle insert_first(const Point& p,
                              Face_handle start = Face_handle(NULL));
   Vertex_handle insert(const Point& p, Face_handle start = Face_handle(NULL));
+  void remove(Vertex_handle v);
+  // batch removal, returns true when the triangulation was rebuilt from the
+  // remaining points, which invalidates all handles but keeps IDs
+  bool remove(const std::vector<Vertex_handle>& vertices);
   template <typename Vertex_handle_iterator>
   int set_granularity(Vertex_handle_iterator begin,
                       Vertex_handle_iterator end);
@@ -25,8 +43,13 @@ private:
   typedef Triangulation_base Base;
   typedef Geom_traits::FT FT;
   
+  void _rebuild_without(const std::vector<Vertex_handle>& vertices);
+  
   Application *_application;
+  Journal *_journal;
   CGAL::Bbox_2 _bbox;
+  std::vector<Vertex_handle> _vertices_by_id;
+  std::vector<unsigned int> _free_vertex_ids;
 };
 
 #endif // __TRIANGULATION_HH__
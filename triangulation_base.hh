@@ -2,6 +2,7 @@
 #define __TRIANGULATION_BASE_HH__
 
 #include "cgal_utils.hh"
+#include "epoch_flags.hh"
 
 template < typename K,
            typename V = CGAL::Triangulation_vertex_base_2<K> >
@@ -22,23 +23,33 @@ public:
     typedef Triangulation_vertex<K, V2>                  Other;
   };
   
+  static const unsigned int NULL_ID = ~0u;
+  
   Triangulation_vertex(void)
     : Base(),
-      _granularity(0) {}
+      _granularity(0),
+      _id(NULL_ID) {}
   Triangulation_vertex(const Point& p)
     : Base(p),
-      _granularity(0) {}
+      _granularity(0),
+      _id(NULL_ID) {}
   Triangulation_vertex(Face_handle f)
     : Base(f),
-      _granularity(0) {}
+      _granularity(0),
+      _id(NULL_ID) {}
   Triangulation_vertex(const Point& p, Face_handle f)
     : Base(p, f),
-      _granularity(0) {}
+      _granularity(0),
+      _id(NULL_ID) {}
   FT granularity(void) const { return _granularity; }
   FT& granularity(void) { return _granularity; }
+  // item buffer ID, valid until the vertex is removed
+  unsigned int id(void) const { return _id; }
+  unsigned int& id(void) { return _id; }
   
 private:
   FT _granularity;
+  unsigned int _id;
 };
 
 template < typename K,
@@ -51,6 +62,9 @@ public:
   typedef typename F::Vertex_handle Vertex_handle;
   typedef typename F::Face_handle   Face_handle;
   
+  typedef Epoch_flags<7>            Flags;
+  typedef typename Flags::Reference Flag;
+  
   template <typename TDS2>
   struct Rebind_TDS {
     typedef typename F::template Rebind_TDS<TDS2>::Other F2;
@@ -68,38 +82,42 @@ public:
                      Face_handle   n0, Face_handle   n1, Face_handle   n2,
                      bool          c0, bool          c1, bool          c2)
     : Base(v0, v1, v2, n0, n1, n2, c0, c1, c2) { reset(); }
-  bool is_outside(void) const { return _is_outside; }
+  bool is_outside(void) const { return _flags.test(_OUTSIDE, _epoch); }
   bool is_convection_edge(unsigned int i) const {
     assert(i < 3);
-    return _is_convection_edge[i];
+    return _flags.test(_CONVECTION_EDGE + i, _epoch);
   }
   bool is_curve_edge(unsigned int i) const {
     assert(i < 3);
-    return _is_curve_edge[i];
+    return _flags.test(_CURVE_EDGE + i, _epoch);
   }
-  bool& is_outside(void) { return _is_outside; }
-  bool& is_convection_edge(unsigned int i) {
+  Flag is_outside(void) { return Flag(_flags, _OUTSIDE, _epoch); }
+  Flag is_convection_edge(unsigned int i) {
     assert(i < 3);
-    return _is_convection_edge[i];
+    return Flag(_flags, _CONVECTION_EDGE + i, _epoch);
   }
-  bool& is_curve_edge(unsigned int i) {
+  Flag is_curve_edge(unsigned int i) {
     assert(i < 3);
-    return _is_curve_edge[i];
+    return Flag(_flags, _CURVE_EDGE + i, _epoch);
   }
-  void reset(void) {
-    _is_outside = false;
-    for (int i = 0; i < 3; i++) {
-      _is_convection_edge[i] = false;
-      _is_curve_edge[i] = false;
-    }
+  void reset(void) { _flags.clear(_epoch); }
+  // resets the flags of all faces, false when the epoch wrapped around and
+  // the faces have to be reset one by one
+  static bool reset_all(void) {
+    _epoch = (_epoch + 1) & Flags::EPOCH_MAX;
+    return (_epoch != 0);
   }
   
 private:
-  bool _is_outside;
-  bool _is_convection_edge[3];
-  bool _is_curve_edge[3];
+  enum { _OUTSIDE = 0, _CONVECTION_EDGE = 1, _CURVE_EDGE = 4 };
+  
+  static unsigned int _epoch;
+  Flags _flags;
 };
 
+template <typename K, typename F>
+unsigned int Triangulation_face<K, F>::_epoch = 0;
+
 typedef Triangulation_vertex<Kernel> Vb2;
 typedef CGAL::Triangulation_hierarchy_vertex_base_2<Vb2> Vbh2;
 typedef Triangulation_face<Kernel> Fb2;
@@ -124,9 +124,9 @@ Triangulation_display::display(void) {
     glBegin(GL_POINTS);
     for (Finite_vertices_iterator vi = _triangulation.finite_vertices_begin();
          vi != _triangulation.finite_vertices_end(); vi++) {
+      index = vi->id();
       glColor4ubv(pindex);
       glPoint2(vi->point());
-      index++;
     }
     glEnd();
     
@@ -1,5 +1,14 @@
 #include "opengl_buffer.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define OPENGL_ITEMBUF_USE_SSE2
+#endif
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
+
 const GLuint  GL_FRAMEBUF_NULL_INDEX    =  ~0;
 const GLuint  GL_ITEMBUF_NULL_ID        =  ~0;
 const GLvecub GL_ITEMBUF_NULL_COLOR     = {~0, ~0, ~0, ~0};
@@ -11,6 +20,9 @@ const GLsizei GL_3D_COLOR_SIZE         = 3 + 4; /* coords + RGBA color */
 const GLsizei GL_3D_COLOR_TEXTURE_SIZE = 7 + 4;
 const GLsizei GL_4D_COLOR_TEXTURE_SIZE = 8 + 4;
 
+/* Below this number of pixels, threads cost more than they save */
+static const GLsizei GL_ITEMBUF_PARALLEL_SIZE_MIN = 128*128;
+
 /*
  * GLframebuf definitions
  */
@@ -131,6 +143,106 @@ gl_framebuf_read(GLframebuf *buf, GLenum mode) {
 /*
  * GLitembuf definitions
  */
+static GLsizei
+_gl_itembuf_skip_null_ids(const GLuint *pixels, GLsizei i, GLsizei size) {
+  /*
+   * Item buffers are mostly background, so we skip runs of null IDs
+   * sixteen then four pixels at a time before falling back to scalar code.
+   */
+#if defined(OPENGL_ITEMBUF_USE_SSE2)
+  const __m128i null_ids = _mm_set1_epi32((int) GL_ITEMBUF_NULL_ID);
+  
+  while (i + 16 <= size) {
+    __m128i ids = _mm_and_si128(
+      _mm_and_si128(_mm_loadu_si128((const __m128i *) (pixels + i)),
+                    _mm_loadu_si128((const __m128i *) (pixels + i + 4))),
+      _mm_and_si128(_mm_loadu_si128((const __m128i *) (pixels + i + 8)),
+                    _mm_loadu_si128((const __m128i *) (pixels + i + 12))));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(ids, null_ids)) != 0xFFFF) break;
+    i += 16;
+  }
+  while (i + 4 <= size) {
+    __m128i ids = _mm_loadu_si128((const __m128i *) (pixels + i));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(ids, null_ids)) != 0xFFFF) break;
+    i += 4;
+  }
+#endif
+  while (i < size && pixels[i] == GL_ITEMBUF_NULL_ID) {
+    i++;
+  }
+  return i;
+}
+
+static void
+_gl_itembuf_count_1D(const GLuint *pixels, GLsizei begin, GLsizei end,
+                     GLuint *items, GLuint nitems,
+                     GLuint *hits, GLuint *nhits) {
+  GLsizei i = _gl_itembuf_skip_null_ids(pixels, begin, end);
+  
+  while (i < end) {
+    GLuint id = pixels[i];
+    assert(id < nitems);
+    if (items[id]++ == 0u && hits != NULL) {
+      hits[(*nhits)++] = id;
+    }
+    i = _gl_itembuf_skip_null_ids(pixels, i + 1, end);
+  }
+}
+
+static void
+_gl_itembuf_histogram_1D(GLitembuf *buf) {
+  const GLsizei size = buf->gl_framebuf->width * buf->gl_framebuf->height;
+  const GLuint *pixels = (const GLuint *) buf->gl_framebuf->pixels;
+  const GLuint nitems = buf->nitems._1D;
+  
+#ifdef _OPENMP
+  int nthreads = omp_get_max_threads();
+  if (size >= GL_ITEMBUF_PARALLEL_SIZE_MIN && nthreads > 1) {
+    /*
+     * Each thread counts a slice of the image into its own private array,
+     * remembering which IDs it hit. The merge then only visits those IDs,
+     * instead of the whole range of items.
+     */
+    GLuint **thread_items = (GLuint **) calloc(nthreads, sizeof(GLuint *));
+    GLuint **thread_hits  = (GLuint **) calloc(nthreads, sizeof(GLuint *));
+    GLuint  *thread_nhits = (GLuint  *) calloc(nthreads, sizeof(GLuint));
+    int t;
+    GLuint k;
+    assert(thread_items != NULL && thread_hits != NULL &&
+           thread_nhits != NULL);
+    
+#pragma omp parallel for schedule(static)
+    for (t = 0; t < nthreads; t++) {
+      GLsizei begin = (GLsizei) (((double) size * t) / nthreads);
+      GLsizei end   = (GLsizei) (((double) size * (t + 1)) / nthreads);
+      GLsizei nhits_max = end - begin < (GLsizei) nitems ?
+                          end - begin : (GLsizei) nitems;
+      thread_items[t] = (GLuint *) calloc(nitems, sizeof(GLuint));
+      thread_hits[t]  = (GLuint *) malloc((nhits_max + 1)*sizeof(GLuint));
+      assert(thread_items[t] != NULL && thread_hits[t] != NULL);
+      _gl_itembuf_count_1D(pixels, begin, end, thread_items[t], nitems,
+                           thread_hits[t], &thread_nhits[t]);
+    }
+    
+    for (t = 0; t < nthreads; t++) {
+      for (k = 0; k < thread_nhits[t]; k++) {
+        GLuint id = thread_hits[t][k];
+        buf->items._1D[id] += thread_items[t][id];
+      }
+      free(thread_items[t]);
+      free(thread_hits[t]);
+    }
+    free(thread_items);
+    free(thread_hits);
+    free(thread_nhits);
+  } else
+#endif
+  {
+    _gl_itembuf_count_1D(pixels, 0, size, buf->items._1D, nitems,
+                         NULL, NULL);
+  }
+}
+
 void
 gl_itembuf_delete(GLitembuf *buf) {
   assert(buf != NULL);
@@ -236,13 +348,7 @@ gl_itembuf_simple_lookup(GLitembuf *buf) {
   int i;
   
   if (buf->gl_itembuf_type == GL_ITEMBUF_1D) {
-    for (i = 0; i < size; i++) {
-      GLuint id = pixels[i];
-      if (id != GL_ITEMBUF_NULL_ID) {
-        assert(id < buf->nitems._1D);
-        buf->items._1D[id]++;
-      }
-    }
+    _gl_itembuf_histogram_1D(buf);
   } else if (buf->gl_itembuf_type == GL_ITEMBUF_2D) {
     for (i = 0; i < size; i++) {
       GLuint id = pixels[i];
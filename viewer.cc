@@ -7,6 +7,7 @@
 #include "file.hh"
 #include "drawing.hh"
 #include "meshing.hh"
+#include "latency_meter.hh"
 #include "viewer.hh"
 
 using namespace std;
@@ -14,6 +15,7 @@ using namespace std;
 static const GLdouble DEFAULT_FOVY = 45.0;
 static const GLdouble DEFAULT_Z_NEAR = 2.0;
 static const GLdouble DEFAULT_Z_FAR = 6.0;
+static const GLfloat PICKED_POINT_SIZE = 6.0f;
 
 Viewer::Viewer(Application *application) {
   _application = application;
@@ -23,6 +25,7 @@ Viewer::Viewer(Application *application) {
   _menu = NULL;
   _error = gl_error_new();
   _timer = g_timer_new();
+  _latency_meter = new Latency_meter();
   _transf_ortho = gl_transf_new();
   _transf_persp = gl_transf_new();
 #if DEBUG
@@ -36,8 +39,14 @@ Viewer::Viewer(Application *application) {
   _axes_list = gl_list_new();
   _keyboard_mode = _NO_KEYBOARD;
   _button_mode = _NO_BUTTON;
+  _has_picked_point = false;
   _display_mode = _DISPLAY_DOUBLE_BUFFER;
   _tetrahedrization_display_style = Tetrahedrization_display::SOLID;
+  _samples_widget = NULL;
+  _samples_source = GDK_SOURCE_MOUSE;
+  _samples_state = 0;
+  _samples_time = 0;
+  _flush_samples_id = 0;
   
   _create_window();
   _create_menu();
@@ -62,6 +71,9 @@ Viewer::Viewer(Application *application) {
 }
 
 Viewer::~Viewer(void) {
+  if (_flush_samples_id != 0) {
+    g_source_remove(_flush_samples_id);
+  }
   gl_list_delete(_axes_list);
   if (GTK_IS_WIDGET(_window)) {
     gtk_widget_destroy(_window);
@@ -71,6 +83,7 @@ Viewer::~Viewer(void) {
   }
   gl_error_delete(_error);
   g_timer_destroy(_timer);
+  delete _latency_meter;
   gl_transf_delete(_transf_ortho);
   gl_transf_delete(_transf_persp);
 #if DEBUG
@@ -174,6 +187,16 @@ Viewer::_expose_event_cb(GtkWidget *widget, GdkEventExpose *event,
     if (viewer->_display_mode & _DISPLAY_AXES) {
       gl_list_call(viewer->_axes_list);
     }
+    if (viewer->_has_picked_point) {
+      glPushAttrib(GL_ENABLE_BIT | GL_POINT_BIT);
+      glDisable(GL_DEPTH_TEST);
+      glPointSize(PICKED_POINT_SIZE);
+      glColor4fv(GL_PURE_RED);
+      glBegin(GL_POINTS);
+      glVertex3fv(viewer->_picked_point);
+      glEnd();
+      glPopAttrib();
+    }
     
     glPopAttrib();
     gl_transf_end(viewer->_transf_persp);
@@ -195,6 +218,14 @@ Viewer::_expose_event_cb(GtkWidget *widget, GdkEventExpose *event,
       glPopAttrib();
     } else {
 #endif
+      GLveci quadi;
+      gl_veci_set(quadi,
+                  event->area.x,
+                  widget->allocation.height
+                  - (event->area.y + event->area.height),
+                  event->area.x + event->area.width,
+                  widget->allocation.height - event->area.y);
+      viewer->_drawing->damage(quadi);
       viewer->_drawing->draw();
 #if DEBUG
     }
@@ -208,8 +239,9 @@ Viewer::_expose_event_cb(GtkWidget *widget, GdkEventExpose *event,
   if (viewer->_display_mode & _DISPLAY_DOUBLE_BUFFER) {
     gdk_gl_drawable_swap_buffers(gldrawable);
   } else {
-    glFinish();
+    glFlush();
   }
+  viewer->_measure_latency();
   
   gdk_gl_drawable_gl_end(gldrawable);
   
@@ -330,6 +362,8 @@ Viewer::_key_release_event_cb(GtkWidget *widget, GdkEventKey *event,
 gboolean
 Viewer::_button_press_event_cb(GtkWidget *widget, GdkEventButton *event,
                                Viewer *viewer) {
+  viewer->_flush_samples();
+  
   GdkGLContext  *glcontext  = gtk_widget_get_gl_context(widget);
   GdkGLDrawable *gldrawable = gtk_widget_get_gl_drawable(widget);
   
@@ -372,10 +406,17 @@ Viewer::_button_press_event_cb(GtkWidget *widget, GdkEventButton *event,
       gdk_event_get_axis((GdkEvent *) event, GDK_AXIS_PRESSURE, &pressure);
       gdk_event_get_axis((GdkEvent *) event, GDK_AXIS_XTILT, &xtilt);
       gdk_event_get_axis((GdkEvent *) event, GDK_AXIS_YTILT, &ytilt);
+      if (viewer->_display_mode & _DISPLAY_FPS) {
+        viewer->_latency_meter->receive(event->time);
+      }
       viewer->_drawing->start_drawing_stroke(
         event->device->source, event->state,
         event->x, widget->allocation.height - 1 - event->y,
         pressure, xtilt, ytilt);
+      if (viewer->_display_mode & _DISPLAY_FPS) {
+        viewer->_latency_meter->rasterize(viewer->_drawing->tool()->name());
+      }
+      viewer->_samples_time = event->time;
     } break;
     case _KEYBOARD_SPACE:
       // nothing to do
@@ -413,6 +454,21 @@ Viewer::_button_press_event_cb(GtkWidget *widget, GdkEventButton *event,
   } break;
   case _BUTTON_2:
     viewer->_button_mode = _BUTTON_2;
+    if (viewer->_display_mode & _DISPLAY_DOUBLE_BUFFER) {
+      // surface point under the cursor, shown until the button is released
+      viewer->_has_picked_point
+        = viewer->_meshing->pick(viewer->_transf_persp,
+                                 event->x,
+                                 widget->allocation.height - 1 - event->y,
+                                 viewer->_picked_point);
+#if DEBUG
+      if (viewer->_has_picked_point) {
+        cout << "Picked point " << viewer->_picked_point[0] << " "
+             << viewer->_picked_point[1] << " "
+             << viewer->_picked_point[2] << endl;
+      }
+#endif
+    }
     break;
   case _BUTTON_3:
     viewer->_button_mode = _BUTTON_3;
@@ -428,14 +484,16 @@ Viewer::_button_press_event_cb(GtkWidget *widget, GdkEventButton *event,
   }
   
   gdk_gl_drawable_gl_end(gldrawable);
-  gdk_window_invalidate_rect(widget->window, &widget->allocation, FALSE);
-  gdk_window_process_updates(widget->window, FALSE);
+  viewer->_redraw(widget);
   return TRUE;
 }
 
 gboolean
 Viewer::_button_release_event_cb(GtkWidget *widget, GdkEventButton *event,
                                  Viewer *viewer) {
+  // the stroke ends after the motion still queued
+  viewer->_flush_samples();
+  
   GdkGLContext  *glcontext  = gtk_widget_get_gl_context(widget);
   GdkGLDrawable *gldrawable = gtk_widget_get_gl_drawable(widget);
   
@@ -453,10 +511,16 @@ Viewer::_button_release_event_cb(GtkWidget *widget, GdkEventButton *event,
       gdk_event_get_axis((GdkEvent *) event, GDK_AXIS_PRESSURE, &pressure);
       gdk_event_get_axis((GdkEvent *) event, GDK_AXIS_XTILT, &xtilt);
       gdk_event_get_axis((GdkEvent *) event, GDK_AXIS_YTILT, &ytilt);
+      if (viewer->_display_mode & _DISPLAY_FPS) {
+        viewer->_latency_meter->receive(event->time);
+      }
       viewer->_drawing->stop_drawing_stroke(
         event->device->source, event->state,
         event->x, widget->allocation.height - 1 - event->y,
         pressure, xtilt, ytilt);
+      if (viewer->_display_mode & _DISPLAY_FPS) {
+        viewer->_latency_meter->rasterize(viewer->_drawing->tool()->name());
+      }
     } break;
     case _KEYBOARD_SPACE:
       // nothing to do
@@ -488,6 +552,7 @@ Viewer::_button_release_event_cb(GtkWidget *widget, GdkEventButton *event,
     break;
   case _BUTTON_2:
     viewer->_button_mode = _NO_BUTTON;
+    viewer->_has_picked_point = false;
     break;
   case _BUTTON_3:
     viewer->_button_mode = _NO_BUTTON;
@@ -501,17 +566,25 @@ Viewer::_button_release_event_cb(GtkWidget *widget, GdkEventButton *event,
   viewer->_keyboard_mode = _NO_KEYBOARD;
   
   gdk_gl_drawable_gl_end(gldrawable);
-  gdk_window_invalidate_rect(widget->window, &widget->allocation, FALSE);
-  gdk_window_process_updates(widget->window, FALSE);
+  viewer->_redraw(widget);
   return TRUE;
 }
 
 gboolean
 Viewer::_motion_notify_event_cb(GtkWidget *widget, GdkEventMotion *event,
                                 Viewer *viewer) {
+  if (event->is_hint) {
+    // asks for the next motion event
+    gdk_device_get_state(event->device, event->window, NULL, NULL);
+  }
   if (viewer->_button_mode == _BUTTON_1) {
     assert(event->state & GDK_BUTTON1_MASK); // fool-proof
     
+    if (viewer->_keyboard_mode == _NO_KEYBOARD) {
+      viewer->_queue_samples(widget, event);
+      return TRUE;
+    }
+    
     GdkGLContext  *glcontext  = gtk_widget_get_gl_context(widget);
     GdkGLDrawable *gldrawable = gtk_widget_get_gl_drawable(widget);
     
@@ -520,18 +593,6 @@ Viewer::_motion_notify_event_cb(GtkWidget *widget, GdkEventMotion *event,
     }
     
     switch (viewer->_keyboard_mode) {
-    case _NO_KEYBOARD: {
-      gdouble x, y;
-      gdouble pressure;
-      gdouble xtilt, ytilt;
-      gdk_event_get_axis((GdkEvent *) event, GDK_AXIS_PRESSURE, &pressure);
-      gdk_event_get_axis((GdkEvent *) event, GDK_AXIS_XTILT, &xtilt);
-      gdk_event_get_axis((GdkEvent *) event, GDK_AXIS_YTILT, &ytilt);
-      viewer->_drawing->draw_stroke(
-        event->device->source, event->state,
-        event->x, widget->allocation.height - 1 - event->y,
-        pressure, xtilt, ytilt);
-    } break;
     case _KEYBOARD_SPACE:
       // nothing to do
       break;
@@ -556,8 +617,7 @@ Viewer::_motion_notify_event_cb(GtkWidget *widget, GdkEventMotion *event,
     }
     
     gdk_gl_drawable_gl_end(gldrawable);
-    gdk_window_invalidate_rect(widget->window, &widget->allocation, FALSE);
-    gdk_window_process_updates(widget->window, FALSE);
+    viewer->_redraw(widget);
     return TRUE;
   } else {
     viewer->_application->toolbox()->sync(event->device->source);
@@ -616,6 +676,13 @@ Viewer::_item_factory_misc_cb(Viewer *viewer, guint action,
   }
 }
 
+gboolean
+Viewer::_flush_samples_cb(Viewer *viewer) {
+  viewer->_flush_samples_id = 0;
+  viewer->_flush_samples();
+  return FALSE;
+}
+
 GLboolean
 Viewer::_display_axes_list_cb(void *data, GLboolean test_proxy) {
   if (test_proxy) return GL_TRUE;
@@ -751,7 +818,8 @@ Viewer::_create_window(void) {
                                       GDK_KEY_RELEASE_MASK    |
                                       GDK_BUTTON_PRESS_MASK   |
                                       GDK_BUTTON_RELEASE_MASK |
-                                      GDK_POINTER_MOTION_MASK);
+                                      GDK_POINTER_MOTION_MASK |
+                                      GDK_POINTER_MOTION_HINT_MASK);
   gtk_widget_set_extension_events(drawing_area, GDK_EXTENSION_EVENTS_CURSOR);
   gtk_box_pack_start(GTK_BOX(vbox), drawing_area, TRUE, TRUE, 0);
   g_signal_connect_after(G_OBJECT(drawing_area), "realize",
@@ -882,6 +950,130 @@ Viewer::_set_perspective_projection_matrix(void) {
   glPopAttrib();
 }
 
+// motion events are only queued, the samples being drawn when the event
+// queue is empty, at the priority GTK+ redraws at
+void
+Viewer::_queue_samples(GtkWidget *widget, GdkEventMotion *event) {
+  if (!_samples.empty() && (event->device->source != _samples_source ||
+                            event->state != _samples_state)) {
+    _flush_samples();
+  }
+  _samples_widget = widget;
+  _samples_source = event->device->source;
+  _samples_state = event->state;
+  
+  Tool::Sample sample;
+  GdkTimeCoord **history;
+  gint n;
+  if (event->time > _samples_time + 1 &&
+      gdk_device_get_history(event->device, event->window,
+                             _samples_time + 1, event->time - 1,
+                             &history, &n)) {
+    for (gint i = 0; i < n; i++) {
+      gdouble *axes = history[i]->axes;
+      sample.pressure = 1.0;
+      sample.xtilt = sample.ytilt = 0.0;
+      gdk_device_get_axis(event->device, axes, GDK_AXIS_X, &sample.x);
+      gdk_device_get_axis(event->device, axes, GDK_AXIS_Y, &sample.y);
+      gdk_device_get_axis(event->device, axes, GDK_AXIS_PRESSURE,
+                          &sample.pressure);
+      gdk_device_get_axis(event->device, axes, GDK_AXIS_XTILT,
+                          &sample.xtilt);
+      gdk_device_get_axis(event->device, axes, GDK_AXIS_YTILT,
+                          &sample.ytilt);
+      sample.y = widget->allocation.height - 1 - sample.y;
+      _samples.push_back(sample);
+      if (_display_mode & _DISPLAY_FPS) {
+        _latency_meter->receive(history[i]->time);
+      }
+    }
+    gdk_device_free_history(history, n);
+  }
+  sample.pressure = 1.0;
+  sample.xtilt = sample.ytilt = 0.0;
+  gdk_event_get_axis((GdkEvent *) event, GDK_AXIS_PRESSURE, &sample.pressure);
+  gdk_event_get_axis((GdkEvent *) event, GDK_AXIS_XTILT, &sample.xtilt);
+  gdk_event_get_axis((GdkEvent *) event, GDK_AXIS_YTILT, &sample.ytilt);
+  sample.x = event->x;
+  sample.y = widget->allocation.height - 1 - event->y;
+  _samples.push_back(sample);
+  _samples_time = event->time;
+  if (_display_mode & _DISPLAY_FPS) {
+    _latency_meter->receive(event->time);
+  }
+  
+  if (_flush_samples_id == 0) {
+    _flush_samples_id = g_idle_add_full(GDK_PRIORITY_REDRAW,
+                                        (GSourceFunc) _flush_samples_cb,
+                                        this, NULL);
+  }
+}
+
+void
+Viewer::_flush_samples(void) {
+  if (_flush_samples_id != 0) {
+    g_source_remove(_flush_samples_id);
+    _flush_samples_id = 0;
+  }
+  if (_samples.empty()) {
+    return;
+  }
+  
+  GdkGLContext  *glcontext  = gtk_widget_get_gl_context(_samples_widget);
+  GdkGLDrawable *gldrawable = gtk_widget_get_gl_drawable(_samples_widget);
+  
+  if (gdk_gl_drawable_gl_begin(gldrawable, glcontext)) {
+    _drawing->draw_stroke(_samples_source, _samples_state, _samples);
+    if (_display_mode & _DISPLAY_FPS) {
+      _latency_meter->rasterize(_drawing->tool()->name());
+    }
+    gdk_gl_drawable_gl_end(gldrawable);
+    _redraw(_samples_widget);
+  }
+  _samples.clear();
+}
+
+// while drawing, only the damaged quads are composited again, directly
+// instead of through an expose of the whole window
+void
+Viewer::_redraw(GtkWidget *widget) {
+  bool is_exposing = (_display_mode & _DISPLAY_DOUBLE_BUFFER);
+#if DEBUG
+  is_exposing = is_exposing || (_display_mode & _DISPLAY_TRIANGULATION);
+#endif
+  if (is_exposing) {
+    gdk_window_invalidate_rect(widget->window, &widget->allocation, FALSE);
+    gdk_window_process_updates(widget->window, FALSE);
+    return;
+  }
+  
+  GdkGLContext  *glcontext  = gtk_widget_get_gl_context(widget);
+  GdkGLDrawable *gldrawable = gtk_widget_get_gl_drawable(widget);
+  
+  if (!gdk_gl_drawable_gl_begin(gldrawable, glcontext)) {
+    return;
+  }
+  _drawing->draw();
+#if DEBUG
+  gl_error_report(_error);
+#endif
+  glFlush();
+  _measure_latency();
+  gdk_gl_drawable_gl_end(gldrawable);
+  
+  _measure_fps();
+}
+
+// OpenGL 1.4 has no fence, the time the commands complete is given by
+// glFinish, which only stalls the pipeline while measuring
+void
+Viewer::_measure_latency(void) {
+  if (_display_mode & _DISPLAY_FPS) {
+    glFinish();
+    _latency_meter->display();
+  }
+}
+
 void
 Viewer::_measure_fps(void) {
   const gdouble FPS_MEASUREMENT_PERIOD = 5.0;
@@ -894,6 +1086,11 @@ Viewer::_measure_fps(void) {
       gdouble fps = frames/seconds;
       g_print("%i frames in %6.3f seconds = %6.3f fps\n",
               frames, seconds, fps);
+      if (!(_display_mode & _DISPLAY_DOUBLE_BUFFER)) {
+        g_print("%lu pixels composited per frame\n",
+                _drawing->composited_area() / frames);
+      }
+      _latency_meter->report();
       g_timer_reset(_timer);
       frames = 0;
     }
@@ -2,6 +2,7 @@
 #define __VIEWER_HH__
 
 #include <gtk/gtk.h>
+#include <vector>
 #include <opengl_utils.h>
 #if DEBUG
 #include <trackdisk.h>
@@ -10,9 +11,11 @@
 
 #include "tetrahedrization_display.hh"
 #include "cgal_utils.hh"
+#include "tool.hh"
 
 class Application;
 class Drawing;
+class Latency_meter;
 class Meshing;
 
 class Viewer {
@@ -110,12 +113,19 @@ private:
                                     guint action,
                                     GtkWidget *widget);
   static GLboolean _display_axes_list_cb(void *data, GLboolean test_proxy);
+  static gboolean _flush_samples_cb(Viewer *viewer);
   
   void _create_window(void);
   void _create_menu(void);
   void _set_window(GtkWidget *window);
   void _set_menu(GtkWidget *menu);
   void _set_perspective_projection_matrix(void);
+  // the motion history since the last sample is fetched too
+  void _queue_samples(GtkWidget *widget, GdkEventMotion *event);
+  void _flush_samples(void);
+  void _redraw(GtkWidget *widget);
+  // waits for the pixels drawn to be displayed, when measuring latency
+  void _measure_latency(void);
   void _measure_fps(void);
   
   Application *_application;
@@ -125,6 +135,7 @@ private:
   GtkWidget *_menu;
   GLerror *_error;
   GTimer *_timer;
+  Latency_meter *_latency_meter;
   GLtransf *_transf_ortho, *_transf_persp;
 #if DEBUG
   Trackdisk *_trackdisk;
@@ -135,8 +146,16 @@ private:
   GLlist *_axes_list;
   _KeyboardMode _keyboard_mode;
   _ButtonMode _button_mode;
+  GLvecf _picked_point;
+  bool _has_picked_point;
   guint _display_mode;
   Tetrahedrization_display::Style _tetrahedrization_display_style;
+  std::vector<Tool::Sample> _samples; // drawn once per frame
+  GtkWidget *_samples_widget;
+  GdkInputSource _samples_source;
+  guint _samples_state;
+  guint32 _samples_time;
+  guint _flush_samples_id;
 };
 
 #endif // __VIEWER_HH__
@@ -0,0 +1,253 @@
+#include <algorithm>
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+
+#include "voxel_grid.hh"
+
+using namespace std;
+
+static const unsigned int GRANULARITY_RANK = 5;
+// Rationale:
+// the rank of the neighbor whose distance is the granularity of a vertex,
+// see NEAREST_NEIGHBOR_RANK in tetrahedrization.cc
+static const double VOXELS_PER_GRANULARITY = 1.26;
+// Rationale:
+// on a surface sampled one point per voxel of size s, a disk of radius r
+// holds about pi * r^2 / s^2 points, so that the fifth nearest neighbor is
+// about sqrt(5 / pi) * s = 1.26 * s away
+static const unsigned int GRANULARITY_SAMPLES = 1024;
+// Rationale:
+// the median over a thousand points is within a few percent of the median
+// over all of them, for a fraction of the cost of thinning
+static const int BISECTION_STEPS = 8;
+// Rationale:
+// sizes are then within 2^(1/256) of each other, much finer than what
+// changes the number of points kept
+static const double KEY_MAX = 1 << 30;
+
+Voxel_grid::Voxel_grid(double size, unsigned int max_points)
+  : _size(size),
+    _max_points(max_points),
+    _number_of_points_inserted(0),
+    _points(),
+    _voxels() {
+  assert(size >= 0.0 && max_points > 0);
+  for (int j = 0; j < 3; j++) {
+    _min[j] = DBL_MAX;
+    _max[j] = -DBL_MAX;
+  }
+}
+
+Voxel_grid::~Voxel_grid(void) {}
+
+void
+Voxel_grid::insert(double x, double y, double z) {
+  const double p[3] = { x, y, z };
+  _number_of_points_inserted++;
+  for (int j = 0; j < 3; j++) {
+    if (p[j] < _min[j]) _min[j] = p[j];
+    if (p[j] > _max[j]) _max[j] = p[j];
+  }
+  if (_size == 0.0) {
+    _points.insert(_points.end(), p, p + 3);
+  } else {
+    _insert(p);
+  }
+  if (number_of_points() > _max_points) {
+    _coarsen();
+  }
+}
+
+double
+Voxel_grid::size(void) const {
+  return _size;
+}
+
+unsigned int
+Voxel_grid::number_of_points(void) const {
+  return (_size == 0.0) ? _points.size() / 3 : _voxels.size();
+}
+
+unsigned int
+Voxel_grid::number_of_points_inserted(void) const {
+  return _number_of_points_inserted;
+}
+
+void
+Voxel_grid::get_points(vector<double>& coordinates) const {
+  if (_size == 0.0) {
+    coordinates = _points;
+  } else {
+    coordinates.clear();
+    coordinates.reserve(3 * _voxels.size());
+    for (_Voxel_map::const_iterator vi = _voxels.begin();
+         vi != _voxels.end(); vi++) {
+      coordinates.insert(coordinates.end(), vi->second.p, vi->second.p + 3);
+    }
+  }
+}
+
+Voxel_grid::_Key
+Voxel_grid::_key(const double p[3], double size) {
+  _Key key;
+  for (int j = 0; j < 3; j++) {
+    double i = floor(p[j] / size);
+    if (i < -KEY_MAX) i = -KEY_MAX;
+    if (i > KEY_MAX) i = KEY_MAX;
+    key.i[j] = (gint32) i;
+  }
+  return key;
+}
+
+void
+Voxel_grid::_insert(const double p[3]) {
+  _Key key = _key(p, _size);
+  double squared_distance = 0.0;
+  for (int j = 0; j < 3; j++) {
+    double d = p[j] - (key.i[j] + 0.5) * _size;
+    squared_distance += d * d;
+  }
+  pair<_Voxel_map::iterator, bool> inserted
+    = _voxels.insert(make_pair(key, _Voxel()));
+  _Voxel& voxel = inserted.first->second;
+  if (inserted.second || squared_distance < voxel.squared_distance) {
+    for (int j = 0; j < 3; j++) voxel.p[j] = p[j];
+    voxel.squared_distance = squared_distance;
+  }
+}
+
+void
+Voxel_grid::_thin(const vector<double>& points) {
+  _voxels.clear();
+  for (unsigned int i = 0; i < points.size(); i += 3) {
+    _insert(&points[i]);
+  }
+}
+
+void
+Voxel_grid::_coarsen(void) {
+  vector<double> points;
+  get_points(points);
+  if (_size == 0.0) {
+    _size = _granularity_size(points);
+    _points.clear();
+  }
+  _thin(points);
+  
+  // at most three quarters of the maximum, so that coarsening stays rare,
+  // and at least half of it, so that the budget is used
+  const unsigned int target_max = max(_max_points - _max_points / 4, 1u);
+  const unsigned int target_min = _max_points / 2;
+  double fine = 0.0;
+  while (_voxels.size() > target_max) {
+    fine = _size;
+    _size *= 2.0;
+    _thin(points);
+  }
+  if (fine > 0.0) {
+    // too many points are kept with the fine size, few enough with the
+    // coarse one: the size is bisected between them
+    double coarse = _size;
+    for (int i = 0; i < BISECTION_STEPS &&
+                    (_voxels.size() < target_min ||
+                     _voxels.size() > target_max); i++) {
+      _size = sqrt(fine * coarse);
+      _thin(points);
+      if (_voxels.size() > target_max) {
+        fine = _size;
+      } else {
+        coarse = _size;
+      }
+    }
+    if (_voxels.size() > target_max) {
+      _size = coarse;
+      _thin(points);
+    }
+  }
+}
+
+double
+Voxel_grid::_granularity_size(const vector<double>& points) const {
+  /*
+   * Surface reconstruction measures the granularity of a vertex as the
+   * distance to its GRANULARITY_RANK-th nearest neighbor. Its median is
+   * taken over a sample of the points, the neighbors being searched ring
+   * by ring in a coarse grid of cells, and converted to the size of voxels
+   * that would keep the same granularity.
+   */
+  const unsigned int n = points.size() / 3;
+  double diagonal = 0.0;
+  for (int j = 0; j < 3; j++) {
+    diagonal += (_max[j] - _min[j]) * (_max[j] - _min[j]);
+  }
+  diagonal = sqrt(diagonal);
+  if (n <= GRANULARITY_RANK || diagonal == 0.0) {
+    return (diagonal > 0.0) ? diagonal : 1.0;
+  }
+  
+  // a few points per cell when they spread over a surface
+  typedef map<_Key, vector<unsigned int>, _Key_less> Cell_map;
+  const double cell_size = diagonal * sqrt(GRANULARITY_RANK / (double) n);
+  Cell_map cells;
+  for (unsigned int i = 0; i < n; i++) {
+    cells[_key(&points[3 * i], cell_size)].push_back(i);
+  }
+  
+  vector<double> granularities, squared_distances;
+  const unsigned int step = max(n / GRANULARITY_SAMPLES, 1u);
+  for (unsigned int i = 0; i < n; i += step) {
+    const double *p = &points[3 * i];
+    const _Key center = _key(p, cell_size);
+    double kth = DBL_MAX;
+    squared_distances.clear();
+    for (int r = 0; ; r++) {
+      // cells of the ring at distance r from the center cell
+      for (int dx = -r; dx <= r; dx++) {
+        for (int dy = -r; dy <= r; dy++) {
+          const bool is_side = (dx == -r || dx == r || dy == -r || dy == r);
+          for (int dz = -r; dz <= r; dz += (is_side || r == 0) ? 1 : 2 * r) {
+            _Key key;
+            key.i[0] = center.i[0] + dx;
+            key.i[1] = center.i[1] + dy;
+            key.i[2] = center.i[2] + dz;
+            Cell_map::const_iterator ci = cells.find(key);
+            if (ci == cells.end()) continue;
+            for (vector<unsigned int>::const_iterator ii
+                   = ci->second.begin(); ii != ci->second.end(); ii++) {
+              if (*ii == i) continue;
+              const double *q = &points[3 * *ii];
+              squared_distances.push_back(
+                (p[0] - q[0]) * (p[0] - q[0]) +
+                (p[1] - q[1]) * (p[1] - q[1]) +
+                (p[2] - q[2]) * (p[2] - q[2]));
+            }
+          }
+        }
+      }
+      if (squared_distances.size() >= GRANULARITY_RANK) {
+        nth_element(squared_distances.begin(),
+                    squared_distances.begin() + GRANULARITY_RANK - 1,
+                    squared_distances.end());
+        kth = squared_distances[GRANULARITY_RANK - 1];
+      }
+      // points of farther rings are more than r cells away
+      if (kth <= (r * cell_size) * (r * cell_size) ||
+          r * cell_size > diagonal) {
+        break;
+      }
+    }
+    if (kth < DBL_MAX) {
+      granularities.push_back(sqrt(kth));
+    }
+  }
+  if (granularities.empty()) {
+    return diagonal;
+  }
+  nth_element(granularities.begin(),
+              granularities.begin() + granularities.size() / 2,
+              granularities.end());
+  double size = granularities[granularities.size() / 2]
+                / VOXELS_PER_GRANULARITY;
+  return (size > 0.0) ? size : diagonal / n;
+}
@@ -0,0 +1,63 @@
+#ifndef __VOXEL_GRID_HH__
+#define __VOXEL_GRID_HH__
+
+#include <map>
+#include <vector>
+#include <glib.h>
+
+/*
+ * Thinning of a point stream: one point is kept per cubic voxel, the one
+ * closest to the voxel center, so that the points kept are about one
+ * voxel apart. Voxels are stored sparsely, memory scaling with the points
+ * kept. Whenever more than the maximum number of points are kept, the
+ * voxel size is searched for again, so that between half and three
+ * quarters of the maximum are kept, and the points kept are thinned again.
+ */
+class Voxel_grid {
+public:
+  // a zero size keeps every point until there are too many, then starts
+  // from the granularity of the points held, as surface reconstruction
+  // measures it
+  Voxel_grid(double size, unsigned int max_points);
+  ~Voxel_grid(void);
+  void insert(double x, double y, double z);
+  double size(void) const;
+  unsigned int number_of_points(void) const;
+  unsigned int number_of_points_inserted(void) const;
+  // 3 coordinates per point kept
+  void get_points(std::vector<double>& coordinates) const;
+  
+private:
+  typedef struct {
+    gint32 i[3];
+  } _Key;
+  
+  typedef struct {
+    double p[3];
+    double squared_distance;
+  } _Voxel;
+  
+  struct _Key_less {
+    bool operator()(const _Key& a, const _Key& b) const {
+      if (a.i[0] != b.i[0]) return a.i[0] < b.i[0];
+      if (a.i[1] != b.i[1]) return a.i[1] < b.i[1];
+      return a.i[2] < b.i[2];
+    }
+  };
+  
+  typedef std::map<_Key, _Voxel, _Key_less> _Voxel_map;
+  
+  static _Key _key(const double p[3], double size);
+  void _insert(const double p[3]);
+  void _thin(const std::vector<double>& points);
+  void _coarsen(void);
+  double _granularity_size(const std::vector<double>& points) const;
+  
+  double _size;
+  unsigned int _max_points, _number_of_points_inserted;
+  std::vector<double> _points; // while the size is zero
+  _Voxel_map _voxels;
+  double _min[3], _max[3];
+};
+
+#endif // __VOXEL_GRID_HH__